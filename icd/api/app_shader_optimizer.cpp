@@ -37,6 +37,8 @@
 
 #include "include/app_shader_optimizer.h"
 
+#include "res/ver.h"
+
 #include "palDbgPrint.h"
 #include "palFile.h"
 
@@ -44,9 +46,241 @@
 #include "utils/json_reader.h"
 #endif
 
+#include <algorithm>
+
 namespace vk
 {
 
+// =====================================================================================================================
+// Orders two (code hash, stage) pairs.  Returns a negative value, zero or a positive value if the first pair is less
+// than, equal to or greater than the second one.
+static int32_t CompareProfileHashKey(
+    const Pal::ShaderHash& hashA,
+    uint32_t               stageA,
+    const Pal::ShaderHash& hashB,
+    uint32_t               stageB)
+{
+    int32_t result = 0;
+
+    if (hashA.upper != hashB.upper)
+    {
+        result = (hashA.upper < hashB.upper) ? -1 : 1;
+    }
+    else if (hashA.lower != hashB.lower)
+    {
+        result = (hashA.lower < hashB.lower) ? -1 : 1;
+    }
+    else if (stageA != stageB)
+    {
+        result = (stageA < stageB) ? -1 : 1;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Strict weak ordering of the hash key table.  Keys of equal hash and stage are ordered by entry so that a range of
+// matching keys visits the entries in the order in which they were declared.
+static bool ProfileHashKeyLess(
+    const PipelineProfileHashKey& lhs,
+    const PipelineProfileHashKey& rhs)
+{
+    const int32_t result = CompareProfileHashKey(lhs.codeHash, lhs.stage, rhs.codeHash, rhs.stage);
+
+    return (result < 0) || ((result == 0) && (lhs.entry < rhs.entry));
+}
+
+// =====================================================================================================================
+// Returns the position of the first key in the sorted hash key table that is not less than the given hash and stage.
+static uint32_t FindFirstProfileHashKey(
+    const PipelineProfile& profile,
+    const Pal::ShaderHash& codeHash,
+    uint32_t               stage)
+{
+    uint32_t first = 0;
+    uint32_t count = profile.hashKeyCount;
+
+    while (count > 0)
+    {
+        const uint32_t step = count / 2;
+        const uint32_t mid  = first + step;
+
+        if (CompareProfileHashKey(profile.pHashKeys[mid].codeHash, profile.pHashKeys[mid].stage, codeHash, stage) < 0)
+        {
+            first  = mid + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+// =====================================================================================================================
+// Appends a zero-initialized entry to the given profile, growing its entry array as needed.  Returns nullptr if out of
+// memory.
+static PipelineProfileEntry* AddProfileEntry(
+    Instance*        pInstance,
+    PipelineProfile* pProfile)
+{
+    if (pProfile->entryCount == pProfile->entryCapacity)
+    {
+        const uint32_t newCapacity = Util::Max(pProfile->entryCapacity * 2, 8u);
+
+        PipelineProfileEntry* pNewEntries = static_cast<PipelineProfileEntry*>(pInstance->AllocMem(
+            newCapacity * sizeof(PipelineProfileEntry),
+            VK_DEFAULT_MEM_ALIGN,
+            VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+
+        if (pNewEntries == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (pProfile->pEntries != nullptr)
+        {
+            memcpy(pNewEntries, pProfile->pEntries, pProfile->entryCount * sizeof(PipelineProfileEntry));
+
+            pInstance->FreeMem(pProfile->pEntries);
+        }
+
+        pProfile->pEntries      = pNewEntries;
+        pProfile->entryCapacity = newCapacity;
+    }
+
+    PipelineProfileEntry* pEntry = &pProfile->pEntries[pProfile->entryCount++];
+
+    memset(pEntry, 0, sizeof(*pEntry));
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+// Frees the index built by CompileProfile().
+static void DestroyProfileIndex(
+    Instance*        pInstance,
+    PipelineProfile* pProfile)
+{
+    if (pProfile->pHashKeys != nullptr)
+    {
+        pInstance->FreeMem(pProfile->pHashKeys);
+    }
+
+    if (pProfile->pResidualEntries != nullptr)
+    {
+        pInstance->FreeMem(pProfile->pResidualEntries);
+    }
+
+    pProfile->hashKeyCount     = 0;
+    pProfile->pHashKeys        = nullptr;
+    pProfile->residualCount    = 0;
+    pProfile->pResidualEntries = nullptr;
+}
+
+// =====================================================================================================================
+// Frees all memory owned by the given profile and resets it to an empty profile.
+static void DestroyProfile(
+    Instance*        pInstance,
+    PipelineProfile* pProfile)
+{
+    DestroyProfileIndex(pInstance, pProfile);
+
+    if (pProfile->pEntries != nullptr)
+    {
+        pInstance->FreeMem(pProfile->pEntries);
+    }
+
+    memset(pProfile, 0, sizeof(*pProfile));
+}
+
+// =====================================================================================================================
+// Builds the lookup index of a profile.  Every entry that tests a code hash is keyed by the first such stage; all other
+// entries (including "always" entries) go to the residual list that is tested against every pipeline.
+static bool CompileProfile(
+    Instance*        pInstance,
+    PipelineProfile* pProfile)
+{
+    DestroyProfileIndex(pInstance, pProfile);
+
+    uint32_t hashKeyCount = 0;
+
+    for (uint32_t entry = 0; entry < pProfile->entryCount; ++entry)
+    {
+        const PipelineProfilePattern& pattern = pProfile->pEntries[entry].pattern;
+
+        for (uint32_t stage = 0; (stage < ShaderStageCount) && (pattern.match.always == 0); ++stage)
+        {
+            if (pattern.shaders[stage].match.codeHash)
+            {
+                hashKeyCount++;
+                break;
+            }
+        }
+    }
+
+    const uint32_t residualCount = pProfile->entryCount - hashKeyCount;
+
+    if (hashKeyCount > 0)
+    {
+        pProfile->pHashKeys = static_cast<PipelineProfileHashKey*>(pInstance->AllocMem(
+            hashKeyCount * sizeof(PipelineProfileHashKey),
+            VK_DEFAULT_MEM_ALIGN,
+            VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+    }
+
+    if (residualCount > 0)
+    {
+        pProfile->pResidualEntries = static_cast<uint32_t*>(pInstance->AllocMem(
+            residualCount * sizeof(uint32_t),
+            VK_DEFAULT_MEM_ALIGN,
+            VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+    }
+
+    if (((hashKeyCount > 0) && (pProfile->pHashKeys == nullptr)) ||
+        ((residualCount > 0) && (pProfile->pResidualEntries == nullptr)))
+    {
+        DestroyProfileIndex(pInstance, pProfile);
+
+        return false;
+    }
+
+    for (uint32_t entry = 0; entry < pProfile->entryCount; ++entry)
+    {
+        const PipelineProfilePattern& pattern = pProfile->pEntries[entry].pattern;
+
+        uint32_t keyStage = ShaderStageCount;
+
+        for (uint32_t stage = 0; (stage < ShaderStageCount) && (pattern.match.always == 0); ++stage)
+        {
+            if (pattern.shaders[stage].match.codeHash)
+            {
+                keyStage = stage;
+                break;
+            }
+        }
+
+        if (keyStage < ShaderStageCount)
+        {
+            PipelineProfileHashKey* pKey = &pProfile->pHashKeys[pProfile->hashKeyCount++];
+
+            pKey->codeHash = pattern.shaders[keyStage].codeHash;
+            pKey->stage    = keyStage;
+            pKey->entry    = entry;
+        }
+        else
+        {
+            pProfile->pResidualEntries[pProfile->residualCount++] = entry;
+        }
+    }
+
+    std::sort(pProfile->pHashKeys, pProfile->pHashKeys + pProfile->hashKeyCount, ProfileHashKeyLess);
+
+    return true;
+}
+
 // =====================================================================================================================
 ShaderOptimizer::ShaderOptimizer(
     Device*         pDevice,
@@ -55,6 +289,12 @@ ShaderOptimizer::ShaderOptimizer(
     m_pDevice(pDevice),
     m_settings(pPhysicalDevice->GetRuntimeSettings())
 {
+    memset(&m_appProfile, 0, sizeof(m_appProfile));
+
+#if ICD_RUNTIME_APP_PROFILE
+    memset(&m_runtimeProfile, 0, sizeof(m_runtimeProfile));
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     m_printMutex.Init();
 #endif
@@ -77,39 +317,40 @@ void ShaderOptimizer::ApplyProfileToShaderCreateInfo(
     ShaderStage                      shaderStage,
     Pal::ShaderCreateInfo*           pCreateInfo)
 {
-    for (uint32_t entry = 0; entry < profile.entryCount; ++entry)
-    {
-        const PipelineProfileEntry& profileEntry = profile.entries[entry];
+    PipelineProfileCursor cursor;
+    uint32_t              entry = 0;
 
-        if (ProfilePatternMatchesPipeline(profileEntry.pattern, pipelineKey))
-        {
-            const auto& shaderCreate = profileEntry.action.shaders[static_cast<uint32_t>(shaderStage)].shaderCreate;
+    InitProfileCursor(profile, pipelineKey, &cursor);
 
-            if (shaderCreate.apply.optStrategyFlags)
-            {
-                pCreateInfo->optStrategy.flags = shaderCreate.optStrategyFlags;
-            }
+    while (NextMatchingProfileEntry(profile, pipelineKey, &cursor, &entry))
+    {
+        const PipelineProfileEntry& profileEntry = profile.pEntries[entry];
 
-            if (shaderCreate.apply.vgprLimit)
-            {
-                pCreateInfo->optStrategy.vgprLimit = shaderCreate.vgprLimit;
-            }
+        const auto& shaderCreate = profileEntry.action.shaders[static_cast<uint32_t>(shaderStage)].shaderCreate;
 
-            if (shaderCreate.apply.maxLdsSpillDwords)
-            {
-                pCreateInfo->optStrategy.maxLdsSpillDwords = shaderCreate.maxLdsSpillDwords;
-            }
+        if (shaderCreate.apply.optStrategyFlags)
+        {
+            pCreateInfo->optStrategy.flags = shaderCreate.optStrategyFlags;
+        }
 
-            if (shaderCreate.apply.minVgprStrategyFlags)
-            {
-                pCreateInfo->optStrategy.minVgprStrategyFlags = shaderCreate.minVgprStrategyFlags;
-            }
+        if (shaderCreate.apply.vgprLimit)
+        {
+            pCreateInfo->optStrategy.vgprLimit = shaderCreate.vgprLimit;
+        }
 
-            if (shaderCreate.apply.userDataSpillThreshold)
-            {
-                pCreateInfo->optStrategy.userDataSpillThreshold = shaderCreate.userDataSpillThreshold;
-            }
+        if (shaderCreate.apply.maxLdsSpillDwords)
+        {
+            pCreateInfo->optStrategy.maxLdsSpillDwords = shaderCreate.maxLdsSpillDwords;
+        }
 
+        if (shaderCreate.apply.minVgprStrategyFlags)
+        {
+            pCreateInfo->optStrategy.minVgprStrategyFlags = shaderCreate.minVgprStrategyFlags;
+        }
+
+        if (shaderCreate.apply.userDataSpillThreshold)
+        {
+            pCreateInfo->optStrategy.userDataSpillThreshold = shaderCreate.userDataSpillThreshold;
         }
     }
 }
@@ -156,7 +397,11 @@ void ShaderOptimizer::OverrideComputePipelineCreateInfo(
 // =====================================================================================================================
 ShaderOptimizer::~ShaderOptimizer()
 {
+    DestroyProfile(m_pDevice->VkInstance(), &m_appProfile);
 
+#if ICD_RUNTIME_APP_PROFILE
+    DestroyProfile(m_pDevice->VkInstance(), &m_runtimeProfile);
+#endif
 }
 
 // =====================================================================================================================
@@ -166,31 +411,33 @@ void ShaderOptimizer::ApplyProfileToGraphicsPipelineCreateInfo(
     Pal::GraphicsPipelineCreateInfo* pCreateInfo,
     Pal::DynamicGraphicsShaderInfos* pGraphicsWaveLimitParams)
 {
-    for (uint32_t entry = 0; entry < profile.entryCount; ++entry)
+    PipelineProfileCursor cursor;
+    uint32_t              entry = 0;
+
+    InitProfileCursor(profile, pipelineKey, &cursor);
+
+    while (NextMatchingProfileEntry(profile, pipelineKey, &cursor, &entry))
     {
-        const PipelineProfileEntry& profileEntry = profile.entries[entry];
+        const PipelineProfileEntry& profileEntry = profile.pEntries[entry];
 
-        if (ProfilePatternMatchesPipeline(profileEntry.pattern, pipelineKey))
-        {
-            // Apply parameters to PipelineShaderInfo structs
-            const auto& shaders = profileEntry.action.shaders;
+        // Apply parameters to PipelineShaderInfo structs
+        const auto& shaders = profileEntry.action.shaders;
 
-            // Apply parameters to GraphicsPipelineCreateInfo
-            const auto& createInfo = profileEntry.action.createInfo;
+        // Apply parameters to GraphicsPipelineCreateInfo
+        const auto& createInfo = profileEntry.action.createInfo;
 
-            if (createInfo.apply.lateAllocVsLimit)
-            {
-                pCreateInfo->useLateAllocVsLimit = true;
-                pCreateInfo->lateAllocVsLimit    = createInfo.lateAllocVsLimit;
-            }
+        if (createInfo.apply.lateAllocVsLimit)
+        {
+            pCreateInfo->useLateAllocVsLimit = true;
+            pCreateInfo->lateAllocVsLimit    = createInfo.lateAllocVsLimit;
+        }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
-            if (m_settings.pipelineProfileDbgPrintProfileMatch)
-            {
-                PrintProfileEntryMatch(profile, entry, pipelineKey);
-            }
-#endif
+        if (m_settings.pipelineProfileDbgPrintProfileMatch)
+        {
+            PrintProfileEntryMatch(profile, entry, pipelineKey);
         }
+#endif
     }
 }
 
@@ -210,16 +457,18 @@ void ShaderOptimizer::ApplyProfileToComputePipelineCreateInfo(
     Pal::ComputePipelineCreateInfo*  pCreateInfo,
     Pal::DynamicComputeShaderInfo*   pDynamicComputeShaderInfo)
 {
-    for (uint32_t entry = 0; entry < profile.entryCount; ++entry)
+    PipelineProfileCursor cursor;
+    uint32_t              entry = 0;
+
+    InitProfileCursor(profile, pipelineKey, &cursor);
+
+    while (NextMatchingProfileEntry(profile, pipelineKey, &cursor, &entry))
     {
-        const PipelineProfileEntry& profileEntry = profile.entries[entry];
+        const PipelineProfileEntry& profileEntry = profile.pEntries[entry];
 
-        if (ProfilePatternMatchesPipeline(profileEntry.pattern, pipelineKey))
-        {
-            ApplyProfileToComputePipelineShaderInfo(
-                profileEntry.action.shaders[ShaderStageCompute],
-                pDynamicComputeShaderInfo);
-        }
+        ApplyProfileToComputePipelineShaderInfo(
+            profileEntry.action.shaders[ShaderStageCompute],
+            pDynamicComputeShaderInfo);
     }
 }
 
@@ -273,6 +522,90 @@ bool ShaderOptimizer::ProfilePatternMatchesPipeline(
     return true;
 }
 
+// =====================================================================================================================
+// Prepares a cursor for visiting the entries of the given profile that may match the given pipeline.
+void ShaderOptimizer::InitProfileCursor(
+    const PipelineProfile&      profile,
+    const PipelineOptimizerKey& pipelineKey,
+    PipelineProfileCursor*      pCursor)
+{
+    pCursor->residual = 0;
+
+    for (uint32_t stage = 0; stage < ShaderStageCount; ++stage)
+    {
+        const Pal::ShaderHash& codeHash = pipelineKey.shaders[stage].codeHash;
+
+        uint32_t first = FindFirstProfileHashKey(profile, codeHash, stage);
+        uint32_t last  = first;
+
+        while ((last < profile.hashKeyCount) &&
+               (CompareProfileHashKey(profile.pHashKeys[last].codeHash, profile.pHashKeys[last].stage,
+                                      codeHash, stage) == 0))
+        {
+            last++;
+        }
+
+        pCursor->hashKey[stage]    = first;
+        pCursor->hashKeyEnd[stage] = last;
+    }
+}
+
+// =====================================================================================================================
+// Returns the next entry of the profile whose pattern matches the pipeline.  The candidates are the residual entries
+// and the hash key ranges found by InitProfileCursor(); all of them are sorted by entry index, so merging them visits
+// the matching entries in the same order as a linear scan of the whole profile would.
+bool ShaderOptimizer::NextMatchingProfileEntry(
+    const PipelineProfile&      profile,
+    const PipelineOptimizerKey& pipelineKey,
+    PipelineProfileCursor*      pCursor,
+    uint32_t*                   pEntry)
+{
+    constexpr uint32_t NoSource = ShaderStageCount + 1;
+    constexpr uint32_t Residual = ShaderStageCount;
+
+    while (true)
+    {
+        uint32_t nextEntry  = UINT32_MAX;
+        uint32_t nextSource = NoSource;
+
+        if (pCursor->residual < profile.residualCount)
+        {
+            nextEntry  = profile.pResidualEntries[pCursor->residual];
+            nextSource = Residual;
+        }
+
+        for (uint32_t stage = 0; stage < ShaderStageCount; ++stage)
+        {
+            if ((pCursor->hashKey[stage] < pCursor->hashKeyEnd[stage]) &&
+                (profile.pHashKeys[pCursor->hashKey[stage]].entry < nextEntry))
+            {
+                nextEntry  = profile.pHashKeys[pCursor->hashKey[stage]].entry;
+                nextSource = stage;
+            }
+        }
+
+        if (nextSource == NoSource)
+        {
+            return false;
+        }
+        else if (nextSource == Residual)
+        {
+            pCursor->residual++;
+        }
+        else
+        {
+            pCursor->hashKey[nextSource]++;
+        }
+
+        if (ProfilePatternMatchesPipeline(profile.pEntries[nextEntry].pattern, pipelineKey))
+        {
+            *pEntry = nextEntry;
+
+            return true;
+        }
+    }
+}
+
 // =====================================================================================================================
 void ShaderOptimizer::BuildAppProfile()
 {
@@ -280,7 +613,7 @@ void ShaderOptimizer::BuildAppProfile()
     const Pal::GfxIpLevel gfxIpLevel = m_pDevice->VkPhysicalDevice()->PalProperties().gfxLevel;
 
     // TODO: These need to be auto-generated from source JSON but for now we write profile programmatically
-    memset(&m_appProfile, 0, sizeof(m_appProfile));
+    DestroyProfile(m_pDevice->VkInstance(), &m_appProfile);
 
     // Early-out if the panel has dictated that we should ignore any active pipeline optimizations due to app profile
     if (m_settings.pipelineProfileIgnoresAppProfile)
@@ -293,14 +626,21 @@ void ShaderOptimizer::BuildAppProfile()
         // DOTA 2 has a 4K downsample shader that does nothing but vmem instructions in a loop.  Thread trace view
         // shows latency in those instructions' issuing, presumably because there is some bottleneck between SQ and the
         // TAs.  Limiting waves per CU improves performance of this shader significantly.
-        m_appProfile.entryCount = 1;
+        PipelineProfileEntry* pEntry = AddProfileEntry(m_pDevice->VkInstance(), &m_appProfile);
 
-        m_appProfile.entries[0].pattern.shaders[ShaderStageFragment].match.codeHash      = true;
-        m_appProfile.entries[0].pattern.shaders[ShaderStageFragment].codeHash.upper      = 0x9022c6756bbe4314ULL;
-        m_appProfile.entries[0].pattern.shaders[ShaderStageFragment].codeHash.lower      = 0x1bf99c3524392578ULL;
-        m_appProfile.entries[0].action.shaders[ShaderStageFragment].pipelineShader.apply.maxWavesPerCu = true;
-        m_appProfile.entries[0].action.shaders[ShaderStageFragment].pipelineShader.maxWavesPerCu       = 2;
+        if (pEntry != nullptr)
+        {
+            pEntry->pattern.shaders[ShaderStageFragment].match.codeHash                = true;
+            pEntry->pattern.shaders[ShaderStageFragment].codeHash.upper                = 0x9022c6756bbe4314ULL;
+            pEntry->pattern.shaders[ShaderStageFragment].codeHash.lower                = 0x1bf99c3524392578ULL;
+            pEntry->action.shaders[ShaderStageFragment].pipelineShader.apply.maxWavesPerCu = true;
+            pEntry->action.shaders[ShaderStageFragment].pipelineShader.maxWavesPerCu       = 2;
+        }
     }
+
+    bool success = CompileProfile(m_pDevice->VkInstance(), &m_appProfile);
+
+    VK_ASSERT(success);
 }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -780,6 +1120,7 @@ static bool ParseJsonProfileEntry(
 
 // =====================================================================================================================
 static bool ParseJsonProfile(
+    Instance*        pInstance,
     utils::Json*     pJson,
     PipelineProfile* pProfile)
 {
@@ -795,9 +1136,11 @@ static bool ParseJsonProfile(
         {
             for (utils::Json* pEntry = pEntries->pChild; (pEntry != nullptr) && success; pEntry = pEntry->pNext)
             {
-                if (pProfile->entryCount < MaxPipelineProfileEntries)
+                PipelineProfileEntry* pProfileEntry = AddProfileEntry(pInstance, pProfile);
+
+                if (pProfileEntry != nullptr)
                 {
-                    success &= ParseJsonProfileEntry(pPatterns, pActions, pEntry, &pProfile->entries[pProfile->entryCount++]);
+                    success &= ParseJsonProfileEntry(pPatterns, pActions, pEntry, pProfileEntry);
                 }
                 else
                 {
@@ -814,12 +1157,234 @@ static bool ParseJsonProfile(
     return success;
 }
 
+// Header of the compiled runtime profile file.  The file is followed by the entries, the sorted hash key table and the
+// residual entry list, stored exactly as in memory.
+struct PipelineProfileCacheHeader
+{
+    uint32_t magic;          // Must be PipelineProfileCacheMagic
+    uint32_t version;        // Must be PipelineProfileCacheVersion
+    uint64_t driverHash;     // GetProfileDriverHash() of the driver that wrote the file
+    uint32_t entryCount;
+    uint32_t hashKeyCount;
+    uint32_t residualCount;
+    uint32_t reserved;
+    uint64_t sourceSize;     // Size of the JSON file the profile was compiled from
+    uint64_t sourceHash;     // Hash of the JSON file contents
+};
+
+constexpr uint32_t PipelineProfileCacheMagic   = 0x50504B56; // "VKPP"
+constexpr uint32_t PipelineProfileCacheVersion = 2;
+
+// =====================================================================================================================
+// Returns the 64-bit FNV-1a hash of the given data.  Used to detect a stale compiled profile.
+static uint64_t HashProfileSource(
+    const void* pData,
+    size_t      dataSize)
+{
+    const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+    uint64_t       hash   = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < dataSize; ++i)
+    {
+        hash ^= pBytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// =====================================================================================================================
+// Returns a hash identifying the driver build and the in-memory layout of the profile structures.  The compiled profile
+// stores these structures verbatim, so a file written by any other build must not be trusted.
+static uint64_t GetProfileDriverHash()
+{
+    static const char BuildId[] = __DATE__ " " __TIME__;
+
+    const uint32_t layout[] =
+    {
+        VULKAN_ICD_MAJOR_VERSION,
+        VULKAN_ICD_BUILD_VERSION,
+        PAL_INTERFACE_MAJOR_VERSION,
+        PAL_INTERFACE_MINOR_VERSION,
+        ShaderStageCount,
+        sizeof(ShaderProfilePattern),
+        sizeof(ShaderProfileAction),
+        sizeof(PipelineProfilePattern),
+        sizeof(PipelineProfileAction),
+        sizeof(PipelineProfileEntry),
+        sizeof(PipelineProfileHashKey),
+    };
+
+    return HashProfileSource(BuildId, sizeof(BuildId)) ^ HashProfileSource(layout, sizeof(layout));
+}
+
+// =====================================================================================================================
+// Checks that the hash key table and the residual entry list of a loaded profile only refer to existing entries and
+// are sorted the way the lookup expects.
+static bool ValidateCompiledProfile(
+    const PipelineProfile& profile)
+{
+    bool valid = true;
+
+    for (uint32_t i = 0; (i < profile.hashKeyCount) && valid; ++i)
+    {
+        const PipelineProfileHashKey& key = profile.pHashKeys[i];
+
+        valid = (key.entry < profile.entryCount) && (key.stage < ShaderStageCount);
+
+        if (valid && (i > 0))
+        {
+            valid = (ProfileHashKeyLess(key, profile.pHashKeys[i - 1]) == false);
+        }
+    }
+
+    for (uint32_t i = 0; (i < profile.residualCount) && valid; ++i)
+    {
+        valid = (profile.pResidualEntries[i] < profile.entryCount) &&
+                ((i == 0) || (profile.pResidualEntries[i - 1] < profile.pResidualEntries[i]));
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Reads a compiled profile previously written by StoreCompiledProfile().  Fails if the file does not exist, was
+// written by a different driver build, was compiled from a different JSON file, or is inconsistent.
+static bool LoadCompiledProfile(
+    Instance*        pInstance,
+    const char*      pFileName,
+    uint64_t         sourceSize,
+    uint64_t         sourceHash,
+    PipelineProfile* pProfile)
+{
+    Util::File file;
+    bool       success = false;
+
+    if (file.Open(pFileName, Util::FileAccessRead | Util::FileAccessBinary) == Pal::Result::Success)
+    {
+        PipelineProfileCacheHeader header = {};
+        size_t                     bytesRead = 0;
+
+        file.Read(&header, sizeof(header), &bytesRead);
+
+        success = (bytesRead         == sizeof(header))               &&
+                  (header.magic      == PipelineProfileCacheMagic)    &&
+                  (header.version    == PipelineProfileCacheVersion)  &&
+                  (header.driverHash == GetProfileDriverHash())       &&
+                  (header.sourceSize == sourceSize)                   &&
+                  (header.sourceHash == sourceHash)                   &&
+                  (header.hashKeyCount <= header.entryCount)          &&
+                  ((header.hashKeyCount + header.residualCount) == header.entryCount);
+
+        const size_t entriesSize  = header.entryCount    * sizeof(PipelineProfileEntry);
+        const size_t hashKeysSize = header.hashKeyCount  * sizeof(PipelineProfileHashKey);
+        const size_t residualSize = header.residualCount * sizeof(uint32_t);
+
+        if (success && (header.entryCount > 0))
+        {
+            pProfile->pEntries = static_cast<PipelineProfileEntry*>(
+                pInstance->AllocMem(entriesSize, VK_DEFAULT_MEM_ALIGN, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+
+            pProfile->entryCapacity = header.entryCount;
+
+            success = (pProfile->pEntries != nullptr) &&
+                      (file.Read(pProfile->pEntries, entriesSize, &bytesRead) == Pal::Result::Success) &&
+                      (bytesRead == entriesSize);
+
+            pProfile->entryCount = header.entryCount;
+        }
+
+        if (success && (header.hashKeyCount > 0))
+        {
+            pProfile->pHashKeys = static_cast<PipelineProfileHashKey*>(
+                pInstance->AllocMem(hashKeysSize, VK_DEFAULT_MEM_ALIGN, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+
+            success = (pProfile->pHashKeys != nullptr) &&
+                      (file.Read(pProfile->pHashKeys, hashKeysSize, &bytesRead) == Pal::Result::Success) &&
+                      (bytesRead == hashKeysSize);
+
+            pProfile->hashKeyCount = header.hashKeyCount;
+        }
+
+        if (success && (header.residualCount > 0))
+        {
+            pProfile->pResidualEntries = static_cast<uint32_t*>(
+                pInstance->AllocMem(residualSize, VK_DEFAULT_MEM_ALIGN, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+
+            success = (pProfile->pResidualEntries != nullptr) &&
+                      (file.Read(pProfile->pResidualEntries, residualSize, &bytesRead) == Pal::Result::Success) &&
+                      (bytesRead == residualSize);
+
+            pProfile->residualCount = header.residualCount;
+        }
+
+        success = success && ValidateCompiledProfile(*pProfile);
+
+        file.Close();
+
+        if (success == false)
+        {
+            DestroyProfile(pInstance, pProfile);
+        }
+    }
+
+    return success;
+}
+
+// =====================================================================================================================
+// Writes a compiled profile so that later runs can skip parsing and compiling the JSON file it was built from.
+static void StoreCompiledProfile(
+    const char*            pFileName,
+    uint64_t               sourceSize,
+    uint64_t               sourceHash,
+    const PipelineProfile& profile)
+{
+    Util::File file;
+
+    if (file.Open(pFileName, Util::FileAccessWrite | Util::FileAccessBinary) == Pal::Result::Success)
+    {
+        PipelineProfileCacheHeader header = {};
+
+        header.magic         = PipelineProfileCacheMagic;
+        header.version       = PipelineProfileCacheVersion;
+        header.driverHash    = GetProfileDriverHash();
+        header.entryCount    = profile.entryCount;
+        header.hashKeyCount  = profile.hashKeyCount;
+        header.residualCount = profile.residualCount;
+        header.sourceSize    = sourceSize;
+        header.sourceHash    = sourceHash;
+
+        file.Write(&header, sizeof(header));
+
+        if (profile.entryCount > 0)
+        {
+            file.Write(profile.pEntries, profile.entryCount * sizeof(PipelineProfileEntry));
+        }
+
+        if (profile.hashKeyCount > 0)
+        {
+            file.Write(profile.pHashKeys, profile.hashKeyCount * sizeof(PipelineProfileHashKey));
+        }
+
+        if (profile.residualCount > 0)
+        {
+            file.Write(profile.pResidualEntries, profile.residualCount * sizeof(uint32_t));
+        }
+
+        file.Close();
+    }
+}
+
 // =====================================================================================================================
+// Builds the runtime profile from the JSON file named by the PipelineProfileRuntimeFile setting.  The compiled profile
+// is cached in a binary file next to the JSON file (with a ".bin" suffix) and reused as long as the JSON is unchanged.
 void ShaderOptimizer::BuildRuntimeProfile()
 {
-    memset(&m_runtimeProfile, 0, sizeof(m_runtimeProfile));
+    Instance* pInstance = m_pDevice->VkInstance();
+
+    DestroyProfile(pInstance, &m_runtimeProfile);
 
-    utils::JsonSettings jsonSettings = utils::JsonMakeInstanceSettings(m_pDevice->VkInstance());
+    utils::JsonSettings jsonSettings = utils::JsonMakeInstanceSettings(pInstance);
     utils::Json* pJson               = nullptr;
 
     if (m_settings.pipelineProfileRuntimeFile[0] != '\0')
@@ -830,7 +1395,7 @@ void ShaderOptimizer::BuildRuntimeProfile()
         {
             size_t size = jsonFile.GetFileSize(m_settings.pipelineProfileRuntimeFile);
 
-            void* pJsonBuffer = m_pDevice->VkInstance()->AllocMem(size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+            void* pJsonBuffer = pInstance->AllocMem(size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
 
             if (pJsonBuffer != nullptr)
             {
@@ -838,22 +1403,42 @@ void ShaderOptimizer::BuildRuntimeProfile()
 
                 jsonFile.Read(pJsonBuffer, size, &bytesRead);
 
-                pJson = utils::JsonParse(jsonSettings, pJsonBuffer, bytesRead);
+                const uint64_t sourceHash = HashProfileSource(pJsonBuffer, bytesRead);
 
-                m_pDevice->VkInstance()->FreeMem(pJsonBuffer);
-            }
+                char compiledFileName[sizeof(m_settings.pipelineProfileRuntimeFile) + 8];
 
-            jsonFile.Close();
-        }
-    }
+                Util::Snprintf(compiledFileName, sizeof(compiledFileName), "%s.bin",
+                               m_settings.pipelineProfileRuntimeFile);
 
-    if (pJson != nullptr)
-    {
-        bool success = ParseJsonProfile(pJson, &m_runtimeProfile);
+                if (LoadCompiledProfile(pInstance, compiledFileName, bytesRead, sourceHash, &m_runtimeProfile) == false)
+                {
+                    pJson = utils::JsonParse(jsonSettings, pJsonBuffer, bytesRead);
+
+                    if (pJson != nullptr)
+                    {
+                        bool success = ParseJsonProfile(pInstance, pJson, &m_runtimeProfile);
 
-        VK_ASSERT(success);
+                        VK_ASSERT(success);
 
-        utils::JsonDestroy(jsonSettings, pJson);
+                        // Whatever was parsed is still used, but only a fully parsed profile is cached
+                        success &= CompileProfile(pInstance, &m_runtimeProfile);
+
+                        VK_ASSERT(success);
+
+                        if (success)
+                        {
+                            StoreCompiledProfile(compiledFileName, bytesRead, sourceHash, m_runtimeProfile);
+                        }
+
+                        utils::JsonDestroy(jsonSettings, pJson);
+                    }
+                }
+
+                pInstance->FreeMem(pJsonBuffer);
+            }
+
+            jsonFile.Close();
+        }
     }
 }
 #endif
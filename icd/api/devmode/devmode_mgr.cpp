@@ -44,8 +44,10 @@
 
 // PAL headers
 #include "palCmdAllocator.h"
+#include "palFile.h"
 #include "palFence.h"
 #include "palQueueSemaphore.h"
+#include "palSysUtil.h"
 
 // gpuutil headers
 #include "gpuUtil/palGpaSession.h"
@@ -57,6 +59,8 @@
 #include "protocols/rgpServer.h"
 #include "protocols/driverControlServer.h"
 
+#include <climits>
+
 namespace vk
 {
 
@@ -151,6 +155,11 @@ Pal::Result DevModeMgr::Init()
 {
     Pal::Result result = m_traceMutex.Init();
 
+    if (result == Pal::Result::Success)
+    {
+        result = m_feedbackMutex.Init();
+    }
+
     // Tell RGP that the server (i.e. the driver) supports tracing if requested.
     if (result == Pal::Result::Success)
     {
@@ -1726,8 +1735,6 @@ Pal::Result DevModeMgr::TimedQueueSubmit(
     const Pal::SubmitInfo&       submitInfo,
     VirtualStackFrame*           pVirtStackFrame)
 {
-    VK_ASSERT(cmdBufferCount == submitInfo.cmdBufferCount);
-
     bool timingSupported = QueueSupportsTiming(deviceIdx, pQueue) && (submitInfo.cmdBufferCount > 0);
 
     // Fill in extra meta-data information to associate the API command buffer data with the generated
@@ -1738,8 +1745,8 @@ Pal::Result DevModeMgr::TimedQueueSubmit(
 
     if (timingSupported)
     {
-        pApiCmdBufIds  = pVirtStackFrame->AllocArray<Pal::uint64>(cmdBufferCount);
-        pSqttCmdBufIds = pVirtStackFrame->AllocArray<Pal::uint32>(cmdBufferCount);
+        pApiCmdBufIds  = pVirtStackFrame->AllocArray<Pal::uint64>(submitInfo.cmdBufferCount);
+        pSqttCmdBufIds = pVirtStackFrame->AllocArray<Pal::uint32>(submitInfo.cmdBufferCount);
 
         timedSubmitInfo.pApiCmdBufIds  = pApiCmdBufIds;
         timedSubmitInfo.pSqttCmdBufIds = pSqttCmdBufIds;
@@ -1754,22 +1761,32 @@ Pal::Result DevModeMgr::TimedQueueSubmit(
 
     if (timingSupported)
     {
-        for (uint32_t cbIdx = 0; cbIdx < cmdBufferCount; ++cbIdx)
+        uint32_t apiIdx = 0;
+
+        for (uint32_t cbIdx = 0; cbIdx < submitInfo.cmdBufferCount; ++cbIdx)
         {
-            uintptr_t intHandle = reinterpret_cast<uintptr_t>(pCommandBuffers[cbIdx]);
+            pApiCmdBufIds[cbIdx]  = 0;
+            pSqttCmdBufIds[cbIdx] = 0;
 
-            pApiCmdBufIds[cbIdx] = intHandle;
+            // Internal command buffers of the queue have no API command buffer to associate the timing data with
+            for (uint32_t searchIdx = apiIdx; searchIdx < cmdBufferCount; ++searchIdx)
+            {
+                CmdBuffer* pCmdBuf = ApiCmdBuffer::ObjectFromHandle(pCommandBuffers[searchIdx]);
 
-            CmdBuffer* pCmdBuf = ApiCmdBuffer::ObjectFromHandle(pCommandBuffers[cbIdx]);
+                if (pCmdBuf->PalCmdBuffer(deviceIdx) == submitInfo.ppCmdBuffers[cbIdx])
+                {
+                    pApiCmdBufIds[cbIdx] = reinterpret_cast<uintptr_t>(pCommandBuffers[searchIdx]);
 
-            pSqttCmdBufIds[cbIdx] = 0;
+                    if (pCmdBuf->GetSqttState() != nullptr)
+                    {
+                        pSqttCmdBufIds[cbIdx] = pCmdBuf->GetSqttState()->GetId().u32All;
+                    }
 
-            if (pCmdBuf->GetSqttState() != nullptr)
-            {
-                pSqttCmdBufIds[cbIdx] = pCmdBuf->GetSqttState()->GetId().u32All;
-            }
+                    apiIdx = searchIdx + 1;
 
-            VK_ASSERT(pCmdBuf->PalCmdBuffer() == submitInfo.ppCmdBuffers[cbIdx]);
+                    break;
+                }
+            }
         }
 
         // Do a timed submit of all the command buffers
@@ -1809,6 +1826,75 @@ void DevModeMgr::PipelineCreated(
     {
         m_trace.pGpaSession->RegisterPipeline(pPipeline->PalPipeline());
     }
+
+    if (pDevice->GetRuntimeSettings().devModePipelineFeedbackEnable)
+    {
+        ReportPipelineFeedback(pDevice, pPipeline);
+    }
+}
+
+// =====================================================================================================================
+// Appends the creation feedback of a newly created pipeline to the pipeline feedback log as a set of key=value records:
+// one for the pipeline as a whole followed by one per compiled shader stage.
+void DevModeMgr::ReportPipelineFeedback(
+    const Device*   pDevice,
+    const Pipeline* pPipeline)
+{
+    static const char* StageNames[ShaderStageCount] = { "VS", "HS", "DS", "GS", "PS", "CS" };
+
+    const PipelineCreationFeedback& feedback = pPipeline->GetCreationFeedback();
+
+    if (feedback.pipeline.valid)
+    {
+        char  executableNameBuffer[PATH_MAX];
+        char* pExecutableName = nullptr;
+
+        if (Util::GetExecutableName(&executableNameBuffer[0], &pExecutableName, sizeof(executableNameBuffer)) !=
+            Pal::Result::Success)
+        {
+            pExecutableName = nullptr;
+        }
+
+        char fileName[512];
+
+        Util::Snprintf(fileName, sizeof(fileName), "%s/PipelineFeedback_%s.txt",
+            pDevice->GetRuntimeSettings().devModePipelineFeedbackLogDir,
+            (pExecutableName != nullptr) ? pExecutableName : "unknown");
+
+        // Pipelines may be created concurrently
+        Util::MutexAuto lock(&m_feedbackMutex);
+
+        Util::File file;
+
+        if (file.Open(fileName, Util::FileAccessAppend) == Pal::Result::Success)
+        {
+            file.Printf("PipelineFeedback: pipeline=%p cacheHit=%u durationUs=%llu\n",
+                pPipeline,
+                feedback.pipeline.cacheHit,
+                feedback.pipeline.durationUs);
+
+            for (uint32_t stage = 0; stage < ShaderStageCount; ++stage)
+            {
+                const Llpc::PipelineBuildFeedback& stageFeedback = feedback.stages[stage];
+
+                if (stageFeedback.valid)
+                {
+                    file.Printf("PipelineFeedback: pipeline=%p stage=%s cacheHit=%u durationUs=%llu translateUs=%u "
+                        "lowerUs=%u patchUs=%u codeGenUs=%u\n",
+                        pPipeline,
+                        StageNames[stage],
+                        stageFeedback.cacheHit,
+                        stageFeedback.durationUs,
+                        stageFeedback.phaseTimeUs.translateTime,
+                        stageFeedback.phaseTimeUs.lowerTime,
+                        stageFeedback.phaseTimeUs.patchTime,
+                        stageFeedback.phaseTimeUs.codeGenTime);
+                }
+            }
+
+            file.Close();
+        }
+    }
 }
 
 }; // namespace vk
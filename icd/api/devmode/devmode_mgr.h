@@ -244,10 +244,12 @@ private:
     Pal::Result CheckForTraceResults(TraceState* pState);
     bool QueueSupportsTiming(uint32_t deviceIdx, const Queue* pQueue);
     static bool GpuSupportsTracing(const Pal::DeviceProperties& props, const RuntimeSettings& settings);
+    void ReportPipelineFeedback(const Device* pDevice, const Pipeline* pPipeline);
 
     Instance*                   m_pInstance;
     DevDriver::DevDriverServer* m_pDevDriverServer;
     Util::Mutex                 m_traceMutex;
+    Util::Mutex                 m_feedbackMutex;            // Serializes writes to the pipeline feedback log
     TraceState                  m_trace;
     bool                        m_hardwareSupportsTracing;  // True if gfxip supports tracing
     bool                        m_rgpServerSupportsTracing; // True if gpuopen protocol successfully enabled tracing
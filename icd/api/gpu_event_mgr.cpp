@@ -46,7 +46,10 @@ GpuEventMgr::GpuEventMgr(Device* pDevice)
     :
     m_parentNode(this),
     m_pFirstChunk(nullptr),
-    m_needWaitRecycleEvents(false),
+    m_pLastChunk(nullptr),
+    m_pCurChunk(nullptr),
+    m_multiSubmit(false),
+    m_eventsInUse(false),
     m_pDevice(pDevice),
     m_totalEventCount(0)
 {
@@ -65,10 +68,12 @@ void GpuEventMgr::BeginCmdBuf(
     CmdBuffer*                     pOwner,
     const Pal::CmdBufferBuildInfo& info)
 {
-    // If this command buffer can be submitted multiple times, we need to make sure that we wait on its previous
-    // incarnation to complete before allowing any events to be accessed.  This is because we need to make sure nothing
-    // signals these events while the GPU is still accessing this command buffer.
-    m_needWaitRecycleEvents = (info.flags.optimizeOneTimeSubmit == false);
+    // If this command buffer can be submitted multiple times, a later execution of it must not reset its events while
+    // a previous execution may still signal them.  This is no longer handled by a barrier recorded into the command
+    // buffer: the queue tracks the completion of each submission and only waits for the previous execution when it
+    // could still be in flight when the command buffer is submitted again (see Queue::Submit()).
+    m_multiSubmit = (info.flags.optimizeOneTimeSubmit == false);
+    m_eventsInUse = false;
 }
 
 // =====================================================================================================================
@@ -90,6 +95,9 @@ void GpuEventMgr::ResetEvents()
         pChunk->eventNextFree = 0;
         pChunk = pChunk->pNextChunk;
     }
+
+    m_pCurChunk   = m_pFirstChunk;
+    m_eventsInUse = false;
 }
 
 // =====================================================================================================================
@@ -119,6 +127,8 @@ void GpuEventMgr::Destroy()
     }
 
     m_pFirstChunk = nullptr;
+    m_pLastChunk  = nullptr;
+    m_pCurChunk   = nullptr;
     m_totalEventCount = 0;
 }
 
@@ -168,11 +178,6 @@ VkResult GpuEventMgr::RequestEvents(
     VK_ASSERT(deviceProps.engineProperties[engineType].engineCount == 1);
 #endif
 
-    if (m_needWaitRecycleEvents)
-    {
-        WaitToRecycleEvents(pCmdBuf);
-    }
-
     VkResult result = VK_SUCCESS;
 
     EventChunk* pChunk = FindFreeExistingChunk(eventCount);
@@ -193,19 +198,19 @@ VkResult GpuEventMgr::RequestEvents(
 }
 
 // =====================================================================================================================
-// Tries to find enough space in an existing batch of GPU events.
+// Tries to find enough space in an existing batch of GPU events.  Events are handed out from the chunks in list order,
+// so the search starts at the current chunk and typically finishes there; remaining events of a skipped chunk are only
+// reused after the next reset.
 GpuEventMgr::EventChunk* GpuEventMgr::FindFreeExistingChunk(uint32_t eventCount)
 {
-    EventChunk* pChunk = m_pFirstChunk;
-
-    while (pChunk != nullptr)
+    while (m_pCurChunk != nullptr)
     {
-        if (pChunk->eventCount - pChunk->eventNextFree >= eventCount)
+        if (m_pCurChunk->eventCount - m_pCurChunk->eventNextFree >= eventCount)
         {
-            return pChunk;
+            return m_pCurChunk;
         }
 
-        pChunk = pChunk->pNextChunk;
+        m_pCurChunk = m_pCurChunk->pNextChunk;
     }
 
     return nullptr;
@@ -226,9 +231,9 @@ void GpuEventMgr::AllocEventsFromChunk(
     VK_ASSERT(pChunk->eventNextFree <= pChunk->eventCount);
 
     // Reset the event status
-    // Note that the top of pipe reset below is okay because any previous reads have already been taken care of by the
-    // insertion of the inter-submit barrier
-    VK_ASSERT(m_needWaitRecycleEvents == false);
+    // Note that the top of pipe reset below is okay because any previous access by an earlier execution of this command
+    // buffer is waited for by the queue before it is executed again (see Queue::Submit()).
+    m_eventsInUse = true;
 
     for (uint32_t i = 0; i < eventCount; ++i)
     {
@@ -257,8 +262,17 @@ VkResult GpuEventMgr::CreateNewChunk(
 
     if (pChunk != nullptr)
     {
-        pChunk->pNextChunk = m_pFirstChunk;
-        m_pFirstChunk = pChunk;
+        if (m_pLastChunk != nullptr)
+        {
+            m_pLastChunk->pNextChunk = pChunk;
+        }
+        else
+        {
+            m_pFirstChunk = pChunk;
+        }
+
+        m_pLastChunk = pChunk;
+        m_pCurChunk  = pChunk;
 
         m_totalEventCount += pChunk->eventCount;
 
@@ -364,25 +378,4 @@ GpuEventMgr::EventChunk* GpuEventMgr::CreateChunkState(uint32_t eventCount)
     }
 }
 
-// =====================================================================================================================
-// Waits for any previous access to all events to finish.
-void GpuEventMgr::WaitToRecycleEvents(CmdBuffer* pCmdBuf)
-{
-    Pal::BarrierInfo barrier = {};
-    Pal::HwPipePoint signalPoint = Pal::HwPipeTop;
-
-    barrier.flags.u32All          = 0;
-    barrier.waitPoint             = Pal::HwPipeTop;
-    barrier.pipePointWaitCount    = 1;
-    barrier.pPipePoints           = &signalPoint;
-    barrier.pSplitBarrierGpuEvent = nullptr;
-
-    for (uint32_t deviceIdx = 0; deviceIdx < m_pDevice->NumPalDevices(); deviceIdx++)
-    {
-        pCmdBuf->PalCmdBuffer(deviceIdx)->CmdBarrier(barrier);
-    }
-
-    m_needWaitRecycleEvents = false;
-}
-
 };
@@ -180,14 +180,38 @@ struct PipelineProfileEntry
     PipelineProfileAction action;
 };
 
-constexpr uint32_t MaxPipelineProfileEntries = 32;
+// Index record of a profile entry whose pattern tests the code hash of at least one stage.  Each such entry is indexed
+// exactly once, under the first stage that has a code hash test.
+struct PipelineProfileHashKey
+{
+    Pal::ShaderHash codeHash;  // Code hash tested by the entry's pattern
+    uint32_t        stage;     // Shader stage of the above hash
+    uint32_t        entry;     // Index of the profile entry
+};
 
 // Describes a collection of entries that can be used to apply application-specific shader compilation tuning
 // to different classes of shaders.
+//
+// Profiles are compiled once after they are built: entries with a code hash test are looked up through the sorted
+// hash key table by binary search, and only the remaining (residual) entries are tested against every pipeline.
 struct PipelineProfile
 {
-    uint32_t              entryCount;
-    PipelineProfileEntry  entries[MaxPipelineProfileEntries];
+    uint32_t                entryCount;
+    uint32_t                entryCapacity;
+    PipelineProfileEntry*   pEntries;
+
+    uint32_t                hashKeyCount;
+    PipelineProfileHashKey* pHashKeys;         // Sorted by code hash, stage and then entry index
+    uint32_t                residualCount;
+    uint32_t*               pResidualEntries;  // Entries without any code hash test, in increasing order
+};
+
+// Iteration state used to visit the candidate entries of a profile for a given pipeline in entry order.
+struct PipelineProfileCursor
+{
+    uint32_t residual;                    // Next position in the residual entry list
+    uint32_t hashKey[ShaderStageCount];   // Next position in the hash key table for each stage
+    uint32_t hashKeyEnd[ShaderStageCount];
 };
 
 // =====================================================================================================================
@@ -254,6 +278,17 @@ private:
         const PipelineProfilePattern& pattern,
         const PipelineOptimizerKey&   pipelineKey);
 
+    void InitProfileCursor(
+        const PipelineProfile&      profile,
+        const PipelineOptimizerKey& pipelineKey,
+        PipelineProfileCursor*      pCursor);
+
+    bool NextMatchingProfileEntry(
+        const PipelineProfile&      profile,
+        const PipelineOptimizerKey& pipelineKey,
+        PipelineProfileCursor*      pCursor,
+        uint32_t*                   pEntry);
+
     void BuildAppProfile();
 
 #if ICD_RUNTIME_APP_PROFILE
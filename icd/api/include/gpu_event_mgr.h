@@ -99,6 +99,10 @@ public:
     void     ResetEvents();
     void     Destroy();
 
+    // Returns true if events handed out during the current recording may still be accessed by a previous execution of
+    // the same recording when the owning command buffer is submitted again.
+    bool NeedRecycleWaitOnResubmit() const { return m_multiSubmit && m_eventsInUse; }
+
     List::Node* ListNode() { return &m_parentNode; }
 
 protected:
@@ -122,11 +126,13 @@ protected:
                             uint32_t eventCount,
                             EventChunk* pChunk,
                             GpuEvents*** ppGpuEvents);
-    void        WaitToRecycleEvents(CmdBuffer* pCmdBuf);
 
     List::Node    m_parentNode;             // Intrusive list parent node
     EventChunk*   m_pFirstChunk;            // Linked list of event chunks
-    bool          m_needWaitRecycleEvents;  // True if we still need to wait for previous access to events to complete
+    EventChunk*   m_pLastChunk;             // Last chunk of the linked list, new chunks are appended here
+    EventChunk*   m_pCurChunk;              // Chunk events are currently allocated from.  Chunks before it are full.
+    bool          m_multiSubmit;            // True if the owning command buffer can be submitted multiple times
+    bool          m_eventsInUse;            // True if any events have been handed out during the current recording
     Device* const m_pDevice;                // Device pointer
     uint32_t      m_totalEventCount;        // Total number of GPU event objects created so far
 };
@@ -119,6 +119,8 @@ struct InternalMemoryPool
                                                          // TODO. Match VA addresses across devices where available
     Util::BuddyAllocator<PalAllocator>* pBuddyAllocator; // Buddy allocator used to sub-allocate
                                                          // from the pool
+    Util::Mutex*                        pLock;           // Lock of the pool list owning this pool, which guards
+                                                         // its buddy allocator (null for base allocations)
 };
 
 // =====================================================================================================================
@@ -220,7 +222,21 @@ public:
     VkResult CalcSubAllocationPool(const MemoryPoolProperties& poolProps, void** ppPoolInfo);
 
 private:
-    typedef Util::List<InternalMemoryPool, PalAllocator>                        MemoryPoolList;
+    // List of memory pools with identical properties.  Each list has its own lock so that sub-allocations with
+    // different properties (e.g. descriptor tables and query pool memory) do not serialize each other.
+    //
+    // NOTE: Sub-allocations are not cached per thread.  Internal memory is routinely freed on a different thread than
+    // the one that allocated it (e.g. descriptor and query pools destroyed by another thread), so the cache of the
+    // freeing thread would fill up with blocks it never allocates again.  The blocks held by a cache could also only be
+    // given back to the buddy allocators by the owning thread, which keeps pools from being released until it exits.
+    struct MemoryPoolList
+    {
+        MemoryPoolList(PalAllocator* pAllocator) : pools(pAllocator) { }
+
+        Util::Mutex                                   lock;  // Guards the list and the buddy allocators of its pools
+        Util::List<InternalMemoryPool, PalAllocator>  pools; // Memory pools to sub-allocate from
+    };
+
     typedef Util::HashMap<MemoryPoolProperties, MemoryPoolList*, PalAllocator>  MemoryPoolListMap;
 
     VkResult CalcSubAllocationPoolInternal(
@@ -252,7 +268,7 @@ private:
     Pal::GpuMemoryHeapProperties m_heapProps[Pal::GpuHeapCount]; // Information about the memory heaps
 
     PalAllocator*       m_pSysMemAllocator; // Allocator object for system-memory allocations
-    Util::Mutex         m_allocatorLock;    // Serialize access to the memory manager to ensure thread-safety
+    Util::Mutex         m_allocatorLock;    // Serializes access to the pool list map
     MemoryPoolListMap   m_poolListMap;      // Maintain a hash map of memory pool lists for each property combination
 
     MemoryPoolProperties m_commonPoolProps[InternalPoolCount]; // Commonly used pool properties
@@ -0,0 +1,104 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_ext_conditional_rendering.h
+ * @brief Header for VK_EXT_conditional_rendering extension.  This extension allows the execution of draws, dispatches
+ *        and attachment clears to be predicated on a 32-bit value stored in a buffer.
+ **********************************************************************************************************************
+ */
+#ifndef VK_EXT_CONDITIONAL_RENDERING_H_
+#define VK_EXT_CONDITIONAL_RENDERING_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_EXT_conditional_rendering 1
+#define VK_EXT_CONDITIONAL_RENDERING_SPEC_VERSION       1
+#define VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME     "VK_EXT_conditional_rendering"
+
+#define VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NUMBER   82
+
+#define VK_EXT_CONDITIONAL_RENDERING_ENUM(type, offset) \
+    VK_EXTENSION_ENUM(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NUMBER, type, offset)
+
+typedef enum VkConditionalRenderingFlagBitsEXT
+{
+    VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT           = 0x00000001,
+    VK_CONDITIONAL_RENDERING_FLAG_BITS_MAX_ENUM_EXT     = 0x7FFFFFFF
+} VkConditionalRenderingFlagBitsEXT;
+
+typedef VkFlags VkConditionalRenderingFlagsEXT;
+
+typedef struct VkConditionalRenderingBeginInfoEXT
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkBuffer                             buffer;
+    VkDeviceSize                         offset;
+    VkConditionalRenderingFlagsEXT       flags;
+} VkConditionalRenderingBeginInfoEXT;
+
+typedef struct VkCommandBufferInheritanceConditionalRenderingInfoEXT
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkBool32                             conditionalRenderingEnable;
+} VkCommandBufferInheritanceConditionalRenderingInfoEXT;
+
+typedef struct VkPhysicalDeviceConditionalRenderingFeaturesEXT
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    VkBool32                             conditionalRendering;
+    VkBool32                             inheritedConditionalRendering;
+} VkPhysicalDeviceConditionalRenderingFeaturesEXT;
+
+#define VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT \
+    VK_EXT_CONDITIONAL_RENDERING_ENUM(VkStructureType, 0)
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT \
+    VK_EXT_CONDITIONAL_RENDERING_ENUM(VkStructureType, 1)
+#define VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT \
+    VK_EXT_CONDITIONAL_RENDERING_ENUM(VkStructureType, 2)
+
+#define VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT \
+    VK_EXTENSION_BIT(VkAccessFlagBits, 20)
+#define VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT \
+    VK_EXTENSION_BIT(VkBufferUsageFlagBits, 9)
+#define VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT \
+    VK_EXTENSION_BIT(VkPipelineStageFlagBits, 18)
+
+typedef void (VKAPI_PTR *PFN_vkCmdBeginConditionalRenderingEXT)(
+    VkCommandBuffer                             commandBuffer,
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin);
+
+typedef void (VKAPI_PTR *PFN_vkCmdEndConditionalRenderingEXT)(
+    VkCommandBuffer                             commandBuffer);
+
+#endif /* VK_EXT_CONDITIONAL_RENDERING_H_ */
@@ -0,0 +1,159 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_ext_descriptor_indexing.h
+ * @brief Header for VK_EXT_descriptor_indexing extension.  This extension allows for update-after-bind and partially
+ *        bound descriptor sets, variable sized bindings and non-uniform indexing of descriptor arrays in shaders.
+ **********************************************************************************************************************
+ */
+#ifndef VK_EXT_DESCRIPTOR_INDEXING_H_
+#define VK_EXT_DESCRIPTOR_INDEXING_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_EXT_DESCRIPTOR_INDEXING_SPEC_VERSION          2
+#define VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME        "VK_EXT_descriptor_indexing"
+
+#define VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NUMBER      162
+
+#define VK_EXT_DESCRIPTOR_INDEXING_ENUM(type, offset) \
+    VK_EXTENSION_ENUM(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NUMBER, type, offset)
+
+typedef enum VkDescriptorBindingFlagBitsEXT
+{
+    VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT           = 0x00000001,
+    VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT = 0x00000002,
+    VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT             = 0x00000004,
+    VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT   = 0x00000008,
+    VK_DESCRIPTOR_BINDING_FLAG_BITS_MAX_ENUM_EXT              = 0x7FFFFFFF
+} VkDescriptorBindingFlagBitsEXT;
+
+typedef VkFlags VkDescriptorBindingFlagsEXT;
+
+typedef struct VkDescriptorSetLayoutBindingFlagsCreateInfoEXT
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    uint32_t                             bindingCount;
+    const VkDescriptorBindingFlagsEXT*   pBindingFlags;
+} VkDescriptorSetLayoutBindingFlagsCreateInfoEXT;
+
+typedef struct VkPhysicalDeviceDescriptorIndexingFeaturesEXT
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    VkBool32                             shaderInputAttachmentArrayDynamicIndexing;
+    VkBool32                             shaderUniformTexelBufferArrayDynamicIndexing;
+    VkBool32                             shaderStorageTexelBufferArrayDynamicIndexing;
+    VkBool32                             shaderUniformBufferArrayNonUniformIndexing;
+    VkBool32                             shaderSampledImageArrayNonUniformIndexing;
+    VkBool32                             shaderStorageBufferArrayNonUniformIndexing;
+    VkBool32                             shaderStorageImageArrayNonUniformIndexing;
+    VkBool32                             shaderInputAttachmentArrayNonUniformIndexing;
+    VkBool32                             shaderUniformTexelBufferArrayNonUniformIndexing;
+    VkBool32                             shaderStorageTexelBufferArrayNonUniformIndexing;
+    VkBool32                             descriptorBindingUniformBufferUpdateAfterBind;
+    VkBool32                             descriptorBindingSampledImageUpdateAfterBind;
+    VkBool32                             descriptorBindingStorageImageUpdateAfterBind;
+    VkBool32                             descriptorBindingStorageBufferUpdateAfterBind;
+    VkBool32                             descriptorBindingUniformTexelBufferUpdateAfterBind;
+    VkBool32                             descriptorBindingStorageTexelBufferUpdateAfterBind;
+    VkBool32                             descriptorBindingUpdateUnusedWhilePending;
+    VkBool32                             descriptorBindingPartiallyBound;
+    VkBool32                             descriptorBindingVariableDescriptorCount;
+    VkBool32                             runtimeDescriptorArray;
+} VkPhysicalDeviceDescriptorIndexingFeaturesEXT;
+
+typedef struct VkPhysicalDeviceDescriptorIndexingPropertiesEXT
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    uint32_t                             maxUpdateAfterBindDescriptorsInAllPools;
+    VkBool32                             shaderUniformBufferArrayNonUniformIndexingNative;
+    VkBool32                             shaderSampledImageArrayNonUniformIndexingNative;
+    VkBool32                             shaderStorageBufferArrayNonUniformIndexingNative;
+    VkBool32                             shaderStorageImageArrayNonUniformIndexingNative;
+    VkBool32                             shaderInputAttachmentArrayNonUniformIndexingNative;
+    VkBool32                             robustBufferAccessUpdateAfterBind;
+    VkBool32                             quadDivergentImplicitLod;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindSamplers;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindUniformBuffers;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindStorageBuffers;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindSampledImages;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindStorageImages;
+    uint32_t                             maxPerStageDescriptorUpdateAfterBindInputAttachments;
+    uint32_t                             maxPerStageUpdateAfterBindResources;
+    uint32_t                             maxDescriptorSetUpdateAfterBindSamplers;
+    uint32_t                             maxDescriptorSetUpdateAfterBindUniformBuffers;
+    uint32_t                             maxDescriptorSetUpdateAfterBindUniformBuffersDynamic;
+    uint32_t                             maxDescriptorSetUpdateAfterBindStorageBuffers;
+    uint32_t                             maxDescriptorSetUpdateAfterBindStorageBuffersDynamic;
+    uint32_t                             maxDescriptorSetUpdateAfterBindSampledImages;
+    uint32_t                             maxDescriptorSetUpdateAfterBindStorageImages;
+    uint32_t                             maxDescriptorSetUpdateAfterBindInputAttachments;
+} VkPhysicalDeviceDescriptorIndexingPropertiesEXT;
+
+typedef struct VkDescriptorSetVariableDescriptorCountAllocateInfoEXT
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    uint32_t                             descriptorSetCount;
+    const uint32_t*                      pDescriptorCounts;
+} VkDescriptorSetVariableDescriptorCountAllocateInfoEXT;
+
+typedef struct VkDescriptorSetVariableDescriptorCountLayoutSupportEXT
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    uint32_t                             maxVariableDescriptorCount;
+} VkDescriptorSetVariableDescriptorCountLayoutSupportEXT;
+
+#define VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT \
+    VK_EXT_DESCRIPTOR_INDEXING_ENUM(VkStructureType, 0)
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT \
+    VK_EXT_DESCRIPTOR_INDEXING_ENUM(VkStructureType, 1)
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT \
+    VK_EXT_DESCRIPTOR_INDEXING_ENUM(VkStructureType, 2)
+#define VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT \
+    VK_EXT_DESCRIPTOR_INDEXING_ENUM(VkStructureType, 3)
+#define VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT_EXT \
+    VK_EXT_DESCRIPTOR_INDEXING_ENUM(VkStructureType, 4)
+
+#define VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT \
+    VK_EXTENSION_BIT(VkDescriptorPoolCreateFlagBits, 1)
+#define VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT \
+    VK_EXTENSION_BIT(VkDescriptorSetLayoutCreateFlagBits, 1)
+
+#define VK_ERROR_FRAGMENTATION_EXT \
+    ((VkResult)(-(int64_t)(VK_EXTENSION_ENUM_BASE_VALUE + ((VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NUMBER - 1) * \
+                                                            VK_EXTENSION_ENUM_RANGE_SIZE))))
+
+#endif /* VK_EXT_DESCRIPTOR_INDEXING_H_ */
@@ -0,0 +1,60 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_ext_memory_budget.h
+ * @brief Header for VK_EXT_memory_budget extension.  This extension reports the current per-heap memory usage of the
+ *        process and an estimate of how much memory it can allocate from each heap without degrading performance.
+ **********************************************************************************************************************
+ */
+#ifndef VK_EXT_MEMORY_BUDGET_H_
+#define VK_EXT_MEMORY_BUDGET_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_EXT_memory_budget 1
+#define VK_EXT_MEMORY_BUDGET_SPEC_VERSION               1
+#define VK_EXT_MEMORY_BUDGET_EXTENSION_NAME             "VK_EXT_memory_budget"
+
+#define VK_EXT_MEMORY_BUDGET_EXTENSION_NUMBER           238
+
+#define VK_EXT_MEMORY_BUDGET_ENUM(type, offset) \
+    VK_EXTENSION_ENUM(VK_EXT_MEMORY_BUDGET_EXTENSION_NUMBER, type, offset)
+
+typedef struct VkPhysicalDeviceMemoryBudgetPropertiesEXT
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    VkDeviceSize                         heapBudget[VK_MAX_MEMORY_HEAPS];
+    VkDeviceSize                         heapUsage[VK_MAX_MEMORY_HEAPS];
+} VkPhysicalDeviceMemoryBudgetPropertiesEXT;
+
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT \
+    VK_EXT_MEMORY_BUDGET_ENUM(VkStructureType, 0)
+
+#endif /* VK_EXT_MEMORY_BUDGET_H_ */
@@ -0,0 +1,75 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_ext_pipeline_creation_feedback.h
+ * @brief Header for VK_EXT_pipeline_creation_feedback extension.  This extension lets applications query whether a
+ *        pipeline was served from a pipeline cache and how long its creation took, both overall and per stage.
+ **********************************************************************************************************************
+ */
+#ifndef VK_EXT_PIPELINE_CREATION_FEEDBACK_H_
+#define VK_EXT_PIPELINE_CREATION_FEEDBACK_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_EXT_PIPELINE_CREATION_FEEDBACK_SPEC_VERSION          1
+#define VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME        "VK_EXT_pipeline_creation_feedback"
+
+#define VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NUMBER      193
+
+#define VK_EXT_PIPELINE_CREATION_FEEDBACK_ENUM(type, offset) \
+    VK_EXTENSION_ENUM(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NUMBER, type, offset)
+
+typedef enum VkPipelineCreationFeedbackFlagBitsEXT
+{
+    VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT                          = 0x00000001,
+    VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT = 0x00000002,
+    VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT_EXT     = 0x00000004,
+    VK_PIPELINE_CREATION_FEEDBACK_FLAG_BITS_MAX_ENUM_EXT                 = 0x7FFFFFFF
+} VkPipelineCreationFeedbackFlagBitsEXT;
+
+typedef VkFlags VkPipelineCreationFeedbackFlagsEXT;
+
+typedef struct VkPipelineCreationFeedbackEXT
+{
+    VkPipelineCreationFeedbackFlagsEXT   flags;
+    uint64_t                             duration;
+} VkPipelineCreationFeedbackEXT;
+
+typedef struct VkPipelineCreationFeedbackCreateInfoEXT
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkPipelineCreationFeedbackEXT*       pPipelineCreationFeedback;
+    uint32_t                             pipelineStageCreationFeedbackCount;
+    VkPipelineCreationFeedbackEXT*       pPipelineStageCreationFeedbacks;
+} VkPipelineCreationFeedbackCreateInfoEXT;
+
+#define VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT \
+    VK_EXT_PIPELINE_CREATION_FEEDBACK_ENUM(VkStructureType, 0)
+
+#endif /* VK_EXT_PIPELINE_CREATION_FEEDBACK_H_ */
@@ -0,0 +1,63 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_khr_draw_indirect_count.h
+ * @brief Header for VK_KHR_draw_indirect_count extension.  This extension allows the draw count of indirect draws to
+ *        be sourced from a buffer, promoting the functionality of VK_AMD_draw_indirect_count.
+ **********************************************************************************************************************
+ */
+#ifndef VK_KHR_DRAW_INDIRECT_COUNT_H_
+#define VK_KHR_DRAW_INDIRECT_COUNT_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_KHR_draw_indirect_count 1
+#define VK_KHR_DRAW_INDIRECT_COUNT_SPEC_VERSION         1
+#define VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME       "VK_KHR_draw_indirect_count"
+
+#define VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NUMBER     170
+
+typedef void (VKAPI_PTR *PFN_vkCmdDrawIndirectCountKHR)(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride);
+
+typedef void (VKAPI_PTR *PFN_vkCmdDrawIndexedIndirectCountKHR)(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride);
+
+#endif /* VK_KHR_DRAW_INDIRECT_COUNT_H_ */
@@ -0,0 +1,145 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/**
+ **********************************************************************************************************************
+ * @file  vk_khr_timeline_semaphore.h
+ * @brief Header for VK_KHR_timeline_semaphore extension.  This extension adds semaphores carrying a monotonically
+ *        increasing 64-bit payload that can be waited on and signaled with specific values from queues and the host.
+ **********************************************************************************************************************
+ */
+#ifndef VK_KHR_TIMELINE_SEMAPHORE_H_
+#define VK_KHR_TIMELINE_SEMAPHORE_H_
+
+#include "vk_internal_ext_helper.h"
+
+#define VK_KHR_timeline_semaphore 1
+#define VK_KHR_TIMELINE_SEMAPHORE_SPEC_VERSION           2
+#define VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME         "VK_KHR_timeline_semaphore"
+
+#define VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NUMBER       208
+
+#define VK_KHR_TIMELINE_SEMAPHORE_ENUM(type, offset) \
+    VK_EXTENSION_ENUM(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NUMBER, type, offset)
+
+typedef enum VkSemaphoreTypeKHR
+{
+    VK_SEMAPHORE_TYPE_BINARY_KHR                = 0,
+    VK_SEMAPHORE_TYPE_TIMELINE_KHR              = 1,
+    VK_SEMAPHORE_TYPE_MAX_ENUM_KHR              = 0x7FFFFFFF
+} VkSemaphoreTypeKHR;
+
+typedef enum VkSemaphoreWaitFlagBitsKHR
+{
+    VK_SEMAPHORE_WAIT_ANY_BIT_KHR               = 0x00000001,
+    VK_SEMAPHORE_WAIT_FLAG_BITS_MAX_ENUM_KHR    = 0x7FFFFFFF
+} VkSemaphoreWaitFlagBitsKHR;
+
+typedef VkFlags VkSemaphoreWaitFlagsKHR;
+
+typedef struct VkPhysicalDeviceTimelineSemaphoreFeaturesKHR
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    VkBool32                             timelineSemaphore;
+} VkPhysicalDeviceTimelineSemaphoreFeaturesKHR;
+
+typedef struct VkPhysicalDeviceTimelineSemaphorePropertiesKHR
+{
+    VkStructureType                      sType;
+    void*                                pNext;
+
+    uint64_t                             maxTimelineSemaphoreValueDifference;
+} VkPhysicalDeviceTimelineSemaphorePropertiesKHR;
+
+typedef struct VkSemaphoreTypeCreateInfoKHR
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkSemaphoreTypeKHR                   semaphoreType;
+    uint64_t                             initialValue;
+} VkSemaphoreTypeCreateInfoKHR;
+
+typedef struct VkTimelineSemaphoreSubmitInfoKHR
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    uint32_t                             waitSemaphoreValueCount;
+    const uint64_t*                      pWaitSemaphoreValues;
+    uint32_t                             signalSemaphoreValueCount;
+    const uint64_t*                      pSignalSemaphoreValues;
+} VkTimelineSemaphoreSubmitInfoKHR;
+
+typedef struct VkSemaphoreWaitInfoKHR
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkSemaphoreWaitFlagsKHR              flags;
+    uint32_t                             semaphoreCount;
+    const VkSemaphore*                   pSemaphores;
+    const uint64_t*                      pValues;
+} VkSemaphoreWaitInfoKHR;
+
+typedef struct VkSemaphoreSignalInfoKHR
+{
+    VkStructureType                      sType;
+    const void*                          pNext;
+
+    VkSemaphore                          semaphore;
+    uint64_t                             value;
+} VkSemaphoreSignalInfoKHR;
+
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 0)
+#define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 1)
+#define VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 2)
+#define VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 3)
+#define VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 4)
+#define VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR \
+    VK_KHR_TIMELINE_SEMAPHORE_ENUM(VkStructureType, 5)
+
+typedef VkResult (VKAPI_PTR *PFN_vkGetSemaphoreCounterValueKHR)(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    uint64_t*                                   pValue);
+
+typedef VkResult (VKAPI_PTR *PFN_vkWaitSemaphoresKHR)(
+    VkDevice                                    device,
+    const VkSemaphoreWaitInfoKHR*               pWaitInfo,
+    uint64_t                                    timeout);
+
+typedef VkResult (VKAPI_PTR *PFN_vkSignalSemaphoreKHR)(
+    VkDevice                                    device,
+    const VkSemaphoreSignalInfoKHR*             pSignalInfo);
+
+#endif /* VK_KHR_TIMELINE_SEMAPHORE_H_ */
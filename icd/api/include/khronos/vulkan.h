@@ -55,6 +55,12 @@
 // Internal (under development) extension definitions
 
 #include "devext/vk_amd_gpa_interface.h"
+#include "devext/vk_ext_descriptor_indexing.h"
+#include "devext/vk_ext_pipeline_creation_feedback.h"
+#include "devext/vk_khr_timeline_semaphore.h"
+#include "devext/vk_khr_draw_indirect_count.h"
+#include "devext/vk_ext_conditional_rendering.h"
+#include "devext/vk_ext_memory_budget.h"
 
 enum class DynamicStatesInternal : uint32_t {
     VIEWPORT = 0,
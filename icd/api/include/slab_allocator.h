@@ -0,0 +1,155 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ **********************************************************************************************************************
+ * @file  slab_allocator.h
+ * @brief Size-class slab allocator used for Vulkan API objects when the application provides no allocation callbacks.
+ **********************************************************************************************************************
+ */
+
+#ifndef __SLAB_ALLOCATOR_H__
+#define __SLAB_ALLOCATOR_H__
+
+#pragma once
+
+#include "include/khronos/vulkan.h"
+#include "include/vk_utils.h"
+
+#include "palMutex.h"
+
+namespace vk
+{
+
+// Occupancy statistics of a single size class of the slab allocator.
+struct SlabSizeClassStats
+{
+    uint32_t blockSize;       // Size of each block of this class in bytes
+    uint32_t chunkCount;      // Number of arena chunks owned by this class
+    uint32_t carvedBlocks;    // Number of blocks handed out at least once
+    uint32_t usedBlocks;      // Number of blocks currently allocated
+    uint32_t peakUsedBlocks;  // High-water mark of usedBlocks
+};
+
+// Overall statistics of the slab allocator.
+struct SlabAllocatorStats
+{
+    size_t             arenaSize;          // Size of the arena in bytes
+    size_t             arenaUsed;          // Bytes of the arena handed to size classes
+    uint32_t           fallbackAllocCount; // Allocations that bypassed the slabs (too large, or arena exhausted)
+    uint32_t           sizeClassCount;
+    SlabSizeClassStats sizeClasses[16];
+};
+
+// =====================================================================================================================
+// Slab allocator for the small, frequently created and destroyed API objects (image views, samplers, buffer views,
+// events, framebuffers...).
+//
+// A single arena is reserved up front and split into fixed-size chunks, each of which is owned by one size class and
+// carved into equally-sized blocks.  Freed blocks are kept on a per-class free list.  Requests that do not fit a size
+// class, or arrive after the arena is exhausted, are forwarded to the fallback callbacks.  Because all slab memory
+// lives in the arena, a simple range check tells which path a pointer was allocated from, so the allocator also
+// accepts pointers allocated directly through the fallback callbacks.
+class SlabAllocator
+{
+public:
+    SlabAllocator(const VkAllocationCallbacks* pFallbackCallbacks);
+
+    VkResult Init(size_t arenaSize);
+    void Destroy();
+
+    void GetStats(SlabAllocatorStats* pStats);
+    void LogStats();
+
+    VK_INLINE bool IsInitialized() const
+        { return (m_pArena != nullptr); }
+
+    VK_INLINE const VkAllocationCallbacks* GetCallbacks() const
+        { return &m_callbacks; }
+
+private:
+    static constexpr size_t   ChunkSize      = 64 * 1024;
+    static constexpr size_t   MaxAlignment   = 64;
+    static constexpr uint32_t SizeClassCount = 10;
+
+    // Block sizes of the size classes.  All are multiples of MaxAlignment so every block is suitably aligned.
+    static const uint32_t SizeClassBlockSize[SizeClassCount];
+
+    struct SizeClass
+    {
+        Util::Mutex lock;
+        void*       pFreeList;      // Singly-linked list of freed blocks, linked through their first bytes
+        uint8_t*    pCarve;         // Next never-used block of the most recent chunk
+        uint8_t*    pCarveEnd;      // End of the usable blocks of the most recent chunk
+        uint32_t    chunkCount;
+        uint32_t    carvedBlocks;
+        uint32_t    usedBlocks;
+        uint32_t    peakUsedBlocks;
+    };
+
+    static void* VKAPI_PTR AllocFunc(
+        void*                   pUserData,
+        size_t                  size,
+        size_t                  alignment,
+        VkSystemAllocationScope allocationScope);
+
+    static void* VKAPI_PTR ReallocFunc(
+        void*                   pUserData,
+        void*                   pOriginal,
+        size_t                  size,
+        size_t                  alignment,
+        VkSystemAllocationScope allocationScope);
+
+    static void VKAPI_PTR FreeFunc(
+        void*                   pUserData,
+        void*                   pMem);
+
+    void* Alloc(size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+    void* Realloc(void* pOriginal, size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
+    void  Free(void* pMem);
+
+    uint8_t* AllocChunk(uint32_t sizeClass);
+
+    VK_INLINE bool IsSlabMemory(const void* pMem) const
+    {
+        return (pMem >= m_pArena) && (pMem < (m_pArena + m_arenaSize));
+    }
+
+    const VkAllocationCallbacks* m_pFallbackCallbacks;
+    VkAllocationCallbacks        m_callbacks;
+
+    uint8_t*                     m_pArena;
+    size_t                       m_arenaSize;
+    size_t                       m_arenaUsed;       // Protected by m_arenaLock
+    uint8_t*                     m_pChunkSizeClass; // Size class of each chunk of the arena
+    Util::Mutex                  m_arenaLock;
+
+    volatile uint32_t            m_fallbackAllocCount;
+
+    SizeClass                    m_sizeClasses[SizeClassCount];
+};
+
+} // namespace vk
+
+#endif /* __SLAB_ALLOCATOR_H__ */
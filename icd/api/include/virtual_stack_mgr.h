@@ -92,13 +92,21 @@ public:
 private:
     VirtualStackMgr(Instance* pInstance);
 
+    Pal::Result AcquireSharedAllocator(VirtualStackAllocator** ppAllocator);
+
     typedef Util::List<VirtualStackAllocator*, PalAllocator> VirtualStackList;
 
+    // Number of lock-free cache slots.  Each thread is assigned a home slot, so as long as there are fewer recording
+    // threads than slots, a thread that releases an allocator gets the same one back without taking m_lock.
+    static constexpr uint32_t CacheSlotCount = 64;
+
     Instance* const         m_pInstance;        // Vulkan instance the virtual stack manager belongs to
 
     VirtualStackList        m_stackList;        // List of available virtual stack allocators
 
-    Util::Mutex             m_lock;             // Lock protecting concurrent access to the manager
+    Util::Mutex             m_lock;             // Lock protecting concurrent access to m_stackList
+
+    VirtualStackAllocator* volatile m_cacheSlots[CacheSlotCount]; // Available allocators cached per home slot
 };
 
 } // namespace vk
@@ -86,6 +86,9 @@ public:
 
     VK_INLINE uint32_t GetQueueFamilyIndex() const { return m_queueFamilyIndex; }
 
+    // Command buffers whose last reset predates the current epoch have a pending pool reset.
+    VK_INLINE uint64_t GetResetEpoch() const { return m_resetEpoch; }
+
 protected:
     CmdPool(
         Device*              pDevice,
@@ -104,6 +107,8 @@ protected:
 
     Util::IntrusiveList<GpuEventMgr> m_freeEventMgrs;
     uint32_t                         m_totalEventMgrCount;
+
+    uint64_t                         m_resetEpoch;
 };
 
 namespace entry
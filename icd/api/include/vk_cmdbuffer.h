@@ -74,7 +74,9 @@ namespace vk
 {
 
 // Forward declare Vulkan classes used in this file
+class Buffer;
 class ComputePipeline;
+class DescriptorSetLayout;
 class Device;
 class DispatchableCmdBuffer;
 class Framebuffer;
@@ -97,9 +99,14 @@ struct CmdBufGpuMem
 
 constexpr uint32_t MaxDescSetRegCount   = MaxDescriptorSets * PipelineLayout::SetPtrRegCount;
 constexpr uint32_t MaxDynDescRegCount   = MaxDynamicDescriptors * PipelineLayout::DynDescRegCount;
-constexpr uint32_t MaxBindingRegCount   = MaxDescSetRegCount + MaxDynDescRegCount;
+constexpr uint32_t MaxInlDescRegCount   = MaxInlineDescriptors * PipelineLayout::InlineDescRegCount;
+constexpr uint32_t MaxBindingRegCount   = MaxDescSetRegCount + MaxDynDescRegCount + MaxInlDescRegCount;
 constexpr uint32_t MaxPushConstRegCount = MaxPushConstants / 4;
 
+// Number of timestamp query pools a command buffer tracks its writes to, so that results can be waited for on the
+// submission writing them.  Results of further pools are polled for.
+constexpr uint32_t MaxTrackedTimestampPools = 8;
+
 // This structure contains information about currently written user data entries within the command buffer
 struct PipelineBindState
 {
@@ -160,6 +167,15 @@ struct AllGpuRenderState
         uint32_t scissorRect;
         uint32_t samplePattern;
     } staticTokens;
+
+    // State of the active VK_EXT_conditional_rendering block, if any
+    struct
+    {
+        const Buffer* pBuffer;  // Buffer holding the 32-bit predicate
+        VkDeviceSize  offset;   // Offset of the predicate within the buffer
+        bool          inverted; // Execute commands when the predicate is zero instead
+        bool          active;   // Whether a conditional rendering block is open
+    } conditionalRendering;
 };
 
 // This structure describes current render state within a command buffer during its building.
@@ -204,6 +220,19 @@ struct RenderPassInstanceState
     SamplePattern*                              pSamplePatterns;
 };
 
+// Global and buffer memory barriers recorded by vkCmdPipelineBarrier() that have not been issued to PAL yet.  Adjacent
+// barriers are merged into a single PAL barrier that is issued before the next command that does GPU work.
+struct DeferredBarrierState
+{
+    uint32_t             pendingCount;  // Number of vkCmdPipelineBarrier() calls merged into the pending barrier
+    VkPipelineStageFlags srcStageMask;  // Union of the pending source stage masks
+    VkPipelineStageFlags dstStageMask;  // Union of the pending destination stage masks
+    uint32_t             srcCacheMask;  // Union of the pending source cache masks
+    uint32_t             dstCacheMask;  // Union of the pending destination cache masks
+    uint32_t             apiCount;      // vkCmdPipelineBarrier() calls deferred, not yet reported to the device
+    uint32_t             palCount;      // Merged PAL barriers issued, not yet reported to the device
+};
+
 // =====================================================================================================================
 // A Vulkan command buffer.
 class CmdBuffer
@@ -239,6 +268,19 @@ public:
         uint32_t                                    dynamicOffsetCount,
         const uint32_t*                             pDynamicOffsets);
 
+    void PushDescriptorSetKHR(
+        VkPipelineBindPoint                         pipelineBindPoint,
+        VkPipelineLayout                            layout,
+        uint32_t                                    set,
+        uint32_t                                    descriptorWriteCount,
+        const VkWriteDescriptorSet*                 pDescriptorWrites);
+
+    void PushDescriptorSetWithTemplateKHR(
+        VkDescriptorUpdateTemplateKHR               descriptorUpdateTemplate,
+        VkPipelineLayout                            layout,
+        uint32_t                                    set,
+        const void*                                 pData);
+
     void BindIndexBuffer(
         VkBuffer                                    buffer,
         VkDeviceSize                                offset,
@@ -485,6 +527,11 @@ public:
     void SetSampleLocations(
         const VkSampleLocationsInfoEXT* pSampleLocationsInfo);
 
+    void BeginConditionalRendering(
+        const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin);
+
+    void EndConditionalRendering();
+
     void BeginRenderPass(
         const VkRenderPassBeginInfo* pRenderPassBegin,
         VkSubpassContents            contents);
@@ -559,6 +606,24 @@ public:
 
     void RequestRenderPassEvents(uint32_t eventCount, GpuEvents*** pppGpuEvents);
 
+    // Returns true if a later execution of this command buffer resets internal GPU events which a previous execution
+    // may still access
+    VK_INLINE bool UsesRecyclableGpuEvents() const
+        { return (m_pGpuEventMgr != nullptr) && m_pGpuEventMgr->NeedRecycleWaitOnResubmit(); }
+
+    VK_INLINE const Queue* GetLastSubmitQueue() const { return m_pLastSubmitQueue; }
+    VK_INLINE uint64_t GetLastSubmitSerial() const { return m_lastSubmitSerial; }
+
+    VK_INLINE void SetLastSubmit(const Queue* pQueue, uint64_t serial)
+    {
+        m_pLastSubmitQueue = pQueue;
+        m_lastSubmitSerial = serial;
+    }
+
+    VK_INLINE bool WritesTimestamps() const { return (m_timestampPoolCount > 0); }
+
+    void SetTimestampSubmit(Queue* pQueue, uint64_t serial) const;
+
     void PalCmdBarrier(
         const Pal::BarrierInfo& info);
 
@@ -743,6 +808,15 @@ public:
         return m_pDevice->NumPalDevices() * numEvents;
     }
 
+    // Issues any merged vkCmdPipelineBarrier() barriers.  Must be called before recording GPU work.
+    VK_INLINE void FlushDeferredBarriers()
+    {
+        if (m_deferredBarriers.pendingCount != 0)
+        {
+            ExecuteDeferredBarriers();
+        }
+    }
+
 #if VK_ENABLE_DEBUG_BARRIERS
     VK_INLINE void DbgBarrierPreCmd(uint32_t cmd)
     {
@@ -780,6 +854,8 @@ private:
 
     void ResetState();
 
+    void TrackTimestampPool(const TimestampQueryPool* pQueryPool);
+
     void FlushBarriers(
         Pal::BarrierInfo*              pBarrier,
         Pal::BarrierTransition* const  pTransitions,
@@ -798,10 +874,38 @@ private:
         const VkImageMemoryBarrier*  pImageMemoryBarriers,
         Pal::BarrierInfo*            pBarrier);
 
+    bool DeferBarriers(
+        VkPipelineStageFlags         srcStageMask,
+        VkPipelineStageFlags         destStageMask,
+        uint32_t                     memBarrierCount,
+        const VkMemoryBarrier*       pMemoryBarriers,
+        uint32_t                     bufferMemoryBarrierCount,
+        const VkBufferMemoryBarrier* pBufferMemoryBarriers);
+
+    void ExecuteDeferredBarriers();
+
     void RebindCompatibleUserData(
         uint32_t               bindPoint,
         const PipelineLayout*  pNewLayout);
 
+    uint32_t* AllocPushDescriptorSet(
+        uint32_t                   deviceIdx,
+        const DescriptorSetLayout* pSetLayout,
+        Pal::gpusize*              pGpuAddress);
+
+    void SetPushDescriptorSetUserData(
+        Pal::PipelineBindPoint     bindPoint,
+        const PipelineLayout*      pLayout,
+        uint32_t                   set,
+        uint32_t                   deviceIdx,
+        Pal::gpusize               gpuAddress,
+        const uint32_t*            pInlineData);
+
+    void CommitPushDescriptorSet(
+        Pal::PipelineBindPoint     bindPoint,
+        const PipelineLayout*      pLayout,
+        uint32_t                   set);
+
     void PalBindPipeline(
         VkPipelineBindPoint     pipelineBindPoint,
         VkPipeline              pipeline);
@@ -823,6 +927,26 @@ private:
     void RPInitSamplePattern();
     void RPSetViewInstanceMask();
 
+    void PalCmdSetPredication(bool enable);
+
+    // Conditional rendering only applies to draws, dispatches and attachment clears, so PAL predication is enabled
+    // just for the duration of those commands.
+    VK_INLINE void PalCmdBeginPredicated()
+    {
+        if (m_state.allGpuState.conditionalRendering.active)
+        {
+            PalCmdSetPredication(true);
+        }
+    }
+
+    VK_INLINE void PalCmdEndPredicated()
+    {
+        if (m_state.allGpuState.conditionalRendering.active)
+        {
+            PalCmdSetPredication(false);
+        }
+    }
+
     VK_INLINE Pal::ImageLayout RPGetAttachmentLayout(uint32_t attachment, Pal::ImageAspect aspect);
     VK_INLINE void RPSetAttachmentLayout(uint32_t attachment, Pal::ImageAspect aspect, Pal::ImageLayout layout);
 
@@ -840,6 +964,11 @@ private:
     Pal::ICmdBuffer*              m_pPalCmdBuffers[MaxPalDevices];
     VirtualStackAllocator*        m_pStackAllocator;
     GpuEventMgr*                  m_pGpuEventMgr;
+    const Queue*                  m_pLastSubmitQueue; // Queue of the last submission since the last reset
+    uint64_t                      m_lastSubmitSerial; // Queue submission serial of the last submission
+    const TimestampQueryPool*     m_pTimestampPools[MaxTrackedTimestampPools]; // Timestamp pools written since the
+                                                                               // last reset
+    uint32_t                      m_timestampPoolCount;
 
     CmdBufferRenderState          m_state; // Render state tracked during command buffer building
 
@@ -847,11 +976,14 @@ private:
     StencilOpsCombiner            m_stencilCombiner; // Manages internal stencil combined state
     bool                          m_is2ndLvl;        // is this command buffer secondary or primary
     bool                          m_isRecording;
+    uint64_t                      m_poolResetEpoch;  // Pool reset epoch this command buffer was last reset in
 
     SqttCmdBufferState*           m_pSqttState; // Per-cmdbuf state for handling SQ thread-tracing annotations
 
     RenderPassInstanceState       m_renderPassInstance;
 
+    DeferredBarrierState          m_deferredBarriers; // Merged pipeline barriers not yet issued to PAL
+
 #if VK_ENABLE_DEBUG_BARRIERS
     uint32_t                      m_dbgBarrierPreCmdMask;
     uint32_t                      m_dbgBarrierPostCmdMask;
@@ -1117,6 +1249,24 @@ VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride);
 
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectCountKHR(
+    VkCommandBuffer                             cmdBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride);
+
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountKHR(
+    VkCommandBuffer                             cmdBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride);
+
 VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(
     VkCommandBuffer                             commandBuffer,
     uint32_t                                    x,
@@ -1305,6 +1455,21 @@ VKAPI_ATTR void VKAPI_CALL vkCmdPushConstants(
     uint32_t                                    size,
     const void*                                 pValues);
 
+VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites);
+
+VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetWithTemplateKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkDescriptorUpdateTemplateKHR               descriptorUpdateTemplate,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    const void*                                 pData);
+
 VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass(
     VkCommandBuffer                             commandBuffer,
     const VkRenderPassBeginInfo*                pRenderPassBegin,
@@ -1336,6 +1501,13 @@ VKAPI_ATTR void VKAPI_CALL vkCmdDebugMarkerInsertEXT(
 VKAPI_ATTR void VKAPI_CALL vkCmdSetSampleLocationsEXT(
     VkCommandBuffer                             commandBuffer,
     const VkSampleLocationsInfoEXT*             pSampleLocationsInfo);
+
+VKAPI_ATTR void VKAPI_CALL vkCmdBeginConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin);
+
+VKAPI_ATTR void VKAPI_CALL vkCmdEndConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer);
 } // namespace entry
 
 } // namespace vk
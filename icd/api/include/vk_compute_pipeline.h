@@ -96,7 +96,8 @@ protected:
         Pal::IPipeline**                     pPalPipeline,
         const PipelineLayout*                pPipelineLayout,
         PipelineBinaryInfo*                  pPipelineBinary,
-        const ImmedInfo&                     immedInfo);
+        const ImmedInfo&                     immedInfo,
+        const PipelineCreationFeedback&      feedback);
 
     void CreateStaticState();
     void DestroyStaticState(const VkAllocationCallbacks* pAllocator);
@@ -111,7 +112,8 @@ protected:
         void**                                  ppTempBuffer,
         void**                                  ppTempShaderBuffer,
         size_t*                                 pPipelineBinarySize,
-        const void**                            ppPipelineBinary);
+        const void**                            ppPipelineBinary,
+        PipelineCreationFeedback*               pFeedback);
 
 private:
     ImmedInfo m_info; // Immediate state that will go in CmdSet* functions
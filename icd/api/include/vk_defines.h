@@ -184,12 +184,18 @@ namespace vk
     static const uint32_t MaxDynamicStorageDescriptors = 8;
     static const uint32_t MaxDynamicDescriptors = MaxDynamicUniformDescriptors + MaxDynamicStorageDescriptors;
 
+    // Maximum number of buffer descriptors per descriptor set (and per pipeline layout) placed inline in user data
+    static const uint32_t MaxInlineDescriptors = 8;
+
     // The maximum number of sets that can appear in a pipeline layout
     static const uint32_t MaxDescriptorSets = 32;
 
     // The maximum size of push constants in bytes
     static const uint32_t MaxPushConstants = 128;
 
+    // The maximum number of descriptors in a descriptor set layout created for push descriptors
+    static const uint32_t MaxPushDescriptors = 32;
+
 }// namespace vk
 
 #endif//__VK_DEFINES_H__
@@ -66,6 +66,7 @@ public:
 
     bool AllocSetGpuMem(
         const DescriptorSetLayout*  pLayout,
+        uint32_t                    variableDescriptorCount,
         Pal::gpusize*               pSetGpuMemOffset,
         void**                      pSetAllocHandle);
 
@@ -191,6 +192,7 @@ public:
     VkResult AllocDescriptorSets(
         uint32_t                        count,
         const VkDescriptorSetLayout*    pSetLayouts,
+        const uint32_t*                 pVariableDescriptorCounts,
         VkDescriptorSet*                pDescriptorSets);
 
     VkResult FreeDescriptorSets(
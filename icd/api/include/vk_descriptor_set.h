@@ -67,7 +67,7 @@ union DescriptorSetFlags
 class DescriptorSet : public NonDispatchable<VkDescriptorSet, DescriptorSet>
 {
 public:
-    VK_INLINE void WriteSamplerDescriptors(
+    VK_INLINE static void WriteSamplerDescriptors(
         const Device::Properties&       deviceProperties,
         const VkDescriptorImageInfo*    pDescriptors,
         uint32_t*                       pDestAddr,
@@ -75,7 +75,7 @@ public:
         uint32_t                        dwStride,
         size_t                          descriptorStrideInBytes);
 
-    VK_INLINE void WriteImageSamplerDescriptors(
+    VK_INLINE static void WriteImageSamplerDescriptors(
         const Device::Properties&       deviceProperties,
         const VkDescriptorImageInfo*    pDescriptors,
         uint32_t                        deviceIdx,
@@ -84,7 +84,7 @@ public:
         uint32_t                        dwStride,
         size_t                          descriptorStrideInBytes);
 
-    VK_INLINE void WriteImageDescriptors(
+    VK_INLINE static void WriteImageDescriptors(
         VkDescriptorType                descType,
         const Device::Properties&       deviceProperties,
         const VkDescriptorImageInfo*    pDescriptors,
@@ -94,7 +94,7 @@ public:
         uint32_t                        dwStride,
         size_t                          descriptorStrideInBytes);
 
-    VK_INLINE void WriteFmaskDescriptors(
+    VK_INLINE static void WriteFmaskDescriptors(
         const Device*                   pDevice,
         const VkDescriptorImageInfo*    pDescriptors,
         uint32_t                        deviceIdx,
@@ -103,7 +103,7 @@ public:
         uint32_t                        dwStride,
         size_t                          descriptorStrideInBytes);
 
-    VK_INLINE void WriteBufferInfoDescriptors(
+    VK_INLINE static void WriteBufferInfoDescriptors(
         const Device*                   pDevice,
         VkDescriptorType                type,
         const VkDescriptorBufferInfo*   pDescriptors,
@@ -113,7 +113,7 @@ public:
         uint32_t                        dwStride,
         size_t                          descriptorStrideInBytes);
 
-    VK_INLINE void WriteBufferDescriptors(
+    VK_INLINE static void WriteBufferDescriptors(
         const Device::Properties&       deviceProperties,
         VkDescriptorType                type,
         const VkBufferView*             pDescriptors,
@@ -145,12 +145,20 @@ public:
     uint32_t* DynamicDescriptorData()
         { return m_dynamicDescriptorData; }
 
+    uint32_t* InlineDescriptorData()
+        { return m_inlineDescriptorData; }
+
     VkResult Destroy(Device* pDevice);
 
     VK_INLINE static DescriptorSet* StateFromHandle(VkDescriptorSet set);
     VK_INLINE static Pal::gpusize GpuAddressFromHandle(uint32_t deviceIdx, VkDescriptorSet set);
     VK_INLINE static void UserDataPtrValueFromHandle(VkDescriptorSet set, uint32_t deviceIdx, uint32_t* pUserData);
 
+    VK_INLINE static void InlineDataFromHandle(
+        VkDescriptorSet set,
+        uint32_t*       pUserData,
+        uint32_t        inlDescMask);
+
     VK_INLINE static void PatchedDynamicDataFromHandle(
         Device*         pDevice,
         VkDescriptorSet set,
@@ -166,6 +174,21 @@ public:
         const VkWriteDescriptorSet*  pDescriptorWrites,
         size_t                       descriptorStrideInBytes = 0);
 
+    static void WriteDescriptors(
+        const Device*                pDevice,
+        uint32_t                     deviceIdx,
+        const Device::Properties&    deviceProperties,
+        const DescriptorSetLayout*   pLayout,
+        uint32_t*                    pSetCpuAddr,
+        uint32_t*                    pInlineData,
+        uint32_t*                    pDynamicData,
+        const VkWriteDescriptorSet&  params,
+        size_t                       descriptorStrideInBytes = 0);
+
+    static void WriteImmutableDescriptors(
+        const DescriptorSetLayout*   pLayout,
+        uint32_t*                    pSetCpuAddr);
+
     static void CopyDescriptorSets(
         const Device*                pDevice,
         uint32_t                     deviceIdx,
@@ -215,6 +238,10 @@ protected:
     // memory together with the descriptor set so that we are able to supply the patched version of the descriptors.
     uint32_t                    m_dynamicDescriptorData[MaxDynamicDescriptors * PipelineLayout::DynDescRegCount];
 
+    // Client memory copy of the buffer descriptors of this set that may be placed inline in user data (see the inline
+    // section of the descriptor set layout).
+    uint32_t                    m_inlineDescriptorData[MaxInlineDescriptors * PipelineLayout::InlineDescRegCount];
+
     friend class DescriptorPool;
     friend class DescriptorSetHeap;
 };
@@ -250,11 +277,34 @@ void DescriptorSet::UserDataPtrValueFromHandle(
     *pUserData = static_cast<uint32_t>(gpuAddress & 0xFFFFFFFFull);
 }
 
+// =====================================================================================================================
+// Returns the descriptor data of the specified descriptor set that is placed inline in user data.  The inline section
+// slots selected by inlDescMask are written consecutively to pUserData.
+void DescriptorSet::InlineDataFromHandle(
+    VkDescriptorSet set,
+    uint32_t*       pUserData,
+    uint32_t        inlDescMask)
+{
+    const uint32_t* pSrcData = StateFromHandle(set)->InlineDescriptorData();
+    uint32_t        slot     = 0;
+
+    while (Util::BitMaskScanForward(&slot, inlDescMask))
+    {
+        memcpy(pUserData,
+               pSrcData + (slot * PipelineLayout::InlineDescRegCount),
+               PipelineLayout::InlineDescRegCount * sizeof(uint32_t));
+
+        pUserData   += PipelineLayout::InlineDescRegCount;
+        inlDescMask &= ~(1u << slot);
+    }
+}
+
 // =====================================================================================================================
 // Returns the patched dynamic descriptor data for the specified descriptor set.
 // NOTE: This function assumes that we directly store the whole buffer SRDs in user data and treats the SRD data in a
-// white-box fashion. Probably would be better if we'd have a PAL function to do the patching of the dynamic offset,
-// but this is expected to be temporary anyways until we'll have proper support for dynamic descriptors in SC.
+// white-box fashion. The SRDs built at descriptor update time act as templates: patching only adds the dynamic offset
+// to the 48-bit base address in their first qword, so binding never has to call into PAL.  This is expected to be
+// temporary anyways until we'll have proper support for dynamic descriptors in SC.
 void DescriptorSet::PatchedDynamicDataFromHandle(
     Device*         pDevice,
     VkDescriptorSet set,
@@ -265,25 +315,28 @@ void DescriptorSet::PatchedDynamicDataFromHandle(
     // This code expects 4 DW SRDs whose first 48 bits is the base address.
     VK_ASSERT(pDevice->GetProperties().descriptorSizes.bufferView == (4 * sizeof(uint32_t)));
 
-    uint64_t* pDstQwords = reinterpret_cast<uint64_t*>(pUserData);
-    uint64_t* pSrcQwords = reinterpret_cast<uint64_t*>(StateFromHandle(set)->DynamicDescriptorData());
-    const uint32_t dynDataNumQwords = pDevice->GetEnabledFeatures().robustBufferAccess ? 2 : 1;
-    for (uint32_t i = 0; i < numDynamicDescriptors; ++i)
-    {
-        const uint64_t baseAddressMask = 0x0000FFFFFFFFFFFFull;
-
-        // Read default base address
-        uint64_t baseAddress = pSrcQwords[i * dynDataNumQwords] & baseAddressMask;
-        uint64_t hiBits      = pSrcQwords[i * dynDataNumQwords] & ~baseAddressMask;
-
-        // Add dynamic offset
-        baseAddress += pDynamicOffsets[i];
+    constexpr uint64_t BaseAddressMask = 0x0000FFFFFFFFFFFFull;
 
-        pDstQwords[i * dynDataNumQwords] = hiBits | baseAddress;
+    uint64_t*       pDstQwords = reinterpret_cast<uint64_t*>(pUserData);
+    const uint64_t* pSrcQwords = reinterpret_cast<const uint64_t*>(StateFromHandle(set)->DynamicDescriptorData());
 
-        if (pDevice->GetEnabledFeatures().robustBufferAccess)
+    if (pDevice->GetEnabledFeatures().robustBufferAccess)
+    {
+        // Whole SRDs: patch the base address and copy the size and format qword as is.
+        for (uint32_t i = 0; i < numDynamicDescriptors; ++i, pSrcQwords += 2, pDstQwords += 2)
+        {
+            pDstQwords[0] = (pSrcQwords[0] & ~BaseAddressMask) |
+                            ((pSrcQwords[0] + pDynamicOffsets[i]) & BaseAddressMask);
+            pDstQwords[1] = pSrcQwords[1];
+        }
+    }
+    else
+    {
+        // Only the base addresses are stored.
+        for (uint32_t i = 0; i < numDynamicDescriptors; ++i)
         {
-            pDstQwords[i * dynDataNumQwords + 1] = pSrcQwords[i * dynDataNumQwords + 1];
+            pDstQwords[i] = (pSrcQwords[i] & ~BaseAddressMask) |
+                            ((pSrcQwords[i] + pDynamicOffsets[i]) & BaseAddressMask);
         }
     }
 }
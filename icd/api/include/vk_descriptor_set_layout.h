@@ -62,11 +62,14 @@ public:
     struct BindingInfo
     {
         VkDescriptorSetLayoutBinding info;  // Vulkan binding information
+        VkDescriptorBindingFlagsEXT  flags; // Binding flags (VK_EXT_descriptor_indexing)
 
         BindingSectionInfo  sta;            // Information specific to the static section of the descriptor binding
         BindingSectionInfo  dyn;            // Information specific to the dynamic section of the descriptor binding
         BindingSectionInfo  imm;            // Information specific to the immutable section of the descriptor binding
         BindingSectionInfo  fmask;          // Information sepcific to the fmask section of the descriptor binding
+        BindingSectionInfo  inl;            // Information specific to the inline section of the descriptor binding
+                                            // (host copy of a buffer descriptor that may be placed in user data)
     };
 
     // Information about a specific section of a descriptor set layout
@@ -98,6 +101,9 @@ public:
         ImmSectionInfo  imm;                // Information specific to the immutable section of the descriptor set
                                             // layout
         SectionInfo     fmask;              // Information specific to the fmask section of the descriptor set layout
+        SectionInfo     inl;                // Information specific to the inline section of the descriptor set layout
+        VkDescriptorSetLayoutCreateFlags flags; // Descriptor set layout create flags
+        uint32_t        varDescBinding;     // Binding number of the variable-sized binding, or count if there is none
     };
 
     static VkResult Create(
@@ -116,11 +122,14 @@ public:
 
     const Device* VkDevice() const { return m_pDevice; }
 
+    uint32_t GetSetDwSize(uint32_t variableDescriptorCount) const;
+
     static uint32_t GetDescStaticSectionDwSize(const Device* pDevice, VkDescriptorType type);
     static uint32_t GetDescFmaskSectionDwSize(const Device* pDevice, VkDescriptorType type);
     static uint32_t GetDescDynamicSectionDwSize(const Device* pDevice, VkDescriptorType type);
     static uint32_t GetDescImmutableSectionDwSize(const Device* pDevice, VkDescriptorType type);
     static uint32_t GetDynamicBufferDescDwSize(const Device* pDevice);
+    static uint32_t GetDescInlineSectionDwSize(const Device* pDevice, const VkDescriptorSetLayoutBinding* pBindingInfo);
 
 protected:
     DescriptorSetLayout(
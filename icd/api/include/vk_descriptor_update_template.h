@@ -41,6 +41,7 @@ namespace vk
 {
 
 class DescriptorSet;
+class DescriptorSetLayout;
 class Device;
 
 // =====================================================================================================================
@@ -64,15 +65,34 @@ public:
         VkDescriptorSet descriptorSet,
         const void*     pData);
 
+    void PushUpdate(
+        const Device*              pDevice,
+        uint32_t                   deviceIdx,
+        const DescriptorSetLayout* pLayout,
+        uint32_t*                  pSetCpuAddr,
+        uint32_t*                  pInlineData,
+        const void*                pData) const;
+
+    VkPipelineBindPoint GetPipelineBindPoint() const
+        { return m_pipelineBindPoint; }
+
 protected:
     DescriptorUpdateTemplate(
         const VkDescriptorUpdateTemplateEntryKHR* pEntries,
-        uint32_t                                  numEntries);
+        uint32_t                                  numEntries,
+        VkPipelineBindPoint                       pipelineBindPoint);
 
     virtual ~DescriptorUpdateTemplate();
 
+    VK_INLINE void GetDescriptorWrite(
+        uint32_t              entryIdx,
+        VkDescriptorSet       descriptorSet,
+        const void*           pData,
+        VkWriteDescriptorSet* pDescriptorWrite) const;
+
     const VkDescriptorUpdateTemplateEntryKHR* m_pEntries;
     uint32_t                                  m_numEntries;
+    VkPipelineBindPoint                       m_pipelineBindPoint;  // Only valid for push descriptor templates
 };
 
 namespace entry
@@ -47,8 +47,12 @@
 
 #include "include/internal_mem_mgr.h"
 #include "include/render_state_cache.h"
+#include "include/slab_allocator.h"
 #include "include/virtual_stack_mgr.h"
 
+#include "renderpass/renderpass_execute_cache.h"
+
+#include "palConditionVariable.h"
 #include "palDevice.h"
 #include "palImage.h"
 #include "palList.h"
@@ -85,6 +89,7 @@ class Instance;
 class PhysicalDevice;
 class Queue;
 class SqttMgr;
+class ApiTimingMgr;
 class SwapChain;
 class ChillMgr;
 class TurboSync;
@@ -137,6 +142,18 @@ public:
 
     VkResult WaitIdle(void);
 
+    uint32_t GetQueueCount() const;
+
+    void ReleaseTimelineWaits();
+
+    uint64_t GetTimelineProgress();
+
+    void NotifyTimelineProgress();
+
+    void WaitForTimelineProgress(
+        uint64_t                                    progress,
+        uint64_t                                    timeout);
+
     VkResult AllocMemory(
         const VkMemoryAllocateInfo*                 pAllocInfo,
         const VkAllocationCallbacks*                pAllocator,
@@ -397,6 +414,10 @@ public:
     Pal::PrtFeatureFlags GetPrtFeatures() const;
     Pal::gpusize GetVirtualAllocAlignment() const;
 
+    // Returns the callbacks used for API objects created without application-provided allocation callbacks
+    VK_INLINE const VkAllocationCallbacks* GetAllocCallbacks() const
+        { return m_pAllocCallbacks; }
+
     VK_INLINE void* AllocApiObject(
         size_t                       size,
         const VkAllocationCallbacks* pAllocator) const
@@ -464,6 +485,9 @@ public:
     VK_INLINE SqttMgr* GetSqttMgr()
         { return m_pSqttMgr; }
 
+    VK_INLINE ApiTimingMgr* GetApiTimingMgr()
+        { return m_pApiTimingMgr; }
+
     VK_INLINE Util::Mutex* GetMemoryMutex()
         { return &m_memoryMutex; }
 
@@ -481,9 +505,40 @@ public:
     VK_INLINE RenderStateCache* GetRenderStateCache()
         { return &m_renderStateCache; }
 
+    VK_INLINE RenderPassExecuteCache* GetRenderPassExecuteCache()
+        { return &m_renderPassExecuteCache; }
+
+    VK_INLINE const RenderPassExecuteCache* GetRenderPassExecuteCache() const
+        { return &m_renderPassExecuteCache; }
+
     uint32_t GetPipelineCacheExpectedEntryCount();
     void DecreasePipelineCacheCount();
 
+    // Records whether a resubmitted command buffer required a barrier to recycle its internal GPU events
+    VK_INLINE void RecordEventRecycleWait(bool barrierIssued)
+    {
+        Util::AtomicIncrement(barrierIssued ? &m_eventRecycleBarrierCount : &m_eventRecycleBarrierAvoidedCount);
+    }
+
+    VK_INLINE uint32_t GetEventRecycleBarrierCount() const
+        { return m_eventRecycleBarrierCount; }
+
+    VK_INLINE uint32_t GetEventRecycleBarrierAvoidedCount() const
+        { return m_eventRecycleBarrierAvoidedCount; }
+
+    // Records that a command buffer merged the given number of vkCmdPipelineBarrier() calls into fewer PAL barriers
+    VK_INLINE void RecordMergedBarriers(uint32_t apiCount, uint32_t palCount)
+    {
+        Util::AtomicAdd64(&m_mergedBarrierApiCount, apiCount);
+        Util::AtomicAdd64(&m_mergedBarrierPalCount, palCount);
+    }
+
+    VK_INLINE uint64_t GetMergedBarrierApiCount() const
+        { return m_mergedBarrierApiCount; }
+
+    VK_INLINE uint64_t GetMergedBarrierPalCount() const
+        { return m_mergedBarrierPalCount; }
+
 protected:
     Device(
         uint32_t                         deviceCount,
@@ -492,6 +547,11 @@ protected:
         Pal::GpuMemoryRef*               pMemRefArrays,
         const DeviceExtensions::Enabled& enabledExtensions,
         const VkPhysicalDeviceFeatures*  pFeatures);
+    Pal::Result WaitForSubmittedFences(
+        uint32_t                         fenceCount,
+        const VkFence*                   pFences,
+        bool                             waitAll,
+        uint64_t                         timeout);
     VkResult CreateLlpcInternalComputePipeline(
         size_t                           codeByteSize,
         const uint8_t*                   pCode,
@@ -528,6 +588,11 @@ protected:
 #endif
     RenderStateCache                    m_renderStateCache;
 
+    RenderPassExecuteCache              m_renderPassExecuteCache;
+
+    SlabAllocator                       m_slabAllocator;        // Optional allocator for API objects
+    const VkAllocationCallbacks*        m_pAllocCallbacks;      // Either the slab or the instance callbacks
+
     VirtualStackAllocator*              m_pStackAllocator;
 
     DispatchableQueue*                  m_pQueues[Queue::MaxQueueFamilies][Queue::MaxQueuesPerFamily];
@@ -540,9 +605,16 @@ protected:
 
     const DeviceExtensions::Enabled     m_enabledExtensions;    // Enabled device extensions
     SqttMgr*                            m_pSqttMgr;             // Manager for developer mode SQ thread tracing
+    ApiTimingMgr*                       m_pApiTimingMgr;        // Manager for the API timing layer
     Util::Mutex                         m_memoryMutex;          // Shared mutex used occasionally by memory objects
     Util::Mutex                         m_timerQueueMutex;      // Shared mutex used occasionally by timer queue objects
 
+    // Host waits for a timeline semaphore signal or for a held back queue operation to be released block on this
+    // condition.  The progress count is incremented by every such event.
+    Util::Mutex                         m_timelineMutex;
+    Util::ConditionVariable             m_timelineCondition;
+    uint64_t                            m_timelineProgress;
+
     // The states of m_enabledFeatures are provided by application
     VkPhysicalDeviceFeatures            m_enabledFeatures;
 
@@ -557,6 +629,16 @@ protected:
     // Record pipeline cache count created on this device. Note this may be dropped once there isn't any test creating
     // excessive pipeline caches.
     volatile uint32_t                   m_pipelineCacheCount;
+
+    // Submission-time GPU event recycle statistics: barriers issued because a previous execution of a resubmitted
+    // command buffer could still be in flight, and barriers avoided because it was known to be complete.
+    volatile uint32_t                   m_eventRecycleBarrierCount;
+    volatile uint32_t                   m_eventRecycleBarrierAvoidedCount;
+
+    // Deferred barrier statistics of all ended command buffers: vkCmdPipelineBarrier() calls deferred, and the merged
+    // PAL barriers they were issued as.
+    volatile uint64_t                   m_mergedBarrierApiCount;
+    volatile uint64_t                   m_mergedBarrierPalCount;
 };
 
 // =====================================================================================================================
@@ -200,6 +200,9 @@ public:
         KHR_RELAXED_BLOCK_LAYOUT,
         KHR_DEDICATED_ALLOCATION,
         KHR_DESCRIPTOR_UPDATE_TEMPLATE,
+        KHR_PUSH_DESCRIPTOR,
+        KHR_TIMELINE_SEMAPHORE,
+        KHR_DRAW_INDIRECT_COUNT,
         KHR_EXTERNAL_MEMORY,
         KHR_EXTERNAL_MEMORY_FD,
         KHR_EXTERNAL_MEMORY_WIN32,
@@ -230,6 +233,10 @@ public:
         EXT_SHADER_SUBGROUP_BALLOT,
         EXT_SHADER_STENCIL_EXPORT,
         EXT_SHADER_VIEWPORT_INDEX_LAYER,
+        EXT_DESCRIPTOR_INDEXING,
+        EXT_PIPELINE_CREATION_FEEDBACK,
+        EXT_CONDITIONAL_RENDERING,
+        EXT_MEMORY_BUDGET,
         KHR_GET_MEMORY_REQUIREMENTS2,
         KHR_IMAGE_FORMAT_LIST,
         KHR_EXTERNAL_FENCE,
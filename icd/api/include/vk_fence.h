@@ -49,6 +49,7 @@ namespace vk
 {
 
 class Device;
+class Queue;
 
 class Fence : public NonDispatchable<VkFence, Fence>
 {
@@ -74,6 +75,29 @@ public:
     VK_INLINE void SetActiveDevice(uint32_t deviceIdx)
         { m_activeDeviceMask |= (1 << deviceIdx); }
 
+    // Records the queue submission this fence is signaled with
+    VK_INLINE void SetQueueSubmission(Queue* pQueue, uint64_t serial)
+    {
+        m_pSubmitQueue = pQueue;
+        m_submitSerial = serial;
+    }
+
+    void RetireQueueSubmissions() const;
+
+    // A queue holds back the submission of this fence until the timeline semaphore values it waits on are signaled
+    VK_INLINE void SetSubmissionDeferred(bool deferred)
+        { m_submissionDeferred = deferred ? 1 : 0; }
+
+    VK_INLINE bool IsSubmissionDeferred() const
+        { return (m_submissionDeferred != 0); }
+
+    // Error of a held back queue submission of this fence that failed once the queue released it
+    VK_INLINE void SetSubmissionResult(VkResult result)
+        { m_submissionResult = result; }
+
+    VK_INLINE VkResult GetSubmissionResult() const
+        { return m_submissionResult; }
+
     VK_FORCEINLINE Pal::IFence* PalFence(int32_t idx = DefaultDeviceIndex) const
     {
         VK_ASSERT((idx >= 0) && (idx < static_cast<int32_t>(MaxPalDevices)));
@@ -86,7 +110,11 @@ private:
     :
     m_activeDeviceMask(0),
     m_groupedFenceCount(numGroupedFences),
-    m_pPalTemporaryFences(nullptr)
+    m_pPalTemporaryFences(nullptr),
+    m_pSubmitQueue(nullptr),
+    m_submitSerial(0),
+    m_submissionDeferred(0),
+    m_submissionResult(VK_SUCCESS)
     {
         memcpy(m_pPalFences, pPalFences, sizeof(pPalFences[0]) * numGroupedFences);
         m_flags.value        = 0;
@@ -97,6 +125,10 @@ private:
     uint32_t     m_groupedFenceCount;
     Pal::IFence* m_pPalFences[MaxPalDevices];
     Pal::IFence* m_pPalTemporaryFences;
+    Queue*       m_pSubmitQueue;    // Queue this fence was last submitted to
+    uint64_t     m_submitSerial;    // Queue submission serial this fence was last submitted with
+    volatile uint32_t m_submissionDeferred; // The queue submission of this fence has not reached PAL yet
+    VkResult          m_submissionResult;   // Error of the held back queue submission of this fence, if it failed
 
     union
     {
@@ -264,7 +264,8 @@ protected:
         Pal::IColorBlendState**                pPalColorBlend,
         Pal::IDepthStencilState**              pPalDepthStencil,
         uint32_t                               coverageSamples,
-        PipelineBinaryInfo*                    pBinary);
+        PipelineBinaryInfo*                    pBinary,
+        const PipelineCreationFeedback&        feedback);
 
     void CreateStaticState();
     void DestroyStaticState(const VkAllocationCallbacks* pAllocator);
@@ -281,7 +282,8 @@ protected:
         void**                              ppTempBuffer,
         void**                              ppTempShaderBuffer,
         size_t*                             pipelineBinarySize,
-        const void**                        ppPipelineBinary);
+        const void**                        ppPipelineBinary,
+        PipelineCreationFeedback*           pFeedback);
 
     static VkResult BuildRasterizationState(
         Device*                             pDevice,
@@ -74,7 +74,7 @@ public:
     // Maximum number of DispatchTableEntry arrays that an instance can report.  Generally there is only 1, but
     // sometimes it may be necessary to shadow subsets of Vulkan entry points to customize behavior.  See
     // vk::entry::GetProcAddr() and Instance::GetDispatchTables() for where this is used.
-    static constexpr uint32_t MaxDispatchTables = 2;
+    static constexpr uint32_t MaxDispatchTables = 3;
 
     // Instances are a special type of objects, they are dispatchable but don't have the loader header as other
     // dispatchable object types.
@@ -171,6 +171,11 @@ public:
     VK_INLINE bool IsTracingSupportEnabled() const
         { return m_flags.sqttSupport; }
 
+    void EnableApiTimingSupport();
+
+    VK_INLINE bool IsApiTimingSupportEnabled() const
+        { return m_flags.apiTimingSupport; }
+
     VK_INLINE bool IsNullGpuModeEnabled() const
         { return m_flags.nullGpuMode; }
 
@@ -232,7 +237,8 @@ private:
             uint32_t sqttSupport        : 1;  // True if SQTT thread trace annotation markers are enabled
             uint32_t nullGpuMode        : 1;  // True if the instance is running in null gpu mode (fake gpus for shader
                                               // compilation
-            uint32_t reserved           : 30;
+            uint32_t apiTimingSupport   : 1;  // True if the API timing layer is enabled
+            uint32_t reserved           : 29;
         };
         uint32_t u32All;
     } m_flags;
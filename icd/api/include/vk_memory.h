@@ -173,12 +173,15 @@ private:
     friend class Image;
 
     bool         m_allocationCounted;
+    bool         m_heapUsageTracked;
     Pal::IImage* m_pExternalPalImage;
 
     // the function is used to mark that the allocation is counted in the logical device.
     // the destructor of this memory object need to decrease the count.
     VK_INLINE void SetAllocationCounted() { m_allocationCounted = true; }
 
+    void UpdateHeapUsage(bool allocated);
+
     Pal::Result MirrorSharedAllocation();
 
     // Private constructor used by Image objects to create wrapper API memory object for presentable image
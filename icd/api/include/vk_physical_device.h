@@ -390,6 +390,23 @@ public:
 
     void LateInitialize();
 
+    void GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT* pBudget) const;
+
+    void AddMemoryUsage(Pal::GpuHeap heap, Pal::gpusize size);
+    void RemoveMemoryUsage(Pal::GpuHeap heap, Pal::gpusize size);
+
+    VK_INLINE Pal::gpusize GetMemoryUsage(Pal::GpuHeap heap) const
+    {
+        VK_ASSERT(heap < Pal::GpuHeapCount);
+        return m_memoryUsage[heap];
+    }
+
+    VK_INLINE Pal::gpusize GetMemoryUsagePeak(Pal::GpuHeap heap) const
+    {
+        VK_ASSERT(heap < Pal::GpuHeapCount);
+        return m_memoryUsagePeak[heap];
+    }
+
 protected:
     PhysicalDevice(PhysicalDeviceManager* pPhysicalDeviceManager,
                    Pal::IDevice*          pPalDevice,
@@ -434,6 +451,12 @@ protected:
 
     // Device properties related to the VK_AMD_gpu_perf_api_interface extension
     PhysicalDeviceGpaProperties      m_gpaProps;
+
+    // Bytes of GPU memory currently allocated from each PAL heap by all devices created from this physical device,
+    // including driver-internal allocations.  Updated lock-free and reported through VK_EXT_memory_budget.
+    volatile uint64_t                m_memoryUsage[Pal::GpuHeapCount];
+    // Approximate high-water marks of the above, reported by the API timing layer.
+    Pal::gpusize                     m_memoryUsagePeak[Pal::GpuHeapCount];
 };
 
 VK_DEFINE_DISPATCHABLE(PhysicalDevice);
@@ -32,6 +32,9 @@
 #include "include/vk_defines.h"
 #include "include/vk_dispatch.h"
 #include "include/internal_mem_mgr.h"
+#include "include/vk_shader_code.h"
+
+#include "llpc.h"
 
 namespace Pal
 {
@@ -61,6 +64,14 @@ struct PipelineBinaryInfo
     void*  pBinary;
 };
 
+// Creation feedback reported by the compiler for a pipeline and each of its shader stages, indexed by ShaderStage.
+// Surfaced to applications through VK_EXT_pipeline_creation_feedback and to developer mode tools.
+struct PipelineCreationFeedback
+{
+    Llpc::PipelineBuildFeedback pipeline;
+    Llpc::PipelineBuildFeedback stages[ShaderStageCount];
+};
+
 // =====================================================================================================================
 // Base class of all pipeline objects.
 class Pipeline
@@ -92,6 +103,15 @@ public:
     VK_INLINE const PipelineBinaryInfo* GetBinary() const
         { return m_pBinary; }
 
+    VK_INLINE const PipelineCreationFeedback& GetCreationFeedback() const
+        { return m_feedback; }
+
+    static void WriteCreationFeedback(
+        const void*                             pNext,
+        uint32_t                                stageCount,
+        const VkPipelineShaderStageCreateInfo*  pStages,
+        const PipelineCreationFeedback&         feedback);
+
     static void CreateLegacyPathElfBinary(
         Device*         pDevice,
         bool            graphicsPipeline,
@@ -101,10 +121,11 @@ public:
 
 protected:
     Pipeline(
-        Device* const         pDevice,
-        Pal::IPipeline**      pPalPipeline,
-        const PipelineLayout* pLayout,
-        PipelineBinaryInfo*   pBinary);
+        Device* const                   pDevice,
+        Pal::IPipeline**                pPalPipeline,
+        const PipelineLayout*           pLayout,
+        PipelineBinaryInfo*             pBinary,
+        const PipelineCreationFeedback& feedback);
 
     virtual ~Pipeline();
 
@@ -114,6 +135,7 @@ protected:
 
 private:
     PipelineBinaryInfo* const       m_pBinary;
+    const PipelineCreationFeedback  m_feedback;
 };
 
 namespace entry
@@ -76,6 +76,9 @@ public:
     // NOTE: This should be changed once we have proper support for dynamic descriptors in SC
     static constexpr uint32_t DynDescRegCount = 4;
 
+    // Number of user data registers consumed per buffer descriptor placed inline in user data (whole buffer SRDs)
+    static constexpr uint32_t InlineDescRegCount = 4;
+
     // Magic number describing an invalid or unmapped user data entry
     static constexpr uint32_t InvalidReg = UINT32_MAX;
 
@@ -89,6 +92,9 @@ public:
         uint32_t    dynDescDataRegOffset;   // User data register offset for this set's dynamic descriptor data
         uint32_t    dynDescDataRegCount;    // Number of registers for the dynamic descriptor data
         uint32_t    dynDescCount;           // Number of dynamic descriptors defined by the descriptor set layout
+        uint32_t    inlDescDataRegOffset;   // User data register offset for this set's inline descriptor data
+        uint32_t    inlDescDataRegCount;    // Number of registers for the inline descriptor data
+        uint32_t    inlDescMask;            // Mask of the set layout's inline section slots placed in user data
         uint32_t    firstRegOffset;         // First user data register offset used by this set layout
         uint32_t    totalRegCount;          // Total number of user data registers used by this set layout
     };
@@ -186,6 +192,11 @@ protected:
         Info*                             pInfo,
         PipelineInfo*                     pPipelineInfo);
 
+    static bool IsInlineDescriptorRequested(
+        const Device*                     pDevice,
+        uint32_t                          setIndex,
+        uint32_t                          binding);
+
     PipelineLayout(
         const Device*       pDevice,
         const Info&         info,
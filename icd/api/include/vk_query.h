@@ -38,6 +38,7 @@
 #include "include/vk_dispatch.h"
 #include "include/internal_mem_mgr.h"
 
+#include "palMutex.h"
 #include "palQueryPool.h"
 
 namespace vk
@@ -47,6 +48,7 @@ class CmdBuffer;
 class Device;
 class DispatchableQueryPool;
 class PalQueryPool;
+class Queue;
 class TimestampQueryPool;
 
 // =====================================================================================================================
@@ -196,24 +198,50 @@ public:
     VK_INLINE const void* GetStorageView(uint32_t idx) const
         { return m_pStorageView[idx]; }
 
+    void SetLastWrite(
+        Queue*              pQueue,
+        uint64_t            submitSerial) const;
+
 private:
+    // The last submission on a queue that wrote timestamps to the pool
+    struct TimestampWrite
+    {
+        Queue*   pQueue;          // Writing queue, or null for an unused slot
+        uint64_t submitSerial;    // Serial of the queue submission
+    };
+
     TimestampQueryPool(
         Device*               pDevice,
         VkQueryType           queryType,
         uint32_t              entryCount,
         const InternalMemory& internalMem,
-        void**                ppStorageView)
+        void**                ppStorageView,
+        TimestampWrite*       pWrites,
+        uint32_t              writeCount)
         :
         QueryPool(pDevice, queryType),
         m_entryCount(entryCount),
-        m_internalMem(internalMem)
+        m_internalMem(internalMem),
+        m_pWrites(pWrites),
+        m_writeCount(writeCount)
     {
       memcpy(m_pStorageView, ppStorageView, sizeof(m_pStorageView));
     }
 
-    const uint32_t    m_entryCount;
-    InternalMemory    m_internalMem;
-    const void*       m_pStorageView[MaxPalDevices];
+    bool FindPendingWrite(
+        Queue**             ppQueue,
+        uint64_t*           pSubmitSerial);
+
+    VkResult WaitForTimestamps(
+        volatile const uint64_t* pTimestamps,
+        uint32_t                 count);
+
+    const uint32_t      m_entryCount;
+    InternalMemory      m_internalMem;
+    const void*         m_pStorageView[MaxPalDevices];
+    mutable Util::Mutex m_writeLock;      // Protects the write tracking below, updated by queue submissions
+    TimestampWrite*     m_pWrites;        // One slot per queue of the device
+    const uint32_t      m_writeCount;     // Number of write slots
 };
 
 // =====================================================================================================================
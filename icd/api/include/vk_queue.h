@@ -41,6 +41,7 @@
 #include "include/vk_utils.h"
 #include "include/virtual_stack_mgr.h"
 
+#include "palMutex.h"
 #include "palQueue.h"
 
 namespace Pal
@@ -58,6 +59,7 @@ class  Device;
 class  DevModeMgr;
 class  DispatchableQueue;
 class  Instance;
+class  Semaphore;
 class  SwapChain;
 class  FrtcFramePacer;
 class  TurboSync;
@@ -78,6 +80,8 @@ public:
 
     ~Queue();
 
+    Pal::Result Init();
+
     VkResult Submit(
         uint32_t            submitCount,
         const VkSubmitInfo* pSubmits,
@@ -85,14 +89,36 @@ public:
 
     VkResult WaitIdle(void);
 
+    void RetireSubmissions(uint64_t serial);
+
+    VK_INLINE bool IsSubmissionRetired(uint64_t serial) const
+        { return serial <= m_retiredSubmitSerial; }
+
+    bool IsSubmissionComplete(uint64_t serial);
+
+    VK_INLINE uint64_t GetNextSubmitSerial() const
+        { return m_lastSubmitSerial + 1; }
+
+    Pal::IFence* FindSubmissionFence(
+        uint64_t  serial,
+        uint64_t* pFenceSerial = nullptr);
+
+    Pal::Result WaitForSubmission(
+        uint64_t serial,
+        uint64_t timeout);
+
+    void RequestDeferredFlush();
+
     VkResult PalSignalSemaphores(
         uint32_t                          semaphoreCount,
         const VkSemaphore*                pSemaphores,
+        const uint64_t*                   pSemaphoreValues,
         const VkDeviceGroupSubmitInfoKHX* pDeviceGroupInfo);
 
     VkResult PalWaitSemaphores(
         uint32_t                          semaphoreCount,
         const VkSemaphore*                pSemaphores,
+        const uint64_t*                   pSemaphoreValues,
         const VkDeviceGroupSubmitInfoKHX* pDeviceGroupInfo);
 
     VkResult Present(
@@ -157,6 +183,73 @@ protected:
         uint32_t u32All;
     };
 
+    // A fence of this queue tracking the completion of a submission that signals timeline semaphores
+    struct SubmitFence
+    {
+        Pal::IFence* pPalFence;  // Submitted along with the batch, or right after it
+        uint64_t     serial;     // Serial of the submission the fence follows
+        bool         submitted;  // The fence was submitted for serial and has not been reused since
+        SubmitFence* pNext;      // Next fence of the queue
+    };
+
+    enum class DeferredOpType : uint32_t
+    {
+        Submit,
+        BindSparse
+    };
+
+    // A queue operation held back until every timeline semaphore value it waits on has a signal submitted.  The
+    // operation's infos are deep-copied into the same allocation, right after this header.
+    struct DeferredOp
+    {
+        DeferredOpType  type;
+        uint32_t        infoCount;
+        VkFence         fence;
+        DeferredOp*     pNext;
+
+        union
+        {
+            const VkSubmitInfo*     pSubmits;
+            const VkBindSparseInfo* pBindInfos;
+        };
+    };
+
+    VkResult SubmitBatches(
+        uint32_t            submitCount,
+        const VkSubmitInfo* pSubmits,
+        VkFence             fence);
+
+    VkResult BindSparseBatches(
+        uint32_t                bindInfoCount,
+        const VkBindSparseInfo* pBindInfo,
+        VkFence                 fence);
+
+    VkResult PresentImages(
+        const VkPresentInfoKHR* pPresentInfo);
+
+    VkResult DeferOp(
+        DeferredOpType          type,
+        uint32_t                infoCount,
+        const void*             pInfos,
+        VkFence                 fence);
+
+    void FlushDeferredOps();
+
+    void ProcessDeferredFlushRequests();
+
+    void WaitForDeferredOps();
+
+    void ReportDeferredResult(
+        const DeferredOp*       pOp,
+        VkResult                result);
+
+    Pal::Result AcquireSubmitFence(SubmitFence** ppSubmitFence);
+
+    void CommitSubmitFence(
+        SubmitFence*            pSubmitFence,
+        uint64_t                serial,
+        bool                    submitted);
+
     VK_INLINE VkResult BindSparseEntry(
         const VkBindSparseInfo& bindInfo,
         VkDeviceSize            prtTileSize,
@@ -186,6 +279,18 @@ protected:
 
     VkResult CreateDummyCmdBuffer();
 
+    VkResult CreateEventRecycleCmdBuffer(uint32_t deviceIdx);
+
+    bool NeedEventRecycleWaits(
+        uint32_t               cmdBufferCount,
+        const VkCommandBuffer* pCommandBuffers,
+        bool*                  pNeedWait);
+
+    Pal::Result SignalTimelineSemaphore(
+        uint32_t               deviceIdx,
+        Semaphore*             pSemaphore,
+        uint64_t               value);
+
     VkResult NotifyFlipMetadata(
         const Pal::IGpuMemory*       pGpuMemory,
         FullscreenFrameMetadataFlags flags);
@@ -207,6 +312,17 @@ protected:
     FrtcFramePacer*                    m_pFrtcFramePacer;
     Pal::PerSourceFrameMetadataControl m_palFrameMetadataControl;
     Pal::ICmdBuffer*                   m_pDummyCmdBuffer;
+    Pal::ICmdBuffer*                   m_pEventRecycleCmdBuffers[MaxPalDevices]; // Waits for prior work on the queue
+    uint64_t                           m_lastSubmitSerial;    // Serial of the last command buffer batch submitted
+    volatile uint64_t                  m_retiredSubmitSerial; // Serial of the last batch known to be complete
+    Util::Mutex                        m_retireLock;          // Serializes updates of m_retiredSubmitSerial
+    Util::Mutex                        m_submitFenceLock;     // Protects m_pSubmitFences
+    SubmitFence*                       m_pSubmitFences;       // Fences tracking timeline semaphore signals
+    Util::Mutex                        m_deferLock;           // Serializes queue operations with deferred ones
+    DeferredOp*                        m_pDeferredHead;       // Oldest operation held back by a timeline wait
+    DeferredOp*                        m_pDeferredTail;
+    volatile uint32_t                  m_deferredOpCount;     // Number of operations held back
+    volatile uint32_t                  m_flushRequested;      // A flush was requested while m_deferLock was held
 
 };
 
@@ -88,7 +88,7 @@ public:
         VkRenderPass*                 pRenderPass);
 
     VkResult Destroy(
-        const Device*                 pDevice,
+        Device*                       pDevice,
         const VkAllocationCallbacks*  pAllocator);
 
     VkFormat GetColorAttachmentFormat(uint32_t subPassIndex, uint32_t colorTarget) const;
@@ -140,11 +140,13 @@ public:
 
 protected:
     RenderPass(
-        const RenderPassCreateInfo& info,
-        RenderPassExecuteInfo*      pState);
+        const RenderPassCreateInfo&  info,
+        const RenderPassExecuteInfo* pState,
+        bool                         sharedExecuteInfo);
 
-    RenderPassCreateInfo     m_createInfo;
-    RenderPassExecuteInfo*   m_pExecuteInfo;
+    RenderPassCreateInfo         m_createInfo;
+    const RenderPassExecuteInfo* m_pExecuteInfo;
+    bool                         m_sharedExecuteInfo; // Execute info is owned by the device's RenderPassExecuteCache
 };
 
 namespace entry
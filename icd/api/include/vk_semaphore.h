@@ -32,6 +32,7 @@
 #include "include/vk_dispatch.h"
 
 #include "palQueueSemaphore.h"
+#include "palMutex.h"
 
 namespace Pal
 {
@@ -44,10 +45,38 @@ namespace vk
 {
 
 class Device;
+class Queue;
 
 class Semaphore : public NonDispatchable<VkSemaphore, Semaphore>
 {
 public:
+    // Number of signal points allocated at once for a timeline semaphore.  Another block of points is allocated
+    // whenever all existing ones have a queue signal outstanding.
+    static constexpr uint32_t TimelinePointsPerBlock = 16;
+
+    // A queue waiting on the PAL semaphore of a timeline signal point, identified by the serial of the last submission
+    // on the queue that waits on it
+    struct TimelineWaiter
+    {
+        Queue*                pQueue;           // Waiting queue, or null for an unused slot
+        uint64_t              submitSerial;     // The waits have executed once this submission completes
+    };
+
+    // A value of a timeline semaphore signaled by a queue.  Queue waits use the PAL semaphore, host waits and payload
+    // queries track the queue submission the signal follows.
+    struct TimelinePoint
+    {
+        uint64_t              value;            // Payload value reached when this point is signaled
+        Pal::IQueueSemaphore* pPalSemaphore;    // Signaled by the queue once the value is reached
+        Queue*                pQueue;           // Queue the signal was submitted to
+        uint64_t              submitSerial;     // Serial of the queue submission the signal follows
+        bool                  pending;          // A queue signal of this point is outstanding
+        bool                  reserved;         // The point is being submitted by a queue
+        bool                  needsDrain;       // pPalSemaphore still holds the count of a previous signal
+        TimelineWaiter*       pWaiters;         // One slot per queue of the device.  The point is not reused until
+                                                // all of their waits have executed.
+    };
+
     static VkResult Create(
         Device*                         pDevice,
         const VkSemaphoreCreateInfo*    pCreateInfo,
@@ -75,6 +104,11 @@ public:
         m_pPalTemporarySemaphore = pPalTemporarySemaphore;
     }
 
+    VK_FORCEINLINE bool IsTimeline() const
+    {
+        return (m_pTimeline != nullptr);
+    }
+
     VkResult Destroy(
         const Device*                   pDevice,
         const VkAllocationCallbacks*    pAllocator);
@@ -84,19 +118,93 @@ public:
         VkExternalSemaphoreHandleTypeFlagBitsKHR    handleType,
         Pal::OsExternalHandle*                      pHandle);
 
+    VkResult GetCounterValue(uint64_t* pValue);
+
+    VkResult Wait(
+        Device*                         pDevice,
+        uint64_t                        value,
+        uint64_t                        timeout);
+
+    void Signal(
+        Device*                         pDevice,
+        uint64_t                        value);
+
+    static VkResult WaitSemaphores(
+        Device*                         pDevice,
+        const VkSemaphoreWaitInfoKHR*   pWaitInfo,
+        uint64_t                        timeout);
+
+    void SetTimelineError(VkResult result);
+
+    bool HasTimelineSignal(uint64_t value);
+
+    Pal::IQueueSemaphore* AcquireTimelineWait(
+        uint64_t                        value,
+        Queue*                          pQueue,
+        uint64_t                        submitSerial);
+
+    Pal::Result AcquireTimelineSignal(
+        Device*                         pDevice,
+        TimelinePoint**                 ppPoint);
+
+    void ReleaseTimelineSignal(
+        TimelinePoint*                  pPoint,
+        uint64_t                        value,
+        Queue*                          pQueue,
+        uint64_t                        submitSerial,
+        bool                            submitted);
+
 private:
-    Semaphore(Pal::IQueueSemaphore* pPalSemaphore)
+    // A block of timeline signal points, followed in memory by the waiter slots and PAL semaphores of its points
+    struct TimelinePointBlock
+    {
+        TimelinePoint       points[TimelinePointsPerBlock]; // Queue signal operations, in no particular order
+        TimelinePointBlock* pNext;                          // Next block, allocated once all points were pending
+    };
+
+    // Host-side tracker of a timeline semaphore payload
+    struct TimelineState
+    {
+        Util::Mutex        lock;            // Protects the state below
+        volatile uint64_t  completedValue;  // Largest value known to be reached
+        VkResult           error;           // Error of a held back queue signal that failed once released.  Values
+                                            // no signal is pending for are never going to be reached.
+        uint32_t           waiterCount;     // Number of waiter slots of each signal point
+        TimelinePointBlock firstBlock;      // First block of signal points, allocated along with the semaphore
+    };
+
+    Semaphore(Pal::IQueueSemaphore* pPalSemaphore, TimelineState* pTimeline)
         :
         m_pPalSemaphore(pPalSemaphore),
-        m_pPalTemporarySemaphore(nullptr)
+        m_pPalTemporarySemaphore(nullptr),
+        m_pTimeline(pTimeline)
     {
 
     }
 
+    static size_t GetTimelineBlockDataSize(Device* pDevice);
+
+    static Pal::Result InitTimelinePointBlock(
+        Device*                         pDevice,
+        TimelinePointBlock*             pBlock,
+        void*                           pData);
+
+    static void DestroyTimelinePointBlock(TimelinePointBlock* pBlock);
+
+    void RetireTimelinePoints();
+    bool HasTimelineWaiters(TimelinePoint* pPoint) const;
+    TimelinePoint* FindTimelinePoint(uint64_t value) const;
+
+    VkResult CheckTimelineValue(
+        uint64_t                        value,
+        Queue**                         ppQueue,
+        uint64_t*                       pSubmitSerial);
+
     Pal::IQueueSemaphore*       m_pPalSemaphore;
     Pal::IQueueSemaphore*       m_pPalTemporarySemaphore;     // Temporary-completion semaphore special for swapchain
                                                               // which will be associated with a signaled semaphore
                                                               // in AcquireNextImage.
+    TimelineState*              m_pTimeline;                  // Payload tracker, only for timeline semaphores
 };
 
 namespace entry
@@ -110,6 +218,20 @@ VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreFdKHR(
     VkDevice                                    device,
     const VkSemaphoreGetFdInfoKHR*              pGetFdInfo,
     int*                                        pFd);
+
+VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValueKHR(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    uint64_t*                                   pValue);
+
+VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphoresKHR(
+    VkDevice                                    device,
+    const VkSemaphoreWaitInfoKHR*               pWaitInfo,
+    uint64_t                                    timeout);
+
+VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphoreKHR(
+    VkDevice                                    device,
+    const VkSemaphoreSignalInfoKHR*             pSignalInfo);
 } // namespace entry
 
 } // namespace vk
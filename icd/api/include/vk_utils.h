@@ -201,6 +201,18 @@ VK_INLINE int StrCmpCaseInsensitive(
     }
 }
 
+// =====================================================================================================================
+// Returns how much of a timeout (in nanoseconds) that started at the given CPU timestamp is left, or zero if it has
+// expired.
+VK_INLINE uint64_t GetRemainingTimeNs(int64_t startTime, uint64_t timeout)
+{
+    const double   ticks       = static_cast<double>(Util::GetPerfCpuTime() - startTime);
+    const uint64_t elapsedTime = static_cast<uint64_t>(ticks * 1000000000.0 /
+                                                       static_cast<double>(Util::GetPerfFrequency()));
+
+    return (elapsedTime < timeout) ? (timeout - elapsedTime) : 0;
+}
+
 // =====================================================================================================================
 class IterateMask
 {
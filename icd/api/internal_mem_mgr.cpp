@@ -209,9 +209,9 @@ void InternalMemMgr::Destroy()
 
         MemoryPoolList* pPoolList = mapIt.Get()->value;
 
-        while (pPoolList->NumElements() != 0)
+        while (pPoolList->pools.NumElements() != 0)
         {
-            auto it = pPoolList->Begin();
+            auto it = pPoolList->pools.Begin();
 
             InternalMemoryPool* pPool = it.Get();
 
@@ -226,7 +226,7 @@ void InternalMemMgr::Destroy()
             PAL_DELETE(pPool->pBuddyAllocator, m_pSysMemAllocator);
 
             // Remove item from list
-            pPoolList->Erase(&it);
+            pPoolList->pools.Erase(&it);
         }
 
         // Free this list
@@ -322,8 +322,13 @@ VkResult InternalMemMgr::CreateMemoryPoolList(
 
     if (pPoolList != nullptr)
     {
-        // Add this pool list to the pool list map
-        Pal::Result palResult = m_poolListMap.Insert(poolProps, pPoolList);
+        Pal::Result palResult = pPoolList->lock.Init();
+
+        if (palResult == Pal::Result::Success)
+        {
+            // Add this pool list to the pool list map
+            palResult = m_poolListMap.Insert(poolProps, pPoolList);
+        }
 
         if (palResult != Pal::Result::Success)
         {
@@ -350,7 +355,7 @@ VkResult InternalMemMgr::CreateMemoryPoolList(
 // An initial sub-allocation will be made from the pool and information for that sub-allocation will be returned by this
 // function.
 //
-// WARNING: This function is NOT thread-safe and assumes the caller is holding a lock on m_allocatorLock.
+// WARNING: This function is NOT thread-safe and assumes the caller is holding the lock of the given pool list.
 VkResult InternalMemMgr::CreateMemoryPoolAndSubAllocate(
     MemoryPoolList*              pOwnerList,
     const InternalMemCreateInfo& initialSubAllocInfo,
@@ -368,6 +373,8 @@ VkResult InternalMemMgr::CreateMemoryPoolAndSubAllocate(
     InternalMemoryPool newPool  = {};
     Pal::gpusize subAllocOffset = 0;
 
+    newPool.pLock = &pOwnerList->lock;
+
     // Allocate the base GPU memory object for this pool
     VkResult result = VK_SUCCESS;
 
@@ -406,11 +413,11 @@ VkResult InternalMemMgr::CreateMemoryPoolAndSubAllocate(
 
     if (result == VK_SUCCESS)
     {
-        Pal::Result palResult = pOwnerList->PushFront(newPool);
+        Pal::Result palResult = pOwnerList->pools.PushFront(newPool);
         result = PalToVkResult(palResult);
         VK_ASSERT(result == VK_SUCCESS);
 
-        pInternalMemory = pOwnerList->Begin().Get();
+        pInternalMemory = pOwnerList->pools.Begin().Get();
 
         // Allocate the base GPU memory object for this pool
         result = AllocBaseGpuMem(poolInfo.pal, poolInfo.flags.readOnly, pInternalMemory);
@@ -430,8 +437,8 @@ VkResult InternalMemMgr::CreateMemoryPoolAndSubAllocate(
     }
     else
     {
-        auto it = pOwnerList->Begin();
-        bool needEraseFromOwnerList = pOwnerList->NumElements() > 0 ?
+        auto it = pOwnerList->pools.Begin();
+        bool needEraseFromOwnerList = pOwnerList->pools.NumElements() > 0 ?
             (it.Get()->groupMemory.PalMemory() == pInternalMemory->groupMemory.PalMemory()) : false;
 
         // Unmap any persistently mapped memory
@@ -449,7 +456,7 @@ VkResult InternalMemMgr::CreateMemoryPoolAndSubAllocate(
         // Remove this memory pool from the list if we added it
         if (needEraseFromOwnerList)
         {
-            pOwnerList->Erase(&it);
+            pOwnerList->pools.Erase(&it);
         }
     }
 
@@ -488,8 +495,6 @@ VkResult InternalMemMgr::AllocGpuMem(
 {
     VK_ASSERT(pInternalMemory != nullptr);
 
-    Util::MutexAuto lock(&m_allocatorLock); // Ensure thread-safety using the lock
-
     VkResult result = VK_SUCCESS;
 
     // If the requested allocation is small enough (at most half the size of a single pool) then try to find an
@@ -504,6 +509,8 @@ VkResult InternalMemMgr::AllocGpuMem(
         if (createInfo.pPoolInfo != nullptr)
         {
 #if DEBUG
+            Util::MutexAuto lock(&m_allocatorLock);
+
             CheckProvidedSubAllocPoolInfo(createInfo);
 #endif
             pPoolList = reinterpret_cast<MemoryPoolList*>(createInfo.pPoolInfo);
@@ -515,16 +522,19 @@ VkResult InternalMemMgr::AllocGpuMem(
 
             GetMemoryPoolPropertiesFromAllocInfo(createInfo, &poolProps);
 
-            result = CalcSubAllocationPoolInternal(poolProps, &pPoolList);
+            result = CalcSubAllocationPool(poolProps, reinterpret_cast<void**>(&pPoolList));
         }
 
         if (result == VK_SUCCESS)
         {
+            // Only sub-allocations from pools with the same properties need to be serialized
+            Util::MutexAuto lock(&pPoolList->lock);
+
             // Assume that we won't find an appropriate pool
             result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
 
             // If found an appropriate pool list then search for a memory pool to suballocate from
-            for (auto it = pPoolList->Begin(); it.Get() != nullptr; it.Next())
+            for (auto it = pPoolList->pools.Begin(); it.Get() != nullptr; it.Next())
             {
                 InternalMemoryPool* pPool = it.Get();
 
@@ -559,8 +569,10 @@ VkResult InternalMemMgr::AllocGpuMem(
     }
     else
     {
-        // We don't suballocate from a pool so there's no buddy allocator and also offset is always zero
+        // We don't suballocate from a pool so there's no buddy allocator and also offset is always zero.  Base
+        // allocations don't touch any shared memory manager state, so no lock is needed.
         pInternalMemory->m_memoryPool.pBuddyAllocator    = nullptr;
+        pInternalMemory->m_memoryPool.pLock              = nullptr;
         pInternalMemory->m_offset = 0;
 
         // Issue a base memory allocation and use that as the memory object
@@ -656,12 +668,12 @@ VkResult InternalMemMgr::AllocAndBindGpuMem(
 void InternalMemMgr::FreeGpuMem(
     const InternalMemory* pInternalMemory)
 {
-    Util::MutexAuto lock(&m_allocatorLock);
-
     VK_ASSERT(pInternalMemory != nullptr);
 
     if (pInternalMemory->m_memoryPool.pBuddyAllocator != nullptr)
     {
+        Util::MutexAuto lock(pInternalMemory->m_memoryPool.pLock);
+
         // The memory was suballocated so free it using the buddy allocator
         pInternalMemory->m_memoryPool.pBuddyAllocator->Free(
             pInternalMemory->m_offset,
@@ -741,9 +753,15 @@ VkResult InternalMemMgr::AllocBaseGpuMem(
             (deviceIdx < m_pDevice->NumPalDevices()) && (palResult == Pal::Result::Success);
             deviceIdx++)
         {
+            const Pal::IGpuMemory* pPalMemory = pGpuMemory->groupMemory.m_pPalMemory[deviceIdx];
+
             // Add the newly created memory object to the residency list
             m_pDevice->AddMemReference(
                     m_pDevice->PalDevice(deviceIdx), pGpuMemory->groupMemory.m_pPalMemory[deviceIdx], readOnly);
+
+            // Internal allocations count against the heap usage reported through VK_EXT_memory_budget
+            m_pDevice->VkPhysicalDevice(deviceIdx)->AddMemoryUsage(pPalMemory->Desc().preferredHeap,
+                                                                   pPalMemory->Desc().size);
         }
 
         if (palResult != Pal::Result::Success)
@@ -769,12 +787,17 @@ void InternalMemMgr::FreeBaseGpuMem(
 
     for (uint32_t deviceIdx = 0; deviceIdx < m_pDevice->NumPalDevices(); deviceIdx++)
     {
+        const Pal::IGpuMemory* pPalMemory = pGpuMemory->groupMemory.m_pPalMemory[deviceIdx];
+
         // Remove memory object from the residency list
-        if (pGpuMemory->groupMemory.m_pPalMemory[deviceIdx] != nullptr)
+        if (pPalMemory != nullptr)
         {
             m_pDevice->RemoveMemReference(
                 m_pDevice->PalDevice(deviceIdx),
                 pGpuMemory->groupMemory.m_pPalMemory[deviceIdx]);
+
+            m_pDevice->VkPhysicalDevice(deviceIdx)->RemoveMemoryUsage(pPalMemory->Desc().preferredHeap,
+                                                                      pPalMemory->Desc().size);
         }
     }
 
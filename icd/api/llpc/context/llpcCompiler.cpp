@@ -40,6 +40,7 @@
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/TargetSelect.h"
 
+#include <algorithm>
 #include <sstream>
 #include "spirv.hpp"
 #include "SPIRV.h"
@@ -56,7 +57,9 @@
 #include "llpcGraphicsContext.h"
 #include "llpcElf.h"
 #include "llpcFile.h"
+#include "llpcInOutPropagator.h"
 #include "llpcPatch.h"
+#include "llpcPipelineDumper.h"
 #ifdef LLPC_BUILD_GFX9
 #include "llpcShaderMerger.h"
 #endif
@@ -139,9 +142,27 @@ opt<bool> DisableGsOnChip("disable-gs-onchip",
                           desc("Disable geometry shader on-chip mode"),
                           init(true));
 
+// -disable-inout-propagate: disable propagation of constant outputs to fragment shader inputs
+opt<bool> DisableInOutPropagate("disable-inout-propagate",
+                                desc("Disable propagation of constant outputs to fragment shader inputs"),
+                                init(false));
+
 // -enable-spirv-opt: enable optimization for SPIR-V binary
 opt<bool> EnableSpirvOpt("enable-spirv-opt", desc("Enable optimization for SPIR-V binary"), init(false));
 
+// -context-reuse-limit: maximum number of pipeline compiles a context is reused for
+static opt<uint32_t> ContextReuseLimit("context-reuse-limit",
+                                       desc("Maximum number of pipeline compiles an LLVM context is reused for "
+                                            "before it is recreated (0 - unlimited)"),
+                                       init(1000));
+
+// -context-footprint-limit: maximum estimated footprint of a context, in KB
+static opt<uint32_t> ContextFootprintLimit("context-footprint-limit",
+                                           desc("Maximum size in KB of shader binaries translated into an LLVM "
+                                                "context before it is recreated (0 - unlimited)"),
+                                           value_desc("KB"),
+                                           init(16 * 1024));
+
 // -auto-layout-desc
 extern opt<bool> AutoLayoutDesc;
 
@@ -242,6 +263,71 @@ bool VKAPI_CALL ICompiler::IsVertexFormatSupported(
     return ((pInfo->dfmt == BUF_DATA_FORMAT_INVALID) && (pInfo->numChannels == 0)) ? false : true;
 }
 
+// =====================================================================================================================
+// Gets the statistics of the specified shader stage from a pipeline binary built by LLPC.
+Result VKAPI_CALL ICompiler::GetShaderStats(
+    const BinaryData* pPipelineBin,   // [in] Pipeline binary (ELF)
+    ShaderStage       shaderStage,    // Shader stage whose statistics are queried
+    ShaderStats*      pStats)         // [out] Statistics of the specified shader stage
+{
+    Result result = Result::Success;
+
+    if ((pPipelineBin == nullptr) || (pPipelineBin->pCode == nullptr) || (pStats == nullptr))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    // NOTE: Graphics IP version is only used by ELF dump, so a dummy one is fine here.
+    const GfxIpVersion gfxIp = {};
+    ElfReader<Elf64> reader(gfxIp);
+
+    const void* pNoteData = nullptr;
+    size_t noteSize = 0;
+
+    if (result == Result::Success)
+    {
+        size_t readSize = 0;
+        result = reader.ReadFromBuffer(pPipelineBin->pCode, &readSize);
+    }
+
+    if (result == Result::Success)
+    {
+        result = reader.GetSectionData(NoteName, &pNoteData, &noteSize);
+    }
+
+    if (result == Result::Success)
+    {
+        result = Result::ErrorUnavailable;
+
+        const uint8_t* pNoteBase = static_cast<const uint8_t*>(pNoteData);
+        const uint32_t noteHeaderSize = sizeof(NoteHeader);
+        size_t offset = 0;
+        while ((offset + noteHeaderSize <= noteSize) && (result == Result::ErrorUnavailable))
+        {
+            const NoteHeader* pNote = reinterpret_cast<const NoteHeader*>(pNoteBase + offset);
+            if (static_cast<uint32_t>(pNote->type) == ShaderStatsNoteType)
+            {
+                const uint32_t statsCount = pNote->descSize / sizeof(ShaderStats);
+                const ShaderStats* pAllStats =
+                    reinterpret_cast<const ShaderStats*>(pNoteBase + offset + noteHeaderSize);
+                for (uint32_t i = 0; i < statsCount; ++i)
+                {
+                    if (pAllStats[i].shaderStage == shaderStage)
+                    {
+                        memcpy(pStats, &pAllStats[i], sizeof(ShaderStats));
+                        result = Result::Success;
+                        break;
+                    }
+                }
+                break;
+            }
+            offset += noteHeaderSize + Pow2Align(pNote->descSize, sizeof(uint32_t));
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 Compiler::Compiler(
     const char*       pClient,      // [in] Name of the client who calls LLPC
@@ -324,6 +410,9 @@ Compiler::~Compiler()
         m_contextPool.clear();
     }
 
+    // Make sure pending pipeline dumps are written before the client may exit
+    PipelineDumper::Get()->Flush();
+
     if (strcmp(m_pClientName, VkIcdName) == 0)
     {
         // NOTE: Skip subsequent cleanup work for Vulkan ICD. The work will be done by system itself
@@ -427,6 +516,7 @@ Result Compiler::BuildGraphicsPipeline(
     const GraphicsPipelineBuildInfo* pPipelineInfo, // [in] Info to build this graphics pipeline
     GraphicsPipelineBuildOut*        pPipelineOut)  // [out] Output of building this graphics pipeline
 {
+    const int64_t    startTime = GetPerfCpuTime();
     Result           result  = Result::Success;
     CacheEntryHandle hEntry  = nullptr;
     void*            pElf    = nullptr;
@@ -523,15 +613,18 @@ Result Compiler::BuildGraphicsPipeline(
         LLPC_OUTS("\n");
     }
 
-    raw_fd_ostream* pPipelineDumpFile = nullptr;
+    // NOTE: Pipeline info is formatted here, before shader replacement, and written by the pipeline dumper together
+    // with the pipeline binary once the compile is done.
+    bool        dumpPipeline = false;
+    std::string pipelineDumpInfo;
 
-    if ((result == Result::Success) && cl::EnablePipelineDump)
+    if ((result == Result::Success) && cl::EnablePipelineDump &&
+        PipelineDumper::Get()->BeginDump(Md5::Compact64(&hash)))
     {
-        pPipelineDumpFile = CreatePipelineDumpFile(cl::PipelineDumpDir.c_str(), nullptr, pPipelineInfo, &hash);
-        if (pPipelineDumpFile != nullptr)
-        {
-            DumpGraphicsPipelineInfo(pPipelineDumpFile, pPipelineInfo);
-        }
+        dumpPipeline = true;
+
+        raw_string_ostream dumpStream(pipelineDumpInfo);
+        DumpGraphicsPipelineInfo(&dumpStream, pPipelineInfo);
     }
 
     ShaderEntryState cacheEntryState = ShaderEntryState::New;
@@ -602,9 +695,11 @@ Result Compiler::BuildGraphicsPipeline(
             // Binary type must same for all shader stages
             LLPC_ASSERT((binType == BinaryType::Unknown) || (pModuleData->binType == binType));
             binType = pModuleData->binType;
+            pContext->AddFootprint(pModuleData->binCode.codeSize);
             if (binType == BinaryType::Spirv)
             {
-                TimeProfiler timeProfiler(&g_timeProfileResult.translateTime);
+                auto pStageTimeProfile = pContext->GetShaderTimeProfile(static_cast<ShaderStage>(stage));
+                TimeProfiler timeProfiler(&g_timeProfileResult.translateTime, &pStageTimeProfile->translateTime);
                 result = TranslateSpirvToLlvm(&pModuleData->binCode,
                                               static_cast<ShaderStage>(stage),
                                               pShaderInfo->pEntryTarget,
@@ -647,7 +742,8 @@ Result Compiler::BuildGraphicsPipeline(
             // Do SPIR-V lowering operations for this LLVM module
             if ((result == Result::Success) && (skipLower == false))
             {
-                TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime,
+                                          &pContext->GetShaderTimeProfile(static_cast<ShaderStage>(stage))->lowerTime);
                 result = SpirvLower::Run(pModule);
                 if (result != Result::Success)
                 {
@@ -671,7 +767,8 @@ Result Compiler::BuildGraphicsPipeline(
         std::unique_ptr<Module> pNullFsModule;
         if ((result == Result::Success) && (cl::AutoLayoutDesc == false) && (modules[ShaderStageFragment] == nullptr))
         {
-            TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime);
+            TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime,
+                                      &pContext->GetShaderTimeProfile(ShaderStageFragment)->lowerTime);
             result = BuildNullFs(pContext, pNullFsModule);
             if (result == Result::Success)
             {
@@ -683,6 +780,29 @@ Result Compiler::BuildGraphicsPipeline(
             }
         }
 
+        // Propagate constant outputs of the last pre-rasterization stage to fragment shader inputs
+        // NOTE: Outputs of geometry shader are exported by the copy shader, they are not handled here.
+        if ((result == Result::Success) &&
+            (cl::DisableInOutPropagate == false) &&
+            (skipPatch == false) &&
+            (modules[ShaderStageGeometry] == nullptr) &&
+            (modules[ShaderStageFragment] != nullptr))
+        {
+            Module* pProducerModule = (modules[ShaderStageTessEval] != nullptr) ?
+                                          modules[ShaderStageTessEval] : modules[ShaderStageVertex];
+            if (pProducerModule != nullptr)
+            {
+                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageFragment)->patchTime);
+                InOutPropagator inOutPropagator(pContext);
+                result = inOutPropagator.Run(pProducerModule, modules[ShaderStageFragment]);
+                if (result != Result::Success)
+                {
+                    LLPC_ERRS("Fails to propagate constant outputs to fragment shader\n");
+                }
+            }
+        }
+
         // Do LLVM module pacthing (preliminary patch work)
         for (int32_t stage = ShaderStageGfxCount - 1; (stage >= 0) && (result == Result::Success); --stage)
         {
@@ -692,7 +812,8 @@ Result Compiler::BuildGraphicsPipeline(
                 continue;
             }
 
-            TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+            TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                      &pContext->GetShaderTimeProfile(static_cast<ShaderStage>(stage))->patchTime);
             result = Patch::PreRun(pModule);
             if (result != Result::Success)
             {
@@ -725,7 +846,8 @@ Result Compiler::BuildGraphicsPipeline(
                 continue;
             }
 
-            TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+            TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                      &pContext->GetShaderTimeProfile(static_cast<ShaderStage>(stage))->patchTime);
             result = Patch::Run(pModule);
             if (result != Result::Success)
             {
@@ -763,7 +885,8 @@ Result Compiler::BuildGraphicsPipeline(
 
                 Module* pLsHsModule = nullptr;
 
-                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageTessControl)->patchTime);
                 result = shaderMerger.BuildLsHsMergedShader(pLsModule, pHsModule, &pLsHsModule);
 
                 if (result != Result::Success)
@@ -792,7 +915,8 @@ Result Compiler::BuildGraphicsPipeline(
 
                 Module* pEsGsModule = nullptr;
 
-                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageGeometry)->patchTime);
                 result = shaderMerger.BuildEsGsMergedShader(pEsModule, pGsModule, &pEsGsModule);
 
                 if (result != Result::Success)
@@ -829,7 +953,8 @@ Result Compiler::BuildGraphicsPipeline(
             raw_svector_ostream elfStream(shaderElf);
             std::string errMsg;
 
-            TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime);
+            TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime,
+                                      &pContext->GetShaderTimeProfile(static_cast<ShaderStage>(stage))->codeGenTime);
             result = CodeGenManager::GenerateCode(pModule, elfStream, errMsg);
             if (result != Result::Success)
             {
@@ -848,7 +973,8 @@ Result Compiler::BuildGraphicsPipeline(
         {
             ElfPackage shaderElf;
 
-            TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime);
+            TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime,
+                                      &pContext->GetShaderTimeProfile(ShaderStageCopyShader)->codeGenTime);
             result = BuildCopyShader(pContext, &shaderElf);
             if (result != Result::Success)
             {
@@ -924,18 +1050,39 @@ Result Compiler::BuildGraphicsPipeline(
 
         pPipelineOut->pipelineBin.codeSize = elfSize;
         pPipelineOut->pipelineBin.pCode = pCode;
-    }
 
-    if (pPipelineDumpFile != nullptr)
-    {
-        if (result == Result::Success)
+        // Report whether the pipeline was found in the application's cache and how much CPU time each shader stage
+        // took.  Hits in the compiler's internal cache do not count, as the application did not provide them.
+        const bool cacheHit = (cacheEntryState == ShaderEntryState::Ready) &&
+                              (pShaderCache == pPipelineInfo->pShaderCache);
+        for (uint32_t stage = 0; stage < ShaderStageGfxCount; ++stage)
         {
-            DumpPipelineBinary(pPipelineDumpFile,
-                               m_gfxIp,
-                               &pPipelineOut->pipelineBin);
+            if (shaderInfo[stage]->pModuleData != nullptr)
+            {
+                FillStageBuildFeedback(&graphicsContext,
+                                       static_cast<ShaderStage>(stage),
+                                       cacheHit,
+                                       &pPipelineOut->stageFeedback[stage]);
+            }
+            else
+            {
+                memset(&pPipelineOut->stageFeedback[stage], 0, sizeof(PipelineBuildFeedback));
+            }
         }
+        FillPipelineBuildFeedback(startTime,
+                                  cacheHit,
+                                  pPipelineOut->stageFeedback,
+                                  ShaderStageGfxCount,
+                                  &pPipelineOut->pipelineFeedback);
+    }
 
-        DestroyPipelineDumpFile(pPipelineDumpFile);
+    if (dumpPipeline)
+    {
+        PipelineDumper::Get()->WritePipeline(
+            GetPipelineDumpFileName(cl::PipelineDumpDir.c_str(), nullptr, pPipelineInfo, &hash),
+            std::move(pipelineDumpInfo),
+            m_gfxIp,
+            (result == Result::Success) ? &pPipelineOut->pipelineBin : nullptr);
     }
 
     // Free shader replacement allocations and restore original shader module
@@ -965,6 +1112,7 @@ Result Compiler::BuildComputePipeline(
     const ComputePipelineBuildInfo* pPipelineInfo,  // [in] Info to build this compute pipeline
     ComputePipelineBuildOut*        pPipelineOut)   // [out] Output of building this compute pipeline
 {
+    const int64_t    startTime = GetPerfCpuTime();
     CacheEntryHandle hEntry = nullptr;
     void*            pElf    = nullptr;
     size_t           elfSize = 0;
@@ -1037,14 +1185,18 @@ Result Compiler::BuildComputePipeline(
         LLPC_OUTS("\n");
     }
 
-    raw_fd_ostream* pPipelineDumpFile = nullptr;
-    if ((result == Result::Success) && cl::EnablePipelineDump)
+    // NOTE: Pipeline info is formatted here, before shader replacement, and written by the pipeline dumper together
+    // with the pipeline binary once the compile is done.
+    bool        dumpPipeline = false;
+    std::string pipelineDumpInfo;
+
+    if ((result == Result::Success) && cl::EnablePipelineDump &&
+        PipelineDumper::Get()->BeginDump(Md5::Compact64(&hash)))
     {
-        pPipelineDumpFile = CreatePipelineDumpFile(cl::PipelineDumpDir.c_str(), pPipelineInfo, nullptr, &hash);
-        if (pPipelineDumpFile != nullptr)
-        {
-            DumpComputePipelineInfo(pPipelineDumpFile, pPipelineInfo);
-        }
+        dumpPipeline = true;
+
+        raw_string_ostream dumpStream(pipelineDumpInfo);
+        DumpComputePipelineInfo(&dumpStream, pPipelineInfo);
     }
 
     ShaderEntryState cacheEntryState = ShaderEntryState::New;
@@ -1092,9 +1244,11 @@ Result Compiler::BuildComputePipeline(
         const ShaderModuleData* pModuleData = reinterpret_cast<const ShaderModuleData*>(pPipelineInfo->cs.pModuleData);
         if (pModuleData != nullptr)
         {
+            pContext->AddFootprint(pModuleData->binCode.codeSize);
             if (pModuleData->binType == BinaryType::Spirv)
             {
-                TimeProfiler timeProfiler(&g_timeProfileResult.translateTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.translateTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageCompute)->translateTime);
 
                 result = TranslateSpirvToLlvm(&pModuleData->binCode,
                                               ShaderStageCompute,
@@ -1124,7 +1278,8 @@ Result Compiler::BuildComputePipeline(
                 // Do SPIR-V lowering operations for this LLVM module
                 if (result == Result::Success)
                 {
-                    TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime);
+                    TimeProfiler timeProfiler(&g_timeProfileResult.lowerTime,
+                                              &pContext->GetShaderTimeProfile(ShaderStageCompute)->lowerTime);
                     result = SpirvLower::Run(pModule);
                     if (result != Result::Success)
                     {
@@ -1168,7 +1323,8 @@ Result Compiler::BuildComputePipeline(
             // Preliminary patch work
             if (skipPatch == false)
             {
-                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageCompute)->patchTime);
                 result = Patch::PreRun(pModule);
             }
 
@@ -1183,7 +1339,8 @@ Result Compiler::BuildComputePipeline(
             {
                 if (skipPatch == false)
                 {
-                    TimeProfiler timeProfiler(&g_timeProfileResult.patchTime);
+                    TimeProfiler timeProfiler(&g_timeProfileResult.patchTime,
+                                              &pContext->GetShaderTimeProfile(ShaderStageCompute)->patchTime);
                     result = Patch::Run(pModule);
                 }
 
@@ -1204,7 +1361,8 @@ Result Compiler::BuildComputePipeline(
 
             if (result == Result::Success)
             {
-                TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime);
+                TimeProfiler timeProfiler(&g_timeProfileResult.codeGenTime,
+                                          &pContext->GetShaderTimeProfile(ShaderStageCompute)->codeGenTime);
                 raw_svector_ostream elfStream(shaderElf);
                 std::string errMsg;
                 result = CodeGenManager::GenerateCode(pModule, elfStream, errMsg);
@@ -1271,18 +1429,26 @@ Result Compiler::BuildComputePipeline(
 
         pPipelineOut->pipelineBin.codeSize = elfSize;
         pPipelineOut->pipelineBin.pCode = pCode;
+
+        // Report whether the pipeline was found in the cache and how much CPU time the compute shader took
+        // Hits in the compiler's internal cache do not count, as the application did not provide them
+        const bool cacheHit = (cacheEntryState == ShaderEntryState::Ready) &&
+                              (pShaderCache == pPipelineInfo->pShaderCache);
+        FillStageBuildFeedback(&computeContext, ShaderStageCompute, cacheHit, &pPipelineOut->stageFeedback);
+        FillPipelineBuildFeedback(startTime,
+                                  cacheHit,
+                                  &pPipelineOut->stageFeedback,
+                                  1,
+                                  &pPipelineOut->pipelineFeedback);
     }
 
-    if (pPipelineDumpFile != nullptr)
+    if (dumpPipeline)
     {
-        if (result == Result::Success)
-        {
-            DumpPipelineBinary(pPipelineDumpFile,
-                                m_gfxIp,
-                                &pPipelineOut->pipelineBin);
-        }
-
-        DestroyPipelineDumpFile(pPipelineDumpFile);
+        PipelineDumper::Get()->WritePipeline(
+            GetPipelineDumpFileName(cl::PipelineDumpDir.c_str(), pPipelineInfo, nullptr, &hash),
+            std::move(pipelineDumpInfo),
+            m_gfxIp,
+            (result == Result::Success) ? &pPipelineOut->pipelineBin : nullptr);
     }
 
     // Free shader replacement allocations and restore original shader module
@@ -1908,16 +2074,39 @@ Context* Compiler::AcquireContext()
     }
 
     LLPC_ASSERT(pFreeContext != nullptr);
+    pFreeContext->IncrementCompileCount();
     return pFreeContext;
 }
 
 // =====================================================================================================================
 // Releases LLPC context.
+//
+// NOTE: LLVM never frees the types, constants and metadata uniqued in a context, so a context that has been reused
+// too often, or has translated too much code, is destroyed here. A fresh one is created by the next AcquireContext().
 void Compiler::ReleaseContext(
     Context* pContext)    // [in] LLPC context
 {
-    MutexGuard lock(m_contextPoolMutex);
-    pContext->SetInUse(false);
+    const bool exceedsReuseLimit = (cl::ContextReuseLimit > 0) &&
+                                   (pContext->GetCompileCount() >= cl::ContextReuseLimit);
+    const bool exceedsFootprintLimit = (cl::ContextFootprintLimit > 0) &&
+                                       (pContext->GetFootprint() >= cl::ContextFootprintLimit * 1024ull);
+    const bool recycle = exceedsReuseLimit || exceedsFootprintLimit;
+
+    {
+        MutexGuard lock(m_contextPoolMutex);
+        pContext->SetInUse(false);
+
+        if (recycle)
+        {
+            m_contextPool.erase(std::find(m_contextPool.begin(), m_contextPool.end(), pContext));
+        }
+    }
+
+    if (recycle)
+    {
+        // Destroy the context outside the lock, it may take a while.
+        delete pContext;
+    }
 }
 
 // =====================================================================================================================
@@ -1943,6 +2132,66 @@ void Compiler::DumpTimeProfilingResult(
               << "LLVM Patch (Lib Link) = " << float(g_timeProfileResult.patchLinkTime) / fre << "\n");
 }
 
+// =====================================================================================================================
+// Fills the build feedback of the specified shader stage from the per-stage CPU time profiles of the pipeline.
+void Compiler::FillStageBuildFeedback(
+    PipelineContext*       pPipelineContext,   // [in] Pipeline context
+    ShaderStage            shaderStage,        // Shader stage
+    bool                   cacheHit,           // Whether the pipeline binary was retrieved from the app cache
+    PipelineBuildFeedback* pFeedback           // [out] Build feedback of the shader stage
+    ) const
+{
+    TimeProfileResult timeProfile = *pPipelineContext->GetShaderTimeProfile(shaderStage);
+    if (shaderStage == ShaderStageGeometry)
+    {
+        // Copy shader is an internal stage, report its code generation as part of the geometry shader
+        timeProfile.codeGenTime += pPipelineContext->GetShaderTimeProfile(ShaderStageCopyShader)->codeGenTime;
+    }
+
+    const int64_t ticksPerUs = std::max(GetPerfFrequency() / 1000000, static_cast<int64_t>(1));
+
+    pFeedback->valid                     = true;
+    pFeedback->cacheHit                  = cacheHit;
+    pFeedback->phaseTimeUs.translateTime = static_cast<uint32_t>(timeProfile.translateTime / ticksPerUs);
+    pFeedback->phaseTimeUs.lowerTime     = static_cast<uint32_t>(timeProfile.lowerTime / ticksPerUs);
+    pFeedback->phaseTimeUs.patchTime     = static_cast<uint32_t>(timeProfile.patchTime / ticksPerUs);
+    pFeedback->phaseTimeUs.codeGenTime   = static_cast<uint32_t>(timeProfile.codeGenTime / ticksPerUs);
+    pFeedback->durationUs                = static_cast<uint64_t>(pFeedback->phaseTimeUs.translateTime) +
+                                           pFeedback->phaseTimeUs.lowerTime +
+                                           pFeedback->phaseTimeUs.patchTime +
+                                           pFeedback->phaseTimeUs.codeGenTime;
+}
+
+// =====================================================================================================================
+// Fills the build feedback of the whole pipeline. Phase times are the sums over all shader stages, while the duration
+// is the total CPU time spent in this build call (including hashing, cache lookup and ELF finalization).
+void Compiler::FillPipelineBuildFeedback(
+    int64_t                      startTime,        // CPU time stamp at the beginning of the build call
+    bool                         cacheHit,         // Whether the pipeline binary was retrieved from the app cache
+    const PipelineBuildFeedback* pStageFeedbacks,  // [in] Build feedbacks of shader stages
+    uint32_t                     stageCount,       // Count of shader stage feedbacks
+    PipelineBuildFeedback*       pFeedback         // [out] Build feedback of the pipeline
+    ) const
+{
+    const int64_t ticksPerUs = std::max(GetPerfFrequency() / 1000000, static_cast<int64_t>(1));
+
+    memset(pFeedback, 0, sizeof(PipelineBuildFeedback));
+    pFeedback->valid      = true;
+    pFeedback->cacheHit   = cacheHit;
+    pFeedback->durationUs = static_cast<uint64_t>((GetPerfCpuTime() - startTime) / ticksPerUs);
+
+    for (uint32_t stage = 0; stage < stageCount; ++stage)
+    {
+        if (pStageFeedbacks[stage].valid)
+        {
+            pFeedback->phaseTimeUs.translateTime += pStageFeedbacks[stage].phaseTimeUs.translateTime;
+            pFeedback->phaseTimeUs.lowerTime     += pStageFeedbacks[stage].phaseTimeUs.lowerTime;
+            pFeedback->phaseTimeUs.patchTime     += pStageFeedbacks[stage].phaseTimeUs.patchTime;
+            pFeedback->phaseTimeUs.codeGenTime   += pStageFeedbacks[stage].phaseTimeUs.codeGenTime;
+        }
+    }
+}
+
 // =====================================================================================================================
 // Dumps graphics pipeline.
 void Compiler::DumpGraphicsPipeline(
@@ -1950,11 +2199,18 @@ void Compiler::DumpGraphicsPipeline(
     ) const
 {
     auto hash = GenerateHashForGraphicsPipeline(pPipelineInfo);
-    auto pPipelineDumpFile = CreatePipelineDumpFile(cl::PipelineDumpDir.c_str(), nullptr, pPipelineInfo, &hash);
-    if (pPipelineDumpFile != nullptr)
+    if (PipelineDumper::Get()->BeginDump(Md5::Compact64(&hash)))
     {
-        DumpGraphicsPipelineInfo(pPipelineDumpFile, pPipelineInfo);
-        DestroyPipelineDumpFile(pPipelineDumpFile);
+        std::string pipelineDumpInfo;
+        raw_string_ostream dumpStream(pipelineDumpInfo);
+        DumpGraphicsPipelineInfo(&dumpStream, pPipelineInfo);
+        dumpStream.flush();
+
+        PipelineDumper::Get()->WritePipeline(
+            GetPipelineDumpFileName(cl::PipelineDumpDir.c_str(), nullptr, pPipelineInfo, &hash),
+            std::move(pipelineDumpInfo),
+            m_gfxIp,
+            nullptr);
     }
 }
 
@@ -1965,11 +2221,18 @@ void Compiler::DumpComputePipeline(
     ) const
 {
     auto hash = GenerateHashForComputePipeline(pPipelineInfo);
-    auto pPipelineDumpFile = CreatePipelineDumpFile(cl::PipelineDumpDir.c_str(), pPipelineInfo, nullptr, &hash);
-    if (pPipelineDumpFile != nullptr)
-    {
-        DumpComputePipelineInfo(pPipelineDumpFile, pPipelineInfo);
-        DestroyPipelineDumpFile(pPipelineDumpFile);
+    if (PipelineDumper::Get()->BeginDump(Md5::Compact64(&hash)))
+    {
+        std::string pipelineDumpInfo;
+        raw_string_ostream dumpStream(pipelineDumpInfo);
+        DumpComputePipelineInfo(&dumpStream, pPipelineInfo);
+        dumpStream.flush();
+
+        PipelineDumper::Get()->WritePipeline(
+            GetPipelineDumpFileName(cl::PipelineDumpDir.c_str(), pPipelineInfo, nullptr, &hash),
+            std::move(pipelineDumpInfo),
+            m_gfxIp,
+            nullptr);
     }
 }
 
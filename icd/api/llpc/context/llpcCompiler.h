@@ -139,6 +139,15 @@ private:
 
     void InitGpuProperty();
     void DumpTimeProfilingResult(const Md5::Hash* pHash);
+    void FillStageBuildFeedback(PipelineContext*       pPipelineContext,
+                                ShaderStage            shaderStage,
+                                bool                   cacheHit,
+                                PipelineBuildFeedback* pFeedback) const;
+    void FillPipelineBuildFeedback(int64_t                      startTime,
+                                   bool                         cacheHit,
+                                   const PipelineBuildFeedback* pStageFeedbacks,
+                                   uint32_t                     stageCount,
+                                   PipelineBuildFeedback*       pFeedback) const;
 
     Context* AcquireContext();
     void ReleaseContext(Context* pContext);
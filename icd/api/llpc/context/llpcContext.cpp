@@ -78,7 +78,9 @@ Context::Context(
     GfxIpVersion gfxIp) // Graphics IP version info
     :
     LLVMContext(),
-    m_gfxIp(gfxIp)
+    m_gfxIp(gfxIp),
+    m_compileCount(0),
+    m_footprint(0)
 {
     std::vector<Metadata*> emptyMeta;
     m_pEmptyMetaNode = MDNode::get(*this, emptyMeta);
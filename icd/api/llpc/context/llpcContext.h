@@ -57,6 +57,19 @@ public:
     // Set context in-use flag.
     void SetInUse(bool inUse) { m_isInUse = inUse; }
 
+    // Records that a pipeline compile has started with this context.
+    void IncrementCompileCount() { ++m_compileCount; }
+
+    // Gets the number of pipeline compiles this context has been used for.
+    uint32_t GetCompileCount() const { return m_compileCount; }
+
+    // Adds the size of a shader binary translated into this context to its estimated footprint.
+    void AddFootprint(size_t size) { m_footprint += size; }
+
+    // Gets the estimated footprint of this context, in bytes of shader binaries translated into it. The types,
+    // constants and metadata uniqued by LLVM are never freed, so they grow roughly in proportion to this.
+    size_t GetFootprint() const { return m_footprint; }
+
     // Attaches pipeline context to LLPC context.
     void AttachPipelineContext(PipelineContext* pPipelineContext)
     {
@@ -120,6 +133,11 @@ public:
         return m_pPipelineContext->GetShaderInterfaceData(shaderStage);
     }
 
+    TimeProfileResult* GetShaderTimeProfile(ShaderStage shaderStage)
+    {
+        return m_pPipelineContext->GetShaderTimeProfile(shaderStage);
+    }
+
     bool IsGraphics() const
     {
         return m_pPipelineContext->IsGraphics();
@@ -238,6 +256,8 @@ private:
      std::unique_ptr<llvm::Module> m_pGlslEmuLib;       // LLVM library for GLSL emulation
      std::unique_ptr<llvm::Module> m_pNativeGlslEmuLib; // Native LLVM library for GLSL emulation
      bool                          m_isInUse;           // Whether this context is in use
+     uint32_t                      m_compileCount;      // Number of pipeline compiles done with this context
+     size_t                        m_footprint;         // Estimated footprint (see GetFootprint())
 
     llvm::MDNode*       m_pEmptyMetaNode;   // Empty metadata node
 
@@ -67,7 +67,7 @@ PipelineContext::PipelineContext(
     m_hash(*pHash),
     m_descTablePtrHigh(cl::DescTablePtrHigh)
 {
-
+    memset(m_stageTimeProfiles, 0, sizeof(m_stageTimeProfiles));
 }
 
 // =====================================================================================================================
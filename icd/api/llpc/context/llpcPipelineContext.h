@@ -624,6 +624,13 @@ public:
     uint64_t GetPiplineHashCode() const { return Md5::Compact64(&m_hash); }
     virtual uint64_t GetShaderHashCode(ShaderStage stage) const = 0;
 
+    // Gets CPU time profiling result of the specified shader stage (used by pipeline build feedback)
+    TimeProfileResult* GetShaderTimeProfile(ShaderStage shaderStage)
+    {
+        LLPC_ASSERT(shaderStage < ShaderStageCountInternal);
+        return &m_stageTimeProfiles[shaderStage];
+    }
+
 protected:
     // Gets dummy resource mapping nodes of the specified shader stage
     virtual std::vector<ResourceMappingNode>* GetDummyResourceMapNodes(ShaderStage shaderStage) = 0;
@@ -661,6 +668,8 @@ private:
     // -----------------------------------------------------------------------------------------------------------------
 
     uint32_t            m_descTablePtrHigh; // High DWORD of 64-bit VA address for the descriptor table pointer
+
+    TimeProfileResult   m_stageTimeProfiles[ShaderStageCountInternal]; // Per-stage CPU time profiling results
 };
 
 } // Llpc
@@ -204,10 +204,29 @@ struct PipelineShaderInfo
     const ResourceMappingNode*      pUserDataNodes;
 };
 
+/// Represents feedback of building a pipeline or one of its shader stages (reported through the output of pipeline
+/// building, in the manner of VK_EXT_pipeline_creation_feedback).
+struct PipelineBuildFeedback
+{
+    bool                valid;              ///< Whether this feedback is valid (false for absent shader stages)
+    bool                cacheHit;           ///< Whether the pipeline binary was found in the application's shader cache
+    uint64_t            durationUs;         ///< Total CPU time spent in building, in microseconds
+
+    struct
+    {
+        uint32_t        translateTime;      ///< SPIR-V translation time
+        uint32_t        lowerTime;          ///< SPIR-V lowering time
+        uint32_t        patchTime;          ///< LLVM patching time
+        uint32_t        codeGenTime;        ///< Code generation time
+    } phaseTimeUs;                          ///< CPU time of each compilation phase, in microseconds (zero on cache hit)
+};
+
 /// Represents output of building a graphics pipeline.
 struct GraphicsPipelineBuildOut
 {
-    BinaryData          pipelineBin;        ///< Output pipeline binary data
+    BinaryData            pipelineBin;                          ///< Output pipeline binary data
+    PipelineBuildFeedback pipelineFeedback;                     ///< Feedback of building the whole pipeline
+    PipelineBuildFeedback stageFeedback[ShaderStageGfxCount];   ///< Feedback of building each shader stage
 };
 
 /// Represents info to build a graphics pipeline.
@@ -280,7 +299,28 @@ struct ComputePipelineBuildInfo
 /// Represents output of building a compute pipeline.
 struct ComputePipelineBuildOut
 {
-    BinaryData          pipelineBin;        ///< Output pipeline binary data
+    BinaryData            pipelineBin;      ///< Output pipeline binary data
+    PipelineBuildFeedback pipelineFeedback; ///< Feedback of building the whole pipeline
+    PipelineBuildFeedback stageFeedback;    ///< Feedback of building the compute shader stage
+};
+
+/// Vendor-specific ELF note type in the ".note" section of pipeline binary, whose description is an array of
+/// ShaderStats (one entry per hardware shader code object). The note only holds properties of the generated code, so
+/// that identical builds produce identical binaries.
+/// NOTE: The note type changes whenever the layout of ShaderStats changes.
+static const uint32_t ShaderStatsNoteType = 0x4C504302;
+
+/// Represents statistics of a shader stage, recorded by LLPC in the pipeline binary.
+struct ShaderStats
+{
+    ShaderStage         shaderStage;        ///< Shader stage (copy shader is reported as ShaderStageCopyShader)
+    uint32_t            numUsedVgprs;       ///< Number of VGPRs used by this shader
+    uint32_t            numUsedSgprs;       ///< Number of SGPRs used by this shader
+    uint32_t            ldsSizeInBytes;     ///< LDS size allocated for this shader (per thread group), in bytes
+    uint32_t            scratchSizeInBytes; ///< Scratch memory size (per thread), in bytes
+    uint32_t            instructionCount;   ///< Count of ISA instructions
+    uint32_t            codeSizeInBytes;    ///< Size of ISA code, in bytes
+    uint32_t            occupancy;          ///< Estimated maximum count of wavefronts per SIMD (0 if unknown)
 };
 
 typedef uint64_t ShaderHash;
@@ -376,6 +416,18 @@ public:
     /// @return TRUE if the specified format is supported by fetch shader. Otherwise, FALSE is returned.
     static bool VKAPI_CALL IsVertexFormatSupported(VkFormat format);
 
+    /// Gets the statistics of the specified shader stage from a pipeline binary built by LLPC.
+    ///
+    /// @param [in]  pPipelineBin   Pipeline binary (ELF)
+    /// @param [in]  shaderStage    Shader stage whose statistics are queried
+    /// @param [out] pStats         Statistics of the specified shader stage
+    ///
+    /// @returns Result::Success if successful. Result::ErrorUnavailable if the pipeline binary does not record
+    ///          statistics for the specified shader stage. Other return codes indicate failure.
+    static Result VKAPI_CALL GetShaderStats(const BinaryData* pPipelineBin,
+                                            ShaderStage       shaderStage,
+                                            ShaderStats*      pStats);
+
     /// Destroys the pipeline compiler.
     virtual void VKAPI_CALL Destroy() = 0;
 
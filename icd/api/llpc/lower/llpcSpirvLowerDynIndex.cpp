@@ -35,6 +35,7 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include "SPIRVInternal.h"
 #include "llpcContext.h"
 #include "llpcSpirvLowerDynIndex.h"
@@ -43,9 +44,56 @@ using namespace llvm;
 using namespace SPIRV;
 using namespace Llpc;
 
+namespace llvm
+{
+
+namespace cl
+{
+
+// -dyn-index-strategy: force the strategy to lower dynamic index into local arrays
+opt<uint32_t> DynIndexStrategyOverride("dyn-index-strategy",
+                                       desc("Force strategy of dynamic index into local arrays: 0 - cost model, "
+                                            "1 - select expansion, 2 - VGPR indexing, 3 - scratch"),
+                                       init(0));
+
+// -dyn-index-max-vgprs: maximum VGPRs that a dynamically indexed local array is allowed to occupy
+opt<uint32_t> DynIndexMaxVgprs("dyn-index-max-vgprs",
+                               desc("Maximum VGPRs occupied by a dynamically indexed local array"),
+                               init(64));
+
+} // cl
+
+} // llvm
+
 namespace Llpc
 {
 
+// =====================================================================================================================
+// Gets name string of the specified dynamic index strategy.
+static const char* GetDynIndexStrategyName(
+    DynIndexStrategy strategy)  // Dynamic index strategy
+{
+    const char* pName = nullptr;
+
+    switch (strategy)
+    {
+    case DynIndexStrategy::SelectExpand:
+        pName = "select";
+        break;
+    case DynIndexStrategy::VgprIndex:
+        pName = "vgpr-index";
+        break;
+    case DynIndexStrategy::Scratch:
+        pName = "scratch";
+        break;
+    default:
+        LLPC_NEVER_CALLED();
+        break;
+    }
+
+    return pName;
+}
+
 // =====================================================================================================================
 // Initializes static members.
 char SpirvLowerDynIndex::ID = 0;
@@ -69,6 +117,43 @@ bool SpirvLowerDynIndex::runOnModule(
 
     visit(m_pModule);
 
+    // Lower dynamic index into local arrays with the strategy chosen for each array
+    if (m_dynIndexArrays.empty() == false)
+    {
+        LLPC_OUTS("===============================================================================\n");
+        LLPC_OUTS("// LLPC dynamic index strategy results (" << GetShaderStageName(m_shaderStage) << " shader)\n");
+    }
+
+    for (auto& arrayInfo : m_dynIndexArrays)
+    {
+        auto strategy = SelectStrategy(&arrayInfo);
+
+        LLPC_OUTS((arrayInfo.pBase->hasName() ? arrayInfo.pBase->getName() : "<unnamed>") << " " <<
+                  *arrayInfo.pArrayTy << ": accesses = " << arrayInfo.accessCount <<
+                  ", cost (select/vgpr-index/scratch) = " << arrayInfo.selectCost << "/" <<
+                  arrayInfo.vgprIndexCost << "/" << arrayInfo.scratchCost <<
+                  ", strategy = " << GetDynIndexStrategyName(strategy) << "\n");
+
+        for (uint32_t i = 0; i < arrayInfo.getElemPtrs.size(); ++i)
+        {
+            if (strategy == DynIndexStrategy::SelectExpand)
+            {
+                ExpandDynamicIndex(arrayInfo.getElemPtrs[i],
+                                   arrayInfo.operandIndices[i],
+                                   arrayInfo.pArrayTy->getNumElements());
+            }
+            else if (strategy == DynIndexStrategy::VgprIndex)
+            {
+                IndexInRegister(arrayInfo.getElemPtrs[i], arrayInfo.operandIndices[i]);
+            }
+        }
+    }
+
+    if (m_dynIndexArrays.empty() == false)
+    {
+        LLPC_OUTS("\n");
+    }
+
     // Remove those instructions that are replaced by this lower pass
     for (auto pInst : m_loadInsts)
     {
@@ -102,55 +187,264 @@ void SpirvLowerDynIndex::visitGetElementPtrInst(
     GetElementPtrInst& getElemPtrInst) // "GetElementPtr" instruction
 {
     uint32_t operandIndex = InvalidValue;
-    uint32_t dynIndexBound = 0;
+    Type* pIndexedTy = nullptr;
 
-    if (NeedExpandDynamicIndex(&getElemPtrInst, &operandIndex, &dynIndexBound))
+    if (NeedExpandDynamicIndex(&getElemPtrInst, &operandIndex, &pIndexedTy))
     {
-        SmallVector<GetElementPtrInst*, 1> getElemPtrs;
-        auto pDynIndex = getElemPtrInst.getOperand(operandIndex);
-        bool isType64 = (pDynIndex->getType()->getPrimitiveSizeInBits() == 64);
-
-        // Create "getelementptr" instructions with constant indices
-        for (uint32_t i = 0; i < dynIndexBound; ++i)
+        if (isa<VectorType>(pIndexedTy))
+        {
+            // Always expand for vector
+            ExpandDynamicIndex(&getElemPtrInst, operandIndex, pIndexedTy->getVectorNumElements());
+        }
+        else
         {
-            auto pGetElemPtr = cast<GetElementPtrInst>(getElemPtrInst.clone());
-            auto pConstIndex = isType64 ? ConstantInt::get(m_pContext->Int64Ty(), i) :
-                                          ConstantInt::get(m_pContext->Int32Ty(), i);
-            pGetElemPtr->setOperand(operandIndex, pConstIndex);
-            getElemPtrs.push_back(pGetElemPtr);
-            pGetElemPtr->insertBefore(&getElemPtrInst);
+            // Defer the choice for arrays until all accesses to the array are known
+            RecordArrayAccess(&getElemPtrInst, operandIndex, cast<ArrayType>(pIndexedTy));
         }
+    }
+}
 
-        // Copy users, ExpandStoreInst/ExpandLoadInst change getElemPtrInst's user
-        std::vector<User*> users;
-        for (auto pUser : getElemPtrInst.users())
+// =====================================================================================================================
+// Records an access with dynamic index into a local array.
+void SpirvLowerDynIndex::RecordArrayAccess(
+    GetElementPtrInst* pGetElemPtr,    // [in] "GetElementPtr" instruction
+    uint32_t           operandIndex,   // Index of the operand that represents a dynamic index
+    ArrayType*         pArrayTy)       // [in] Type of the array indexed by dynamic index
+{
+    auto pBase = pGetElemPtr->getPointerOperand();
+
+    DynIndexArrayInfo* pArrayInfo = nullptr;
+    for (auto& arrayInfo : m_dynIndexArrays)
+    {
+        if ((arrayInfo.pBase == pBase) && (arrayInfo.pArrayTy == pArrayTy))
         {
-            users.push_back(pUser);
+            pArrayInfo = &arrayInfo;
+            break;
         }
+    }
+
+    if (pArrayInfo == nullptr)
+    {
+        DynIndexArrayInfo arrayInfo = {};
+        arrayInfo.pBase         = pBase;
+        arrayInfo.pArrayTy      = pArrayTy;
+        arrayInfo.vgprIndexable = true;
+        m_dynIndexArrays.push_back(arrayInfo);
+        pArrayInfo = &m_dynIndexArrays.back();
+    }
+
+    pArrayInfo->getElemPtrs.push_back(pGetElemPtr);
+    pArrayInfo->operandIndices.push_back(operandIndex);
+    pArrayInfo->accessCount += pGetElemPtr->getNumUses();
+
+    // NOTE: Register indexing requires the dynamic index to select a 32-bit or 64-bit scalar element, so that the
+    // array could be treated as a vector.
+    auto pElemTy = pArrayTy->getElementType();
+    const uint32_t elemBitWidth = pElemTy->getPrimitiveSizeInBits();
+    if ((operandIndex < 2) ||
+        (operandIndex != pGetElemPtr->getNumOperands() - 1) ||
+        ((pElemTy->isIntegerTy() == false) && (pElemTy->isFloatingPointTy() == false)) ||
+        ((elemBitWidth != 32) && (elemBitWidth != 64)))
+    {
+        pArrayInfo->vgprIndexable = false;
+    }
+}
 
-        // Replace the original "getelementptr" instructions with a group of newly-created "getelementptr" instructions
-        for (auto pUser : users)
+// =====================================================================================================================
+// Chooses the strategy to lower dynamic index into the specified local array, based on a cost model.
+DynIndexStrategy SpirvLowerDynIndex::SelectStrategy(
+    DynIndexArrayInfo* pArrayInfo // [in,out] Info of the array accessed with dynamic index
+    ) const
+{
+    // Estimated costs, in units of VALU instructions
+    static const uint32_t VgprIndexAccessCost = 8;  // s_set_gpr_idx/movrel plus the loop for divergent index
+    static const uint32_t ScratchAccessCost   = 24; // Scratch load/store per dword, weighted by its latency
+    static const uint32_t ScratchSetupCost    = 16; // Scratch offset setup and initialization of array contents
+    static const uint32_t MaxSelectElements   = 32; // Beyond this, select expansion bloats code too much
+
+    const DataLayout& dataLayout = m_pModule->getDataLayout();
+    auto pArrayTy = pArrayInfo->pArrayTy;
+    const uint32_t elemCount = pArrayTy->getNumElements();
+    const uint32_t elemDwords =
+        std::max<uint32_t>((dataLayout.getTypeAllocSize(pArrayTy->getElementType()) + 3) / 4, 1);
+    const uint32_t regCount = elemCount * elemDwords;
+    const uint32_t accessCount = pArrayInfo->accessCount;
+
+    // NOTE: Fragment and compute shaders are usually limited by occupancy, so keeping the array in VGPRs is more
+    // expensive for them and the VGPR budget is halved.
+    const bool occupancyBound = ((m_shaderStage == ShaderStageFragment) || (m_shaderStage == ShaderStageCompute));
+    const uint32_t maxRegCount = occupancyBound ? (cl::DynIndexMaxVgprs / 2) : cl::DynIndexMaxVgprs;
+    const uint32_t footprintCost = occupancyBound ? (regCount * 2) : regCount;
+
+    const bool allowSelect = ((regCount <= maxRegCount) && (elemCount <= MaxSelectElements));
+    const bool allowVgprIndex = ((regCount <= maxRegCount) && pArrayInfo->vgprIndexable);
+
+    // Select expansion compares the index against each element and selects every dword of the element
+    pArrayInfo->selectCost = allowSelect ?
+                             (footprintCost + accessCount * (elemCount - 1) * (1 + elemDwords)) : UINT32_MAX;
+    pArrayInfo->vgprIndexCost = allowVgprIndex ?
+                                (footprintCost + accessCount * (VgprIndexAccessCost + elemDwords)) : UINT32_MAX;
+    pArrayInfo->scratchCost = ScratchSetupCost + accessCount * ScratchAccessCost * elemDwords;
+
+    DynIndexStrategy strategy = DynIndexStrategy::Scratch;
+    uint32_t minCost = pArrayInfo->scratchCost;
+    if (pArrayInfo->vgprIndexCost < minCost)
+    {
+        strategy = DynIndexStrategy::VgprIndex;
+        minCost = pArrayInfo->vgprIndexCost;
+    }
+    if (pArrayInfo->selectCost <= minCost)
+    {
+        strategy = DynIndexStrategy::SelectExpand;
+    }
+
+    // Apply the forced strategy, falling back to the cost model if the array does not allow it
+    switch (cl::DynIndexStrategyOverride)
+    {
+    case 1:
+        strategy = DynIndexStrategy::SelectExpand;
+        break;
+    case 2:
+        if (pArrayInfo->vgprIndexable)
         {
-            auto pLoadInst = dyn_cast<LoadInst>(pUser);
-            auto pStoreInst = dyn_cast<StoreInst>(pUser);
+            strategy = DynIndexStrategy::VgprIndex;
+        }
+        break;
+    case 3:
+        strategy = DynIndexStrategy::Scratch;
+        break;
+    default:
+        break;
+    }
 
-            if (pLoadInst != nullptr)
-            {
-                ExpandLoadInst(pLoadInst, getElemPtrs, pDynIndex);
-            }
-            else if (pStoreInst != nullptr)
-            {
-                ExpandStoreInst(pStoreInst, getElemPtrs, pDynIndex);
-            }
-            else
-            {
-                LLPC_NEVER_CALLED();
-            }
+    return strategy;
+}
+
+// =====================================================================================================================
+// Expands "getelementptr" instruction with dynamic index to a group of "getelementptr" with constant indices, and
+// selects among them for its "load" and "store" users.
+void SpirvLowerDynIndex::ExpandDynamicIndex(
+    GetElementPtrInst* pGetElemPtr,    // [in] "GetElementPtr" instruction
+    uint32_t           operandIndex,   // Index of the operand that represents a dynamic index
+    uint32_t           dynIndexBound)  // Upper bound of dynamic index
+{
+    SmallVector<GetElementPtrInst*, 1> getElemPtrs;
+    auto pDynIndex = pGetElemPtr->getOperand(operandIndex);
+    bool isType64 = (pDynIndex->getType()->getPrimitiveSizeInBits() == 64);
+
+    // Create "getelementptr" instructions with constant indices
+    for (uint32_t i = 0; i < dynIndexBound; ++i)
+    {
+        auto pNewGetElemPtr = cast<GetElementPtrInst>(pGetElemPtr->clone());
+        auto pConstIndex = isType64 ? ConstantInt::get(m_pContext->Int64Ty(), i) :
+                                      ConstantInt::get(m_pContext->Int32Ty(), i);
+        pNewGetElemPtr->setOperand(operandIndex, pConstIndex);
+        getElemPtrs.push_back(pNewGetElemPtr);
+        pNewGetElemPtr->insertBefore(pGetElemPtr);
+    }
+
+    // Copy users, ExpandStoreInst/ExpandLoadInst change pGetElemPtr's user
+    std::vector<User*> users;
+    for (auto pUser : pGetElemPtr->users())
+    {
+        users.push_back(pUser);
+    }
+
+    // Replace the original "getelementptr" instructions with a group of newly-created "getelementptr" instructions
+    for (auto pUser : users)
+    {
+        auto pLoadInst = dyn_cast<LoadInst>(pUser);
+        auto pStoreInst = dyn_cast<StoreInst>(pUser);
+
+        if (pLoadInst != nullptr)
+        {
+            ExpandLoadInst(pLoadInst, getElemPtrs, pDynIndex);
+        }
+        else if (pStoreInst != nullptr)
+        {
+            ExpandStoreInst(pStoreInst, getElemPtrs, pDynIndex);
+        }
+        else
+        {
+            LLPC_NEVER_CALLED();
         }
+    }
+
+    // Collect replaced instructions that will be removed
+    m_getElemPtrInsts.insert(pGetElemPtr);
+}
+
+// =====================================================================================================================
+// Accesses the array indexed by "getelementptr" as a vector with dynamic "extractelement" and "insertelement", which
+// backend keeps in VGPRs and accesses with register indexing.
+void SpirvLowerDynIndex::IndexInRegister(
+    GetElementPtrInst* pGetElemPtr,    // [in] "GetElementPtr" instruction
+    uint32_t           operandIndex)   // Index of the operand that represents a dynamic index
+{
+    // Access is something like this:
+    //
+    //   arrayPtr  = getelementptr ptr, idxs[0 ... operandIndex - 1]
+    //   vectorPtr = bitcast arrayPtr to <upperBound x elemTy>*
+    //
+    //   vector    = load vectorPtr
+    //   loadValue = extractelement vector, dynIndex
+    //
+    //   vector    = load vectorPtr
+    //   vector    = insertelement vector, storeValue, dynIndex
+    //   store vector, vectorPtr
+
+    auto pDynIndex = pGetElemPtr->getOperand(operandIndex);
+
+    std::vector<Value*> idxs;
+    for (uint32_t i = 1; i < operandIndex; ++i)
+    {
+        idxs.push_back(pGetElemPtr->getOperand(i));
+    }
+
+    auto pArrayPtr = GetElementPtrInst::CreateInBounds(pGetElemPtr->getPointerOperand(), idxs, "", pGetElemPtr);
+    auto pArrayTy = cast<ArrayType>(pArrayPtr->getType()->getPointerElementType());
+    auto pElemTy = pArrayTy->getElementType();
+    auto pVectorTy = VectorType::get(pElemTy, pArrayTy->getNumElements());
+    auto pVectorPtr = new BitCastInst(pArrayPtr, pVectorTy->getPointerTo(SPIRAS_Private), "", pGetElemPtr);
 
-        // Collect replaced instructions that will be removed
-        m_getElemPtrInsts.insert(&getElemPtrInst);
+    // NOTE: The array is only guaranteed to be aligned as its elements.
+    const uint32_t alignment = m_pModule->getDataLayout().getABITypeAlignment(pElemTy);
+
+    // Copy users, they are changed while iterating
+    std::vector<User*> users;
+    for (auto pUser : pGetElemPtr->users())
+    {
+        users.push_back(pUser);
     }
+
+    for (auto pUser : users)
+    {
+        auto pLoadInst = dyn_cast<LoadInst>(pUser);
+        auto pStoreInst = dyn_cast<StoreInst>(pUser);
+
+        if (pLoadInst != nullptr)
+        {
+            auto pVector = new LoadInst(pVectorPtr, "", pLoadInst->isVolatile(), alignment, pLoadInst);
+            auto pLoadValue = ExtractElementInst::Create(pVector, pDynIndex, "", pLoadInst);
+            pLoadInst->replaceAllUsesWith(pLoadValue);
+            m_loadInsts.insert(pLoadInst);
+        }
+        else if (pStoreInst != nullptr)
+        {
+            Value* pVector = new LoadInst(pVectorPtr, "", pStoreInst->isVolatile(), alignment, pStoreInst);
+            pVector = InsertElementInst::Create(pVector, pStoreInst->getValueOperand(), pDynIndex, "", pStoreInst);
+            pStoreInst->setOperand(0, pVector);
+            pStoreInst->setOperand(1, pVectorPtr);
+            pStoreInst->setAlignment(alignment);
+        }
+        else
+        {
+            LLPC_NEVER_CALLED();
+        }
+    }
+
+    // Collect replaced instructions that will be removed
+    m_getElemPtrInsts.insert(pGetElemPtr);
 }
 
 // =====================================================================================================================
@@ -158,11 +452,9 @@ void SpirvLowerDynIndex::visitGetElementPtrInst(
 bool SpirvLowerDynIndex::NeedExpandDynamicIndex(
     GetElementPtrInst* pGetElemPtr,       // [in] "GetElementPtr" instruction
     uint32_t*          pOperandIndex,     // [out] Index of the operand that represents a dynamic index
-    uint32_t*          pDynIndexBound     // [out] Upper bound of dynamic index
+    Type**             ppIndexedTy        // [out] Type indexed by the dynamic index (array or vector)
     ) const
 {
-    static const uint32_t MaxDynIndexBound = 8;
-
     std::vector<Value*> idxs;
     uint32_t operandIndex = InvalidValue;
     bool     needExpand   = false;
@@ -188,33 +480,9 @@ bool SpirvLowerDynIndex::NeedExpandDynamicIndex(
                 needExpand = true;
 
                 auto pIndexedTy = pGetElemPtr->getIndexedType(pPtrVal->getType()->getPointerElementType(), idxs);
-                if (pIndexedTy != nullptr)
+                if ((pIndexedTy != nullptr) && (isa<ArrayType>(pIndexedTy) || isa<VectorType>(pIndexedTy)))
                 {
-                    // Check the upper bound of dynamic index
-                    if (isa<ArrayType>(pIndexedTy))
-                    {
-                        auto pArrayTy = dyn_cast<ArrayType>(pIndexedTy);
-                        if (pArrayTy->getArrayNumElements() > MaxDynIndexBound)
-                        {
-                            // Skip expand if array size greater than threshold
-                            allowExpand = false;
-                        }
-                        else
-                        {
-                            *pDynIndexBound = pArrayTy->getArrayNumElements();
-                        }
-                    }
-                    else if (isa<VectorType>(pIndexedTy))
-                    {
-                        // Always expand for vector
-                        auto pVectorTy = dyn_cast<VectorType>(pIndexedTy);
-                        *pDynIndexBound = pVectorTy->getVectorNumElements();
-                    }
-                    else
-                    {
-                        LLPC_NEVER_CALLED();
-                        allowExpand = false;
-                    }
+                    *ppIndexedTy = pIndexedTy;
                 }
                 else
                 {
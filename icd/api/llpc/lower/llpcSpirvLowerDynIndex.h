@@ -33,11 +33,34 @@
 #include "llvm/IR/InstVisitor.h"
 
 #include <unordered_set>
+#include <vector>
 #include "llpcSpirvLower.h"
 
 namespace Llpc
 {
 
+// Enumerates strategies to lower dynamic index into a local array.
+enum class DynIndexStrategy : uint32_t
+{
+    SelectExpand = 0,   // Expand to compare/select over all array elements
+    VgprIndex,          // Access the array as a vector in VGPRs with register indexing (movrel)
+    Scratch,            // Leave the array in memory (scratch)
+};
+
+// Represents the dynamically indexed accesses to a local array.
+struct DynIndexArrayInfo
+{
+    llvm::Value*                          pBase;            // Pointer from which the array is indexed
+    llvm::ArrayType*                      pArrayTy;         // Type of the array
+    std::vector<llvm::GetElementPtrInst*> getElemPtrs;      // "getelementptr" instructions with dynamic index
+    std::vector<uint32_t>                 operandIndices;   // Operand index of dynamic index in each of them
+    uint32_t                              accessCount;      // Count of "load" and "store" through dynamic index
+    bool                                  vgprIndexable;    // Whether all accesses allow register indexing
+    uint32_t                              selectCost;       // Estimated cost of select expansion
+    uint32_t                              vgprIndexCost;    // Estimated cost of register indexing
+    uint32_t                              scratchCost;      // Estimated cost of scratch access
+};
+
 // =====================================================================================================================
 // Represents the pass of SPIR-V lowering opertions for dynamic index in access chain.
 class SpirvLowerDynIndex:
@@ -62,7 +85,11 @@ private:
 
     bool NeedExpandDynamicIndex(llvm::GetElementPtrInst* pGetElemPtr,
                                 uint32_t*                pOperandIndex,
-                                uint32_t*                pDynIndexBound) const;
+                                llvm::Type**             ppIndexedTy) const;
+    void RecordArrayAccess(llvm::GetElementPtrInst* pGetElemPtr, uint32_t operandIndex, llvm::ArrayType* pArrayTy);
+    DynIndexStrategy SelectStrategy(DynIndexArrayInfo* pArrayInfo) const;
+    void ExpandDynamicIndex(llvm::GetElementPtrInst* pGetElemPtr, uint32_t operandIndex, uint32_t dynIndexBound);
+    void IndexInRegister(llvm::GetElementPtrInst* pGetElemPtr, uint32_t operandIndex);
     void ExpandLoadInst(llvm::LoadInst*                          pLoadInst,
                         llvm::ArrayRef<llvm::GetElementPtrInst*> getElemPtrs,
                         llvm::Value*                             pDynIndex);
@@ -72,6 +99,7 @@ private:
 
     std::unordered_set<llvm::Instruction*> m_getElemPtrInsts;
     std::unordered_set<llvm::Instruction*> m_loadInsts;
+    std::vector<DynIndexArrayInfo>         m_dynIndexArrays;   // Local arrays accessed with dynamic index
 };
 
 } // Llpc
@@ -69,6 +69,13 @@ bool SpirvLowerImageOp::runOnModule(
     // Invoke handling of "call" instruction
     visit(m_pModule);
 
+    // NOTE: Waterfall loops split basic blocks, so they are emitted after the visitor has finished walking the module.
+    for (auto& nonUniformCall : m_nonUniformImageCalls)
+    {
+        EmitWaterfallLoop(nonUniformCall.pImageCall, nonUniformCall.indexOperands);
+    }
+    m_nonUniformImageCalls.clear();
+
     for (auto pCallInst: m_imageCalls)
     {
         pCallInst->dropAllReferences();
@@ -142,6 +149,8 @@ void SpirvLowerImageOp::visitCallInst(
         ConstantInt* pSamplerBinding  = nullptr;
         Value* pResourceIndex = nullptr;
         Value* pSamplerIndex  = nullptr;
+        bool   resourceNonUniform = false;
+        bool   samplerNonUniform  = false;
 
         std::string mangledName;
 
@@ -154,11 +163,13 @@ void SpirvLowerImageOp::visitCallInst(
                                &pResourceBinding,
                                &pResourceIndex,
                                &pMemoryQualifier);
+            resourceNonUniform = (pLoadCombined->getMetadata(gSPIRVMD::NonUniform) != nullptr);
 
             // Descriptor set and binging of sampler are the same as those of resource
             pSamplerDescSet = pResourceDescSet;
             pSamplerBinding = pResourceBinding;
             pSamplerIndex   = pResourceIndex;
+            samplerNonUniform = resourceNonUniform;
 
             m_imageLoads.insert(pLoadCombined);
         }
@@ -177,12 +188,14 @@ void SpirvLowerImageOp::visitCallInst(
                                    &pResourceBinding,
                                    &pResourceIndex,
                                    &pMemoryQualifier);
+                resourceNonUniform = (pLoadResource->getMetadata(gSPIRVMD::NonUniform) != nullptr);
 
                 ExtractBindingInfo(pLoadSampler,
                                    &pSamplerDescSet,
                                    &pSamplerBinding,
                                    &pSamplerIndex,
                                    &pMemoryQualifier);
+                samplerNonUniform = (pLoadSampler->getMetadata(gSPIRVMD::NonUniform) != nullptr);
 
                 m_imageLoads.insert(pLoadCall);
             }
@@ -198,6 +211,7 @@ void SpirvLowerImageOp::visitCallInst(
                                        &pResourceBinding,
                                        &pResourceIndex,
                                        &pMemoryQualifier);
+                    resourceNonUniform = (pLoadResource->getMetadata(gSPIRVMD::NonUniform) != nullptr);
 
                     m_imageLoads.insert(pLoadCall);
                 }
@@ -217,6 +231,7 @@ void SpirvLowerImageOp::visitCallInst(
                                        &pResourceBinding,
                                        &pResourceIndex,
                                        &pMemoryQualifier);
+                    resourceNonUniform = (pLoadResource->getMetadata(gSPIRVMD::NonUniform) != nullptr);
 
                     m_imageLoadOperands.insert(pLoadCall);
                 }
@@ -227,6 +242,9 @@ void SpirvLowerImageOp::visitCallInst(
 
         std::vector<Value*> args;
 
+        // Operand indices of descriptor indices that are decorated as non-uniform and are not constant
+        std::vector<uint32_t> nonUniformIndexOperands;
+
         if ((imageCallMeta.OpKind == ImageOpSample) ||
             (imageCallMeta.OpKind == ImageOpGather) ||
             (imageCallMeta.OpKind == ImageOpQueryLod))
@@ -234,11 +252,19 @@ void SpirvLowerImageOp::visitCallInst(
             // Add sampler only for image sample and image gather
             args.push_back(pSamplerDescSet);
             args.push_back(pSamplerBinding);
+            if (samplerNonUniform && (isa<Constant>(pSamplerIndex) == false))
+            {
+                nonUniformIndexOperands.push_back(args.size());
+            }
             args.push_back(pSamplerIndex);
         }
 
         args.push_back(pResourceDescSet);
         args.push_back(pResourceBinding);
+        if (resourceNonUniform && (isa<Constant>(pResourceIndex) == false))
+        {
+            nonUniformIndexOperands.push_back(args.size());
+        }
         args.push_back(pResourceIndex);
 
         if (imageCallMeta.OpKind != ImageOpQueryNonLod)
@@ -384,10 +410,84 @@ void SpirvLowerImageOp::visitCallInst(
         CallInst* pImageCall = cast<CallInst>(EmitCall(m_pModule, callName, callInst.getType(), args, NoAttrib, &callInst));
         callInst.replaceAllUsesWith(pImageCall);
 
+        if (nonUniformIndexOperands.empty() == false)
+        {
+            NonUniformImageCall nonUniformCall = { pImageCall, nonUniformIndexOperands };
+            m_nonUniformImageCalls.push_back(nonUniformCall);
+        }
+
         m_imageCalls.insert(&callInst);
     }
 }
 
+// =====================================================================================================================
+// Wraps the specified image call in a waterfall loop, so that its non-uniform descriptor indices become uniform within
+// each iteration. Each iteration handles the invocations sharing the index values of the first active invocation:
+//
+//   .waterfall.loop:  %first = readfirstlane(%index); %match = (%index == %first); br %match, body, latch
+//   .waterfall.body:  image call using %first
+//   .waterfall.latch: %result = phi; br %match, end, loop
+void SpirvLowerImageOp::EmitWaterfallLoop(
+    CallInst*                    pImageCall,     // [in] Image call to scalarize
+    const std::vector<uint32_t>& indexOperands)  // [in] Operand indices of the non-uniform descriptor indices
+{
+    BasicBlock* pPreBlock = pImageCall->getParent();
+    Function* pFunc = pPreBlock->getParent();
+
+    // Isolate the image call in its own block
+    BasicBlock* pLoopBlock = pPreBlock->splitBasicBlock(pImageCall, ".waterfall.loop");
+    BasicBlock* pEndBlock  = pLoopBlock->splitBasicBlock(pImageCall->getNextNode(), ".waterfall.end");
+    BasicBlock* pBodyBlock = pLoopBlock->splitBasicBlock(pImageCall, ".waterfall.body");
+    BasicBlock* pLatchBlock = BasicBlock::Create(*m_pContext, ".waterfall.latch", pFunc, pEndBlock);
+
+    // Read the index values of the first active invocation and check which invocations share all of them
+    Instruction* pLoopTerm = pLoopBlock->getTerminator();
+    Value* pMatch = nullptr;
+    std::vector<Attribute::AttrKind> attribs = { Attribute::NoUnwind, Attribute::ReadNone, Attribute::Convergent };
+
+    for (uint32_t operandIdx : indexOperands)
+    {
+        Value* pIndex = pImageCall->getArgOperand(operandIdx);
+        Value* pFirstIndex = EmitCall(m_pModule,
+                                      "llvm.amdgcn.readfirstlane",
+                                      m_pContext->Int32Ty(),
+                                      pIndex,
+                                      attribs,
+                                      pLoopTerm);
+
+        Value* pIsEqual = new ICmpInst(pLoopTerm, ICmpInst::ICMP_EQ, pIndex, pFirstIndex);
+        pMatch = (pMatch == nullptr) ? pIsEqual : BinaryOperator::CreateAnd(pMatch, pIsEqual, "", pLoopTerm);
+
+        pImageCall->setArgOperand(operandIdx, pFirstIndex);
+    }
+
+    BranchInst::Create(pBodyBlock, pLatchBlock, pMatch, pLoopTerm);
+    pLoopTerm->eraseFromParent();
+
+    pBodyBlock->getTerminator()->setSuccessor(0, pLatchBlock);
+
+    // Invocations leave the loop once they have executed the image call
+    if (pImageCall->getType()->isVoidTy() == false)
+    {
+        std::vector<Use*> outerUses;
+        for (auto& use : pImageCall->uses())
+        {
+            outerUses.push_back(&use);
+        }
+
+        PHINode* pResult = PHINode::Create(pImageCall->getType(), 2, "", pLatchBlock);
+        pResult->addIncoming(UndefValue::get(pImageCall->getType()), pLoopBlock);
+        pResult->addIncoming(pImageCall, pBodyBlock);
+
+        for (Use* pUse : outerUses)
+        {
+            pUse->set(pResult);
+        }
+    }
+
+    BranchInst::Create(pEndBlock, pLoopBlock, pMatch, pLatchBlock);
+}
+
 // =====================================================================================================================
 // Extracts binding info from the specified "load" instruction
 void SpirvLowerImageOp::ExtractBindingInfo(
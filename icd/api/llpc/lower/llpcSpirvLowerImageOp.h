@@ -33,6 +33,7 @@
 #include "llvm/IR/InstVisitor.h"
 
 #include <unordered_set>
+#include <vector>
 #include "llpcSpirvLower.h"
 
 namespace Llpc
@@ -66,11 +67,21 @@ private:
                             llvm::Value**       ppIndex,
                             llvm::ConstantInt** ppMemoryQualifier);
 
+    void EmitWaterfallLoop(llvm::CallInst* pImageCall, const std::vector<uint32_t>& indexOperands);
+
+    // Image call whose descriptor indices are non-uniform and have to be scalarized with a waterfall loop
+    struct NonUniformImageCall
+    {
+        llvm::CallInst*         pImageCall;     // Lowered image call ("llpc.image.*")
+        std::vector<uint32_t>   indexOperands;  // Operand indices of the non-uniform descriptor indices
+    };
+
     // -----------------------------------------------------------------------------------------------------------------
 
     std::unordered_set<llvm::CallInst*>    m_imageCalls;  // List of "call" instructions to emulate SPIR-V image operations
     std::unordered_set<llvm::Instruction*> m_imageLoads;  // List of "load" or "call" instructions to emulate SPIR-V image load
     std::unordered_set<llvm::Instruction*> m_imageLoadOperands; // List of instructions to emulate SPIR-V image load operands
+    std::vector<NonUniformImageCall>       m_nonUniformImageCalls; // List of image calls needing a waterfall loop
 };
 
 } // Llpc
@@ -0,0 +1,86 @@
+;**********************************************************************************************************************
+;*
+;*  Trade secret of Advanced Micro Devices, Inc.
+;*  Copyright (c) 2017, Advanced Micro Devices, Inc., (unpublished)
+;*
+;*  All rights reserved. This notice is intended as a precaution against inadvertent publication and does not imply
+;*  publication or any waiver of confidentiality. The year included in the foregoing notice is the year of creation of
+;*  the work.
+;*
+;**********************************************************************************************************************
+
+;**********************************************************************************************************************
+;* @file  glslGroupOpEmu.ll
+;* @brief LLPC LLVM-IR file: contains emulation codes for GLSL subgroup operations (GFX6-8, lane reads).
+;**********************************************************************************************************************
+
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v24:32:32-v32:32:32-v48:64:64-v64:64:64-v96:128:128-v128:128:128-v192:256:256-v256:256:256-v512:512:512-v1024:1024:1024"
+target triple = "spir64-unknown-unknown"
+
+; NOTE: DPP and DS_BPERMUTE are not available before GFX8, so this library is built on top of uniform loops of lane
+; reads, which work on all GFX6-8 hardware.
+
+; =====================================================================================================================
+; >>>  Shuffle Functions
+; =====================================================================================================================
+
+; GLSL: T subgroupShuffle(T, uint)
+define i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %id) #0
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    br label %.loop
+
+.loop:
+    %remain = phi i64 [ %mask, %.entry ], [ %remain.next, %.loop ]
+    %result = phi i32 [ undef, %.entry ], [ %result.next, %.loop ]
+    %lane.i64 = call i64 @llvm.cttz.i64(i64 %remain, i1 true)
+    %lane = trunc i64 %lane.i64 to i32
+    %laneValue = call i32 @llvm.amdgcn.readlane(i32 %value, i32 %lane)
+    %isSource = icmp eq i32 %id, %lane
+    %result.next = select i1 %isSource, i32 %laneValue, i32 %result
+    %bit = shl i64 1, %lane.i64
+    %remain.next = xor i64 %remain, %bit
+    %done = icmp eq i64 %remain.next, 0
+    br i1 %done, label %.end, label %.loop
+
+.end:
+    ret i32 %result.next
+}
+
+; =====================================================================================================================
+; >>>  Arithmetic Functions
+; =====================================================================================================================
+
+; Does inclusive or exclusive scan across the wave. Active invocations must be contiguous and start from the first
+; invocation of the wave.
+define i32 @llpc.subgroup.waveScan.i32(i32 %binaryOp, i32 %value, i1 %exclusive) #0
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = add i32 %1, 1
+    %3 = select i1 %exclusive, i32 %1, i32 %2
+    %4 = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 0, i32 %3)
+    ret i32 %4
+}
+
+; Does clustered reduction across the wave. All invocations of the wave must be active.
+define i32 @llpc.subgroup.waveClusteredReduce.i32(i32 %binaryOp, i32 %value, i32 %clusterSize) #0
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = sub i32 0, %clusterSize
+    %3 = and i32 %1, %2
+    %4 = add i32 %3, %clusterSize
+    %5 = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 %3, i32 %4)
+    ret i32 %5
+}
+
+declare i32 @llpc.subgroup.laneId() #1
+declare i64 @llpc.subgroup.activeMask() #0
+declare i32 @llpc.subgroup.loopScan.i32(i32, i32, i32, i32) #0
+declare i32 @llvm.amdgcn.readlane(i32, i32) #2
+declare i64 @llvm.cttz.i64(i64, i1) #3
+
+attributes #0 = { convergent nounwind }
+attributes #1 = { nounwind }
+attributes #2 = { nounwind readnone convergent }
+attributes #3 = { nounwind readnone }
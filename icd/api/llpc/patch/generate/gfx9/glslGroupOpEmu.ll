@@ -0,0 +1,143 @@
+;**********************************************************************************************************************
+;*
+;*  Trade secret of Advanced Micro Devices, Inc.
+;*  Copyright (c) 2017, Advanced Micro Devices, Inc., (unpublished)
+;*
+;*  All rights reserved. This notice is intended as a precaution against inadvertent publication and does not imply
+;*  publication or any waiver of confidentiality. The year included in the foregoing notice is the year of creation of
+;*  the work.
+;*
+;**********************************************************************************************************************
+
+;**********************************************************************************************************************
+;* @file  glslGroupOpEmu.ll
+;* @brief LLPC LLVM-IR file: contains emulation codes for GLSL subgroup operations (GFX9, DPP and LDS permute).
+;**********************************************************************************************************************
+
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v24:32:32-v32:32:32-v48:64:64-v64:64:64-v96:128:128-v128:128:128-v192:256:256-v256:256:256-v512:512:512-v1024:1024:1024"
+target triple = "spir64-unknown-unknown"
+
+; =====================================================================================================================
+; >>>  Shuffle Functions
+; =====================================================================================================================
+
+; GLSL: T subgroupShuffle(T, uint)
+define i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %id) #0
+{
+    ; DS_BPERMUTE takes byte address
+    %1 = shl i32 %id, 2
+    %2 = call i32 @llvm.amdgcn.ds.bpermute(i32 %1, i32 %value)
+    ret i32 %2
+}
+
+; =====================================================================================================================
+; >>>  Arithmetic Functions
+; =====================================================================================================================
+
+; Does inclusive or exclusive scan across the wave with DPP. Active invocations must be contiguous and start from the
+; first invocation of the wave.
+define i32 @llpc.subgroup.waveScan.i32(i32 %binaryOp, i32 %value, i1 %exclusive) #0
+{
+    %lane = call i32 @llpc.subgroup.laneId()
+    %laneInRow = and i32 %lane, 15
+
+    ; row_shr:1 (273 = 0x111)
+    %1 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %value, i32 273, i32 15, i32 15, i1 false)
+    %2 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %1, i32 %value)
+    %3 = icmp uge i32 %laneInRow, 1
+    %4 = select i1 %3, i32 %2, i32 %value
+
+    ; row_shr:2 (274 = 0x112)
+    %5 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %4, i32 274, i32 15, i32 15, i1 false)
+    %6 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %5, i32 %4)
+    %7 = icmp uge i32 %laneInRow, 2
+    %8 = select i1 %7, i32 %6, i32 %4
+
+    ; row_shr:4 (276 = 0x114)
+    %9 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %8, i32 276, i32 15, i32 15, i1 false)
+    %10 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %9, i32 %8)
+    %11 = icmp uge i32 %laneInRow, 4
+    %12 = select i1 %11, i32 %10, i32 %8
+
+    ; row_shr:8 (280 = 0x118)
+    %13 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %12, i32 280, i32 15, i32 15, i1 false)
+    %14 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %13, i32 %12)
+    %15 = icmp uge i32 %laneInRow, 8
+    %16 = select i1 %15, i32 %14, i32 %12
+
+    ; row_bcast:15 (322 = 0x142), last invocation of row 0/2 is combined into row 1/3
+    %17 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %16, i32 322, i32 15, i32 15, i1 false)
+    %18 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %17, i32 %16)
+    %19 = and i32 %lane, 16
+    %20 = icmp ne i32 %19, 0
+    %21 = select i1 %20, i32 %18, i32 %16
+
+    ; row_bcast:31 (323 = 0x143), invocation 31 is combined into row 2/3
+    %22 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %21, i32 323, i32 15, i32 15, i1 false)
+    %23 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %22, i32 %21)
+    %24 = icmp uge i32 %lane, 32
+    %25 = select i1 %24, i32 %23, i32 %21
+
+    ; Exclusive scan is inclusive scan shifted by one invocation, wave_shr:1 (312 = 0x138)
+    %26 = call i32 @llvm.amdgcn.mov.dpp.i32(i32 %25, i32 312, i32 15, i32 15, i1 false)
+    %27 = icmp eq i32 %lane, 0
+    %28 = call i32 @llpc.subgroup.identity.i32(i32 %binaryOp)
+    %29 = select i1 %27, i32 %28, i32 %26
+    %30 = select i1 %exclusive, i32 %29, i32 %25
+
+    ret i32 %30
+}
+
+; Does clustered reduction across the wave with butterfly permutes. All invocations of the wave must be active.
+define i32 @llpc.subgroup.waveClusteredReduce.i32(i32 %binaryOp, i32 %value, i32 %clusterSize) #0
+{
+    %lane = call i32 @llpc.subgroup.laneId()
+
+    %1 = xor i32 %lane, 1
+    %2 = call i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %1)
+    %3 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %value, i32 %2)
+    %4 = icmp ugt i32 %clusterSize, 1
+    %5 = select i1 %4, i32 %3, i32 %value
+
+    %6 = xor i32 %lane, 2
+    %7 = call i32 @llpc.subgroup.shuffle.i32(i32 %5, i32 %6)
+    %8 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %5, i32 %7)
+    %9 = icmp ugt i32 %clusterSize, 2
+    %10 = select i1 %9, i32 %8, i32 %5
+
+    %11 = xor i32 %lane, 4
+    %12 = call i32 @llpc.subgroup.shuffle.i32(i32 %10, i32 %11)
+    %13 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %10, i32 %12)
+    %14 = icmp ugt i32 %clusterSize, 4
+    %15 = select i1 %14, i32 %13, i32 %10
+
+    %16 = xor i32 %lane, 8
+    %17 = call i32 @llpc.subgroup.shuffle.i32(i32 %15, i32 %16)
+    %18 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %15, i32 %17)
+    %19 = icmp ugt i32 %clusterSize, 8
+    %20 = select i1 %19, i32 %18, i32 %15
+
+    %21 = xor i32 %lane, 16
+    %22 = call i32 @llpc.subgroup.shuffle.i32(i32 %20, i32 %21)
+    %23 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %20, i32 %22)
+    %24 = icmp ugt i32 %clusterSize, 16
+    %25 = select i1 %24, i32 %23, i32 %20
+
+    %26 = xor i32 %lane, 32
+    %27 = call i32 @llpc.subgroup.shuffle.i32(i32 %25, i32 %26)
+    %28 = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %25, i32 %27)
+    %29 = icmp ugt i32 %clusterSize, 32
+    %30 = select i1 %29, i32 %28, i32 %25
+
+    ret i32 %30
+}
+
+declare i32 @llpc.subgroup.laneId() #1
+declare i32 @llpc.subgroup.identity.i32(i32) #1
+declare i32 @llpc.subgroup.combine.i32(i32, i32, i32) #1
+declare i32 @llvm.amdgcn.mov.dpp.i32(i32, i32, i32, i32, i1) #2
+declare i32 @llvm.amdgcn.ds.bpermute(i32, i32) #2
+
+attributes #0 = { convergent nounwind }
+attributes #1 = { nounwind }
+attributes #2 = { nounwind readnone convergent }
@@ -0,0 +1,594 @@
+;**********************************************************************************************************************
+;*
+;*  Trade secret of Advanced Micro Devices, Inc.
+;*  Copyright (c) 2017, Advanced Micro Devices, Inc., (unpublished)
+;*
+;*  All rights reserved. This notice is intended as a precaution against inadvertent publication and does not imply
+;*  publication or any waiver of confidentiality. The year included in the foregoing notice is the year of creation of
+;*  the work.
+;*
+;**********************************************************************************************************************
+
+;**********************************************************************************************************************
+;* @file  glslGroupOpEmu.ll
+;* @brief LLPC LLVM-IR file: contains emulation codes for GLSL subgroup (non-uniform group) operations.
+;**********************************************************************************************************************
+
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v24:32:32-v32:32:32-v48:64:64-v64:64:64-v96:128:128-v128:128:128-v192:256:256-v256:256:256-v512:512:512-v1024:1024:1024"
+target triple = "spir64-unknown-unknown"
+
+; NOTE: A subgroup is mapped to a hardware wave (64 invocations). Arithmetic operations are identified by the opcode
+; of the SPIR-V instruction (OpGroupNonUniformIAdd = 349, ..., OpGroupNonUniformBitwiseXor = 361). Floating-point
+; operations work on the bits of the value, which are bitcast back by the callers. Wave-level scans and shuffles are
+; GFX-dependent and are implemented in the GFX-specific libraries.
+
+; =====================================================================================================================
+; >>>  Utility Functions
+; =====================================================================================================================
+
+; Gets the index of this invocation within the subgroup
+define i32 @llpc.subgroup.laneId() #0
+{
+    %1 = call i32 @llvm.amdgcn.mbcnt.lo(i32 -1, i32 0)
+    %2 = call i32 @llvm.amdgcn.mbcnt.hi(i32 -1, i32 %1)
+    ret i32 %2
+}
+
+; Gets the mask of active invocations within the subgroup
+define i64 @llpc.subgroup.activeMask() #1
+{
+    ; 33 = ICMP_NE
+    %1 = call i64 @llvm.amdgcn.icmp.i32(i32 1, i32 0, i32 33)
+    ret i64 %1
+}
+
+; Gets the identity value of the specified arithmetic operation
+define i32 @llpc.subgroup.identity.i32(i32 %binaryOp) #0
+{
+.entry:
+    switch i32 %binaryOp, label %.zero [ i32 350, label %.fzero
+                                         i32 351, label %.one
+                                         i32 352, label %.fone
+                                         i32 353, label %.smin
+                                         i32 354, label %.ones
+                                         i32 355, label %.fmin
+                                         i32 356, label %.smax
+                                         i32 358, label %.fmax
+                                         i32 359, label %.ones ]
+
+.zero:
+    ret i32 0
+
+.fzero:
+    ; -0.0 = 0x80000000
+    ret i32 -2147483648
+
+.one:
+    ret i32 1
+
+.fone:
+    ; 1.0 = 0x3F800000
+    ret i32 1065353216
+
+.smin:
+    ; INT_MAX = 0x7FFFFFFF
+    ret i32 2147483647
+
+.ones:
+    ret i32 -1
+
+.fmin:
+    ; +INF = 0x7F800000
+    ret i32 2139095040
+
+.smax:
+    ; INT_MIN = 0x80000000
+    ret i32 -2147483648
+
+.fmax:
+    ; -INF = 0xFF800000
+    ret i32 -8388608
+}
+
+; Combines two values with the specified arithmetic operation
+define i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %x, i32 %y) #0
+{
+.entry:
+    %fx = bitcast i32 %x to float
+    %fy = bitcast i32 %y to float
+    switch i32 %binaryOp, label %.iadd [ i32 350, label %.fadd
+                                         i32 351, label %.imul
+                                         i32 352, label %.fmul
+                                         i32 353, label %.smin
+                                         i32 354, label %.umin
+                                         i32 355, label %.fmin
+                                         i32 356, label %.smax
+                                         i32 357, label %.umax
+                                         i32 358, label %.fmax
+                                         i32 359, label %.and
+                                         i32 360, label %.or
+                                         i32 361, label %.xor ]
+
+.iadd:
+    %iadd = add i32 %x, %y
+    ret i32 %iadd
+
+.fadd:
+    %fadd = fadd float %fx, %fy
+    %fadd.i32 = bitcast float %fadd to i32
+    ret i32 %fadd.i32
+
+.imul:
+    %imul = mul i32 %x, %y
+    ret i32 %imul
+
+.fmul:
+    %fmul = fmul float %fx, %fy
+    %fmul.i32 = bitcast float %fmul to i32
+    ret i32 %fmul.i32
+
+.smin:
+    %slt = icmp slt i32 %x, %y
+    %smin = select i1 %slt, i32 %x, i32 %y
+    ret i32 %smin
+
+.umin:
+    %ult = icmp ult i32 %x, %y
+    %umin = select i1 %ult, i32 %x, i32 %y
+    ret i32 %umin
+
+.fmin:
+    %fmin = call float @llvm.minnum.f32(float %fx, float %fy)
+    %fmin.i32 = bitcast float %fmin to i32
+    ret i32 %fmin.i32
+
+.smax:
+    %sgt = icmp sgt i32 %x, %y
+    %smax = select i1 %sgt, i32 %x, i32 %y
+    ret i32 %smax
+
+.umax:
+    %ugt = icmp ugt i32 %x, %y
+    %umax = select i1 %ugt, i32 %x, i32 %y
+    ret i32 %umax
+
+.fmax:
+    %fmax = call float @llvm.maxnum.f32(float %fx, float %fy)
+    %fmax.i32 = bitcast float %fmax to i32
+    ret i32 %fmax.i32
+
+.and:
+    %and = and i32 %x, %y
+    ret i32 %and
+
+.or:
+    %or = or i32 %x, %y
+    ret i32 %or
+
+.xor:
+    %xor = xor i32 %x, %y
+    ret i32 %xor
+}
+
+; Combines the values of those active invocations whose indices are within [lowerBound, upperBound) of this
+; invocation. This is a uniform loop over the active invocations, it works on any wave configuration.
+define i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 %lowerBound, i32 %upperBound) #1
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    %identity = call i32 @llpc.subgroup.identity.i32(i32 %binaryOp)
+    br label %.loop
+
+.loop:
+    %remain = phi i64 [ %mask, %.entry ], [ %remain.next, %.loop ]
+    %result = phi i32 [ %identity, %.entry ], [ %result.next, %.loop ]
+    %lane.i64 = call i64 @llvm.cttz.i64(i64 %remain, i1 true)
+    %lane = trunc i64 %lane.i64 to i32
+    %laneValue = call i32 @llvm.amdgcn.readlane(i32 %value, i32 %lane)
+    %combined = call i32 @llpc.subgroup.combine.i32(i32 %binaryOp, i32 %result, i32 %laneValue)
+    %geLower = icmp uge i32 %lane, %lowerBound
+    %ltUpper = icmp ult i32 %lane, %upperBound
+    %inRange = and i1 %geLower, %ltUpper
+    %result.next = select i1 %inRange, i32 %combined, i32 %result
+    %bit = shl i64 1, %lane.i64
+    %remain.next = xor i64 %remain, %bit
+    %done = icmp eq i64 %remain.next, 0
+    br i1 %done, label %.end, label %.loop
+
+.end:
+    ret i32 %result.next
+}
+
+; Checks if the active invocations are contiguous and start from the first invocation of the subgroup, which is the
+; precondition of wave-level scans (they only read values from lower invocations)
+define i1 @llpc.subgroup.isPrefixMask(i64 %mask) #0
+{
+    %1 = add i64 %mask, 1
+    %2 = and i64 %mask, %1
+    %3 = icmp eq i64 %2, 0
+    ret i1 %3
+}
+
+; Converts a ballot value to a 64-bit mask
+define i64 @llpc.subgroup.ballotToMask(<4 x i32> %value) #0
+{
+    %1 = shufflevector <4 x i32> %value, <4 x i32> undef, <2 x i32> <i32 0, i32 1>
+    %2 = bitcast <2 x i32> %1 to i64
+    ret i64 %2
+}
+
+; =====================================================================================================================
+; >>>  Basic and Vote Functions
+; =====================================================================================================================
+
+; GLSL: bool subgroupElect()
+define i1 @llpc.subgroup.elect() #1
+{
+    %1 = call i64 @llpc.subgroup.activeMask()
+    %2 = call i64 @llvm.cttz.i64(i64 %1, i1 true)
+    %3 = trunc i64 %2 to i32
+    %4 = call i32 @llpc.subgroup.laneId()
+    %5 = icmp eq i32 %4, %3
+    ret i1 %5
+}
+
+; GLSL: bool subgroupAll(bool)
+define i1 @llpc.subgroup.all(i1 %value) #1
+{
+    %1 = zext i1 %value to i32
+    ; 33 = ICMP_NE
+    %2 = call i64 @llvm.amdgcn.icmp.i32(i32 %1, i32 0, i32 33)
+    %3 = call i64 @llpc.subgroup.activeMask()
+    %4 = icmp eq i64 %2, %3
+    ret i1 %4
+}
+
+; GLSL: bool subgroupAny(bool)
+define i1 @llpc.subgroup.any(i1 %value) #1
+{
+    %1 = zext i1 %value to i32
+    ; 33 = ICMP_NE
+    %2 = call i64 @llvm.amdgcn.icmp.i32(i32 %1, i32 0, i32 33)
+    %3 = icmp ne i64 %2, 0
+    ret i1 %3
+}
+
+; =====================================================================================================================
+; >>>  Ballot Functions
+; =====================================================================================================================
+
+; GLSL: uvec4 subgroupBallot(bool)
+define <4 x i32> @llpc.subgroup.ballot(i1 %value) #1
+{
+    %1 = zext i1 %value to i32
+    ; 33 = ICMP_NE
+    %2 = call i64 @llvm.amdgcn.icmp.i32(i32 %1, i32 0, i32 33)
+    %3 = bitcast i64 %2 to <2 x i32>
+    %4 = shufflevector <2 x i32> %3, <2 x i32> zeroinitializer, <4 x i32> <i32 0, i32 1, i32 2, i32 3>
+    ret <4 x i32> %4
+}
+
+; GLSL: bool subgroupInverseBallot(uvec4)
+define i1 @llpc.subgroup.inverseBallot(<4 x i32> %value) #0
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = call i1 @llpc.subgroup.ballotBitExtract(<4 x i32> %value, i32 %1)
+    ret i1 %2
+}
+
+; GLSL: bool subgroupBallotBitExtract(uvec4, uint)
+define i1 @llpc.subgroup.ballotBitExtract(<4 x i32> %value, i32 %index) #0
+{
+    %1 = call i64 @llpc.subgroup.ballotToMask(<4 x i32> %value)
+    %2 = zext i32 %index to i64
+    %3 = lshr i64 %1, %2
+    %4 = trunc i64 %3 to i1
+    ret i1 %4
+}
+
+; GLSL: uint subgroupBallotBitCount(uvec4)
+define i32 @llpc.subgroup.ballotBitCount(<4 x i32> %value) #0
+{
+    %1 = call i64 @llpc.subgroup.ballotToMask(<4 x i32> %value)
+    %2 = call i64 @llvm.ctpop.i64(i64 %1)
+    %3 = trunc i64 %2 to i32
+    ret i32 %3
+}
+
+; GLSL: uint subgroupBallotInclusiveBitCount(uvec4)
+define i32 @llpc.subgroup.ballotInclusiveBitCount(<4 x i32> %value) #0
+{
+    %1 = call i32 @llpc.subgroup.ballotExclusiveBitCount(<4 x i32> %value)
+    %2 = call i32 @llpc.subgroup.laneId()
+    %3 = call i1 @llpc.subgroup.ballotBitExtract(<4 x i32> %value, i32 %2)
+    %4 = zext i1 %3 to i32
+    %5 = add i32 %1, %4
+    ret i32 %5
+}
+
+; GLSL: uint subgroupBallotExclusiveBitCount(uvec4)
+define i32 @llpc.subgroup.ballotExclusiveBitCount(<4 x i32> %value) #0
+{
+    ; MBCNT counts the bits of the mask that are below this invocation
+    %1 = extractelement <4 x i32> %value, i32 0
+    %2 = extractelement <4 x i32> %value, i32 1
+    %3 = call i32 @llvm.amdgcn.mbcnt.lo(i32 %1, i32 0)
+    %4 = call i32 @llvm.amdgcn.mbcnt.hi(i32 %2, i32 %3)
+    ret i32 %4
+}
+
+; GLSL: uint subgroupBallotFindLSB(uvec4)
+define i32 @llpc.subgroup.ballotFindLsb(<4 x i32> %value) #0
+{
+    %1 = call i64 @llpc.subgroup.ballotToMask(<4 x i32> %value)
+    %2 = call i64 @llvm.cttz.i64(i64 %1, i1 true)
+    %3 = trunc i64 %2 to i32
+    ret i32 %3
+}
+
+; GLSL: uint subgroupBallotFindMSB(uvec4)
+define i32 @llpc.subgroup.ballotFindMsb(<4 x i32> %value) #0
+{
+    %1 = call i64 @llpc.subgroup.ballotToMask(<4 x i32> %value)
+    %2 = call i64 @llvm.ctlz.i64(i64 %1, i1 true)
+    %3 = trunc i64 %2 to i32
+    %4 = sub i32 63, %3
+    ret i32 %4
+}
+
+; GLSL: T subgroupBroadcast(T, uint)
+define i32 @llpc.subgroup.broadcast.i32(i32 %value, i32 %id) #1
+{
+    %1 = call i32 @llvm.amdgcn.readlane(i32 %value, i32 %id)
+    ret i32 %1
+}
+
+; GLSL: T subgroupBroadcastFirst(T)
+define i32 @llpc.subgroup.broadcastFirst.i32(i32 %value) #1
+{
+    %1 = call i32 @llvm.amdgcn.readfirstlane(i32 %value)
+    ret i32 %1
+}
+
+; =====================================================================================================================
+; >>>  Shuffle Functions
+; =====================================================================================================================
+
+; GLSL: T subgroupShuffleXor(T, uint)
+define i32 @llpc.subgroup.shuffleXor.i32(i32 %value, i32 %mask) #1
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = xor i32 %1, %mask
+    %3 = call i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %2)
+    ret i32 %3
+}
+
+; GLSL: T subgroupShuffleUp(T, uint)
+define i32 @llpc.subgroup.shuffleUp.i32(i32 %value, i32 %delta) #1
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = sub i32 %1, %delta
+    %3 = call i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %2)
+    ret i32 %3
+}
+
+; GLSL: T subgroupShuffleDown(T, uint)
+define i32 @llpc.subgroup.shuffleDown.i32(i32 %value, i32 %delta) #1
+{
+    %1 = call i32 @llpc.subgroup.laneId()
+    %2 = add i32 %1, %delta
+    %3 = call i32 @llpc.subgroup.shuffle.i32(i32 %value, i32 %2)
+    ret i32 %3
+}
+
+; =====================================================================================================================
+; >>>  Arithmetic Functions
+; =====================================================================================================================
+
+; GLSL: T subgroupAdd/Mul/Min/Max/And/Or/Xor(T)
+define i32 @llpc.subgroup.reduce.i32(i32 %binaryOp, i32 %value) #1
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    %isPrefix = call i1 @llpc.subgroup.isPrefixMask(i64 %mask)
+    br i1 %isPrefix, label %.wave, label %.loop
+
+.wave:
+    ; The last active invocation holds the reduction of the inclusive scan
+    %scan = call i32 @llpc.subgroup.waveScan.i32(i32 %binaryOp, i32 %value, i1 false)
+    %msb = call i64 @llvm.ctlz.i64(i64 %mask, i1 true)
+    %msb.i32 = trunc i64 %msb to i32
+    %lastLane = sub i32 63, %msb.i32
+    %waveResult = call i32 @llvm.amdgcn.readlane(i32 %scan, i32 %lastLane)
+    br label %.end
+
+.loop:
+    %loopResult = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 0, i32 64)
+    br label %.end
+
+.end:
+    %result = phi i32 [ %waveResult, %.wave ], [ %loopResult, %.loop ]
+    ret i32 %result
+}
+
+; GLSL: T subgroupInclusiveAdd/Mul/Min/Max/And/Or/Xor(T)
+define i32 @llpc.subgroup.inclusiveScan.i32(i32 %binaryOp, i32 %value) #1
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    %isPrefix = call i1 @llpc.subgroup.isPrefixMask(i64 %mask)
+    br i1 %isPrefix, label %.wave, label %.loop
+
+.wave:
+    %waveResult = call i32 @llpc.subgroup.waveScan.i32(i32 %binaryOp, i32 %value, i1 false)
+    br label %.end
+
+.loop:
+    %lane = call i32 @llpc.subgroup.laneId()
+    %upperBound = add i32 %lane, 1
+    %loopResult = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 0, i32 %upperBound)
+    br label %.end
+
+.end:
+    %result = phi i32 [ %waveResult, %.wave ], [ %loopResult, %.loop ]
+    ret i32 %result
+}
+
+; GLSL: T subgroupExclusiveAdd/Mul/Min/Max/And/Or/Xor(T)
+define i32 @llpc.subgroup.exclusiveScan.i32(i32 %binaryOp, i32 %value) #1
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    %isPrefix = call i1 @llpc.subgroup.isPrefixMask(i64 %mask)
+    br i1 %isPrefix, label %.wave, label %.loop
+
+.wave:
+    %waveResult = call i32 @llpc.subgroup.waveScan.i32(i32 %binaryOp, i32 %value, i1 true)
+    br label %.end
+
+.loop:
+    %lane = call i32 @llpc.subgroup.laneId()
+    %loopResult = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 0, i32 %lane)
+    br label %.end
+
+.end:
+    %result = phi i32 [ %waveResult, %.wave ], [ %loopResult, %.loop ]
+    ret i32 %result
+}
+
+; GLSL: T subgroupClusteredAdd/Mul/Min/Max/And/Or/Xor(T, uint)
+define i32 @llpc.subgroup.clusteredReduce.i32(i32 %binaryOp, i32 %value, i32 %clusterSize) #1
+{
+.entry:
+    %mask = call i64 @llpc.subgroup.activeMask()
+    %isFull = icmp eq i64 %mask, -1
+    br i1 %isFull, label %.wave, label %.loop
+
+.wave:
+    %waveResult = call i32 @llpc.subgroup.waveClusteredReduce.i32(i32 %binaryOp, i32 %value, i32 %clusterSize)
+    br label %.end
+
+.loop:
+    %lane = call i32 @llpc.subgroup.laneId()
+    %clusterMask = sub i32 0, %clusterSize
+    %lowerBound = and i32 %lane, %clusterMask
+    %upperBound = add i32 %lowerBound, %clusterSize
+    %loopResult = call i32 @llpc.subgroup.loopScan.i32(i32 %binaryOp, i32 %value, i32 %lowerBound, i32 %upperBound)
+    br label %.end
+
+.end:
+    %result = phi i32 [ %waveResult, %.wave ], [ %loopResult, %.loop ]
+    ret i32 %result
+}
+
+; GLSL: float subgroupAdd/Mul/Min/Max(float)
+define float @llpc.subgroup.reduce.f32(i32 %binaryOp, float %value) #1
+{
+    %1 = bitcast float %value to i32
+    %2 = call i32 @llpc.subgroup.reduce.i32(i32 %binaryOp, i32 %1)
+    %3 = bitcast i32 %2 to float
+    ret float %3
+}
+
+; GLSL: float subgroupInclusiveAdd/Mul/Min/Max(float)
+define float @llpc.subgroup.inclusiveScan.f32(i32 %binaryOp, float %value) #1
+{
+    %1 = bitcast float %value to i32
+    %2 = call i32 @llpc.subgroup.inclusiveScan.i32(i32 %binaryOp, i32 %1)
+    %3 = bitcast i32 %2 to float
+    ret float %3
+}
+
+; GLSL: float subgroupExclusiveAdd/Mul/Min/Max(float)
+define float @llpc.subgroup.exclusiveScan.f32(i32 %binaryOp, float %value) #1
+{
+    %1 = bitcast float %value to i32
+    %2 = call i32 @llpc.subgroup.exclusiveScan.i32(i32 %binaryOp, i32 %1)
+    %3 = bitcast i32 %2 to float
+    ret float %3
+}
+
+; GLSL: float subgroupClusteredAdd/Mul/Min/Max(float, uint)
+define float @llpc.subgroup.clusteredReduce.f32(i32 %binaryOp, float %value, i32 %clusterSize) #1
+{
+    %1 = bitcast float %value to i32
+    %2 = call i32 @llpc.subgroup.clusteredReduce.i32(i32 %binaryOp, i32 %1, i32 %clusterSize)
+    %3 = bitcast i32 %2 to float
+    ret float %3
+}
+
+; =====================================================================================================================
+; >>>  Quad Functions
+; =====================================================================================================================
+
+; GLSL: T subgroupQuadBroadcast(T, uint)
+define i32 @llpc.subgroup.quadBroadcast.i32(i32 %value, i32 %id) #1
+{
+.entry:
+    switch i32 %id, label %.id0 [ i32 1, label %.id1
+                                  i32 2, label %.id2
+                                  i32 3, label %.id3 ]
+
+.id0:
+    ; Broadcast channel 0 to whole quad (32768 = 0x8000)
+    %id0 = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32768)
+    ret i32 %id0
+
+.id1:
+    ; Broadcast channel 1 to whole quad (32853 = 0x8055)
+    %id1 = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32853)
+    ret i32 %id1
+
+.id2:
+    ; Broadcast channel 2 to whole quad (32938 = 0x80AA)
+    %id2 = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32938)
+    ret i32 %id2
+
+.id3:
+    ; Broadcast channel 3 to whole quad (33023 = 0x80FF)
+    %id3 = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 33023)
+    ret i32 %id3
+}
+
+; GLSL: T subgroupQuadSwapHorizontal/Vertical/Diagonal(T)
+define i32 @llpc.subgroup.quadSwap.i32(i32 %value, i32 %direction) #1
+{
+.entry:
+    switch i32 %direction, label %.horizontal [ i32 1, label %.vertical
+                                                i32 2, label %.diagonal ]
+
+.horizontal:
+    ; Swap channels [1, 0, 3, 2] (32945 = 0x80B1)
+    %horizontal = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32945)
+    ret i32 %horizontal
+
+.vertical:
+    ; Swap channels [2, 3, 0, 1] (32846 = 0x804E)
+    %vertical = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32846)
+    ret i32 %vertical
+
+.diagonal:
+    ; Swap channels [3, 2, 1, 0] (32795 = 0x801B)
+    %diagonal = call i32 @llvm.amdgcn.ds.swizzle(i32 %value, i32 32795)
+    ret i32 %diagonal
+}
+
+declare i32 @llpc.subgroup.shuffle.i32(i32, i32) #1
+declare i32 @llpc.subgroup.waveScan.i32(i32, i32, i1) #1
+declare i32 @llpc.subgroup.waveClusteredReduce.i32(i32, i32, i32) #1
+declare i32 @llvm.amdgcn.mbcnt.lo(i32, i32) #2
+declare i32 @llvm.amdgcn.mbcnt.hi(i32, i32) #2
+declare i64 @llvm.amdgcn.icmp.i32(i32, i32, i32) #3
+declare i32 @llvm.amdgcn.readlane(i32, i32) #3
+declare i32 @llvm.amdgcn.readfirstlane(i32) #3
+declare i32 @llvm.amdgcn.ds.swizzle(i32, i32) #3
+declare i64 @llvm.cttz.i64(i64, i1) #2
+declare i64 @llvm.ctlz.i64(i64, i1) #2
+declare i64 @llvm.ctpop.i64(i64) #2
+declare float @llvm.minnum.f32(float, float) #2
+declare float @llvm.maxnum.f32(float, float) #2
+
+attributes #0 = { nounwind }
+attributes #1 = { convergent nounwind }
+attributes #2 = { nounwind readnone }
+attributes #3 = { nounwind readnone convergent }
@@ -33,6 +33,12 @@
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/DiagnosticPrinter.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/MC/MCAsmInfo.h"
+#include "llvm/MC/MCContext.h"
+#include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/MCSubtargetInfo.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/TargetRegistry.h"
@@ -334,6 +340,7 @@ Result CodeGenManager::FinalizeElf(
         std::vector<ElfDataEntry> disasmData(elfInCount);
         std::vector<ElfDataEntry> csdataData(elfInCount);
         std::vector<ElfDataEntry> configData(elfInCount);
+        std::vector<ShaderStats>  shaderStats(elfInCount);
 
         uint32_t textSectionSize   = 0;
         uint32_t disasmSectionSize = 0;
@@ -447,6 +454,16 @@ Result CodeGenManager::FinalizeElf(
                 }
             }
 
+            // Collect shader statistics
+            if (result == Result::Success)
+            {
+                CollectShaderStats(pContext,
+                                   static_cast<ShaderStage>(stage),
+                                   &textData[elfIdx],
+                                   &configData[elfIdx],
+                                   &shaderStats[elfIdx]);
+            }
+
             ++elfIdx;
         }
 
@@ -460,6 +477,12 @@ Result CodeGenManager::FinalizeElf(
             size_t configSize = 0;
             result = BuildGraphicsPipelineRegConfig(pContext, configData.data(), &pConfig, &configSize);
             writer.AddNote(Util::Abi::PipelineAbiNoteType::PalMetadata, configSize, pConfig);
+
+            // Add shader statistics
+            FinalizeShaderStats(pContext, pConfig, configSize, elfInCount, shaderStats.data());
+            writer.AddNote(static_cast<Util::Abi::PipelineAbiNoteType>(ShaderStatsNoteType),
+                           sizeof(ShaderStats) * elfInCount,
+                           shaderStats.data());
             delete pConfig;
         }
     }
@@ -565,6 +588,14 @@ Result CodeGenManager::FinalizeElf(
                 size_t configSize = 0;
                 result = BuildComputePipelineRegConfig(pContext, &configData, &pConfig, &configSize);
                 writer.AddNote(Util::Abi::PipelineAbiNoteType::PalMetadata, configSize, pConfig);
+
+                // Add shader statistics
+                ShaderStats shaderStats = {};
+                CollectShaderStats(pContext, ShaderStageCompute, &textData, &configData, &shaderStats);
+                FinalizeShaderStats(pContext, pConfig, configSize, 1, &shaderStats);
+                writer.AddNote(static_cast<Util::Abi::PipelineAbiNoteType>(ShaderStatsNoteType),
+                               sizeof(ShaderStats),
+                               &shaderStats);
                 delete pConfig;
             }
         }
@@ -697,4 +728,225 @@ Result CodeGenManager::BuildComputePipelineRegConfig(
     return result;
 }
 
+// =====================================================================================================================
+// Counts ISA instructions in the specified code by disassembling it.
+uint32_t CodeGenManager::CountInstructions(
+    Context*    pContext,   // [in] LLPC context
+    const void* pCode,      // [in] ISA code
+    size_t      codeSize)   // Size of ISA code, in bytes
+{
+    uint32_t instCount = 0;
+
+    std::string triple("amdgcn--amdpal");
+    std::string errMsg;
+    auto pTarget = TargetRegistry::lookupTarget(triple, errMsg);
+    if ((pTarget != nullptr) && (codeSize > 0))
+    {
+        std::unique_ptr<MCRegisterInfo> regInfo(pTarget->createMCRegInfo(triple));
+        std::unique_ptr<MCAsmInfo> asmInfo(pTarget->createMCAsmInfo(*regInfo, triple));
+        std::unique_ptr<MCSubtargetInfo> subtargetInfo(
+            pTarget->createMCSubtargetInfo(triple, pContext->GetGpuNameString(), ""));
+        MCContext mcContext(asmInfo.get(), regInfo.get(), nullptr);
+        std::unique_ptr<MCDisassembler> disassembler(pTarget->createMCDisassembler(*subtargetInfo, mcContext));
+
+        if (disassembler != nullptr)
+        {
+            ArrayRef<uint8_t> code(static_cast<const uint8_t*>(pCode), codeSize);
+            uint64_t offset = 0;
+            while (offset < codeSize)
+            {
+                MCInst inst;
+                uint64_t instSize = 0;
+                auto status =
+                    disassembler->getInstruction(inst, instSize, code.slice(offset), offset, nulls(), nulls());
+                if ((status == MCDisassembler::Fail) || (instSize == 0))
+                {
+                    // NOTE: Skip undecodable DWORD (such as data embedded in code) and do not count it.
+                    instSize = sizeof(uint32_t);
+                }
+                else
+                {
+                    ++instCount;
+                }
+                offset += instSize;
+            }
+        }
+    }
+
+    return instCount;
+}
+
+// =====================================================================================================================
+// Collects statistics of the specified shader stage from the ELF data entries generated by code generation. Register
+// and scratch usage are filled later from PAL metadata (see FinalizeShaderStats).
+void CodeGenManager::CollectShaderStats(
+    Context*            pContext,     // [in] LLPC context
+    ShaderStage         shaderStage,  // Shader stage
+    const ElfDataEntry* pTextData,    // [in] ELF data entry of ".text" section
+    const ElfDataEntry* pConfigData,  // [in] ELF data entry of ".AMDGPU.config" section
+    ShaderStats*        pStats)       // [out] Shader statistics
+{
+    memset(pStats, 0, sizeof(ShaderStats));
+    pStats->shaderStage = shaderStage;
+
+    pStats->codeSizeInBytes = pTextData->size;
+    pStats->instructionCount = CountInstructions(pContext, pTextData->pData, pTextData->size);
+
+    const GfxIpVersion gfxIp = pContext->GetGfxIpVersion();
+    const uint32_t ldsSizeDwordGranularity = (gfxIp.major == 6) ? 64 : 128;
+
+    if (shaderStage == ShaderStageCompute)
+    {
+        // LDS allocated for shared variables is determined by the backend compiler
+        const uint32_t* pConfig = static_cast<const uint32_t*>(pConfigData->pData);
+        const uint32_t configCount = pConfigData->size / (sizeof(uint32_t) * 2);
+        for (uint32_t i = 0; i < configCount; ++i)
+        {
+            if (pConfig[2 * i] == Gfx6::mmCOMPUTE_PGM_RSRC2 * 4)
+            {
+                Gfx6::regCOMPUTE_PGM_RSRC2 computePgmRsrc2 = {};
+                computePgmRsrc2.u32All = pConfig[2 * i + 1];
+                pStats->ldsSizeInBytes =
+                    computePgmRsrc2.bits.LDS_SIZE * ldsSizeDwordGranularity * sizeof(uint32_t);
+                break;
+            }
+        }
+    }
+    else if (shaderStage == ShaderStageTessControl)
+    {
+        // LDS used by tessellation is shared by LS and HS, report it for tessellation control shader
+        const auto& calcFactor = pContext->GetShaderResourceUsage(ShaderStageTessControl)->inOutUsage.tcs.calcFactor;
+        uint32_t ldsSizeInDwords = pContext->IsTessOffChip() ?
+                                   calcFactor.inPatchSize * calcFactor.patchCountPerThreadGroup :
+                                   calcFactor.onChip.patchConstStart +
+                                   calcFactor.patchConstSize * calcFactor.patchCountPerThreadGroup;
+        pStats->ldsSizeInBytes = Pow2Align(ldsSizeInDwords, ldsSizeDwordGranularity) * sizeof(uint32_t);
+    }
+}
+
+// =====================================================================================================================
+// Fills register and scratch usage of shader statistics from PAL metadata, and estimates the occupancy.
+void CodeGenManager::FinalizeShaderStats(
+    Context*     pContext,     // [in] LLPC context
+    const void*  pConfig,      // [in] Register configuration (PAL metadata)
+    size_t       configSize,   // Size of register configuration
+    uint32_t     statsCount,   // Count of shader statistics
+    ShaderStats* pStats)       // [in,out] Shader statistics
+{
+    // PAL metadata of resource usage for each hardware shader stage
+    struct HwShaderStatsMetadata
+    {
+        uint32_t hwShader;        // Hardware shader flag
+        uint32_t numUsedVgprs;    // Metadata key of VGPR count
+        uint32_t numUsedSgprs;    // Metadata key of SGPR count
+        uint32_t scratchSize;     // Metadata key of scratch size
+    };
+
+    static const HwShaderStatsMetadata HwShaderStatsMetadataTable[] =
+    {
+        { Util::Abi::HwShaderLs, mmLS_NUM_USED_VGPRS, mmLS_NUM_USED_SGPRS, mmLS_SCRATCH_SIZE },
+        { Util::Abi::HwShaderHs, mmHS_NUM_USED_VGPRS, mmHS_NUM_USED_SGPRS, mmHS_SCRATCH_SIZE },
+        { Util::Abi::HwShaderEs, mmES_NUM_USED_VGPRS, mmES_NUM_USED_SGPRS, mmES_SCRATCH_SIZE },
+        { Util::Abi::HwShaderGs, mmGS_NUM_USED_VGPRS, mmGS_NUM_USED_SGPRS, mmGS_SCRATCH_SIZE },
+        { Util::Abi::HwShaderVs, mmVS_NUM_USED_VGPRS, mmVS_NUM_USED_SGPRS, mmVS_SCRATCH_SIZE },
+        { Util::Abi::HwShaderPs, mmPS_NUM_USED_VGPRS, mmPS_NUM_USED_SGPRS, mmPS_SCRATCH_SIZE },
+        { Util::Abi::HwShaderCs, mmCS_NUM_USED_VGPRS, mmCS_NUM_USED_SGPRS, mmCS_SCRATCH_SIZE },
+    };
+
+    // Map from LLPC shader stage to PAL API shader type
+    static const Util::Abi::ApiShaderType ApiShaderTypes[ShaderStageCount] =
+    {
+        Util::Abi::ApiShaderType::Vs,
+        Util::Abi::ApiShaderType::Hs,
+        Util::Abi::ApiShaderType::Ds,
+        Util::Abi::ApiShaderType::Gs,
+        Util::Abi::ApiShaderType::Ps,
+        Util::Abi::ApiShaderType::Cs,
+    };
+
+    auto pEntries = static_cast<const Util::Abi::PalMetadataNoteEntry*>(pConfig);
+    const uint32_t entryCount = static_cast<uint32_t>(configSize / sizeof(Util::Abi::PalMetadataNoteEntry));
+
+    auto GetMetadataValue = [pEntries, entryCount](uint32_t key) -> uint32_t
+    {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            if (pEntries[i].key == key)
+            {
+                value = pEntries[i].value;
+                break;
+            }
+        }
+        return value;
+    };
+
+    Util::Abi::ApiHwShaderMapping apiHwShaderMapping = {};
+    apiHwShaderMapping.u32Lo = GetMetadataValue(mmAPI_HW_SHADER_MAPPING_LO);
+    apiHwShaderMapping.u32Hi = GetMetadataValue(mmAPI_HW_SHADER_MAPPING_HI);
+
+    const GfxIpVersion gfxIp = pContext->GetGfxIpVersion();
+    const GpuProperty* pGpuProp = pContext->GetGpuProperty();
+
+    for (uint32_t i = 0; i < statsCount; ++i)
+    {
+        ShaderStats* pStageStats = &pStats[i];
+
+        // NOTE: Copy shader always runs on hardware VS. For other stages, the first hardware stage in the mapping is
+        // the one running the API shader (GS maps to GS and VS, the latter is for copy shader).
+        uint32_t hwShaderMask = Util::Abi::HwShaderVs;
+        if (pStageStats->shaderStage != ShaderStageCopyShader)
+        {
+            hwShaderMask =
+                apiHwShaderMapping.apiShaders[static_cast<uint32_t>(ApiShaderTypes[pStageStats->shaderStage])];
+        }
+
+        for (uint32_t j = 0; j < sizeof(HwShaderStatsMetadataTable) / sizeof(HwShaderStatsMetadataTable[0]); ++j)
+        {
+            const auto& metadata = HwShaderStatsMetadataTable[j];
+            if (hwShaderMask & metadata.hwShader)
+            {
+                pStageStats->numUsedVgprs       = GetMetadataValue(metadata.numUsedVgprs);
+                pStageStats->numUsedSgprs       = GetMetadataValue(metadata.numUsedSgprs);
+                pStageStats->scratchSizeInBytes = GetMetadataValue(metadata.scratchSize);
+                break;
+            }
+        }
+
+        // Estimate occupancy (waves per SIMD) from register and LDS usage. This is a heuristic based on GCN resource
+        // limits; it does not account for hardware resource reservation and wave launch limits.
+        if (pStageStats->numUsedVgprs > 0)
+        {
+            constexpr uint32_t MaxWavesPerSimd = 10;
+            constexpr uint32_t VgprsPerSimd    = 256;
+            constexpr uint32_t SimdsPerCu      = 4;
+
+            const uint32_t sgprsPerSimd    = (gfxIp.major >= 8) ? 800 : 512;
+            const uint32_t sgprGranularity = (gfxIp.major >= 8) ? 16 : 8;
+
+            uint32_t occupancy = MaxWavesPerSimd;
+            occupancy = std::min(occupancy, VgprsPerSimd / Pow2Align(pStageStats->numUsedVgprs, 4));
+            if (pStageStats->numUsedSgprs > 0)
+            {
+                occupancy = std::min(occupancy, sgprsPerSimd / Pow2Align(pStageStats->numUsedSgprs, sgprGranularity));
+            }
+
+            if ((pStageStats->shaderStage == ShaderStageCompute) && (pStageStats->ldsSizeInBytes > 0))
+            {
+                const auto& builtInUsage = pContext->GetShaderResourceUsage(ShaderStageCompute)->builtInUsage.cs;
+                const uint32_t threadsPerGroup =
+                    builtInUsage.workgroupSizeX * builtInUsage.workgroupSizeY * builtInUsage.workgroupSizeZ;
+                if (threadsPerGroup > 0)
+                {
+                    const uint32_t wavesPerGroup = (threadsPerGroup + pGpuProp->waveSize - 1) / pGpuProp->waveSize;
+                    const uint32_t groupsPerCu = pGpuProp->ldsSizePerCu / pStageStats->ldsSizeInBytes;
+                    occupancy = std::min(occupancy, (groupsPerCu * wavesPerGroup) / SimdsPerCu);
+                }
+            }
+
+            pStageStats->occupancy = occupancy;
+        }
+    }
+}
+
 } // Llpc
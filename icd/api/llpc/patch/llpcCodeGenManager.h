@@ -91,6 +91,20 @@ private:
                                            uint32_t            dataEntryCount,
                                            const ElfDataEntry* pDataEntries,
                                            ElfWriter<Elf64>&   writer);
+
+    static uint32_t CountInstructions(Context* pContext, const void* pCode, size_t codeSize);
+
+    static void CollectShaderStats(Context*            pContext,
+                                   ShaderStage         shaderStage,
+                                   const ElfDataEntry* pTextData,
+                                   const ElfDataEntry* pConfigData,
+                                   ShaderStats*        pStats);
+
+    static void FinalizeShaderStats(Context*     pContext,
+                                    const void*  pConfig,
+                                    size_t       configSize,
+                                    uint32_t     statsCount,
+                                    ShaderStats* pStats);
 };
 
 } // Llpc
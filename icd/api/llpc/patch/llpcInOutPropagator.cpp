@@ -0,0 +1,287 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  llpcInOutPropagator.cpp
+ * @brief LLPC source file: contains implementation of class Llpc::InOutPropagator.
+ ***********************************************************************************************************************
+ */
+#define DEBUG_TYPE "llpc-inout-propagator"
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <vector>
+#include "llpcContext.h"
+#include "llpcInOutPropagator.h"
+
+using namespace llvm;
+
+namespace Llpc
+{
+
+// =====================================================================================================================
+InOutPropagator::InOutPropagator(
+    Context* pContext)  // [in] LLPC context
+    :
+    m_pContext(pContext)
+{
+    LLPC_ASSERT(m_pContext->IsGraphics());
+}
+
+// =====================================================================================================================
+// Propagates constant generic outputs of the producer stage to the generic input imports of the consumer stage.
+//
+// NOTE: Only the input imports are replaced here. The corresponding input locations then become inactive and the
+// subsequent resource collecting removes them together with the matched output exports, which shrinks parameter
+// exports of the producer stage and interpolant settings (SPI_PS_INPUT_CNTL) of fragment shader accordingly.
+Result InOutPropagator::Run(
+    Module* pProducerModule,    // [in] LLVM module of the last pre-rasterization stage (VS or TES)
+    Module* pConsumerModule)    // [in] LLVM module of fragment shader
+{
+    LLPC_ASSERT((pProducerModule != nullptr) && (pConsumerModule != nullptr));
+
+    if ((CollectConstantOutputs(pProducerModule) == false) || (CollectExcludedInputs(pConsumerModule) == false))
+    {
+        // Propagation is unsafe for this pipeline (dynamic indexing), nothing to do
+        return Result::Success;
+    }
+
+    std::vector<CallInst*> propagatedCalls;
+    for (auto& func : *pConsumerModule)
+    {
+        if (func.getName().startswith(LlpcName::InputImportGeneric) == false)
+        {
+            continue;
+        }
+
+        for (auto pUser : func.users())
+        {
+            auto pCall = dyn_cast<CallInst>(pUser);
+            if (pCall == nullptr)
+            {
+                continue;
+            }
+
+            const uint32_t loc = cast<ConstantInt>(pCall->getArgOperand(0))->getZExtValue();
+            auto constOutput = m_constOutputs.find(loc);
+            if ((constOutput == m_constOutputs.end()) ||
+                (m_nonConstLocs.find(loc) != m_nonConstLocs.end()) ||
+                (m_excludedLocs.find(loc) != m_excludedLocs.end()))
+            {
+                continue;
+            }
+
+            Constant* pInput = ConvertConstant(constOutput->second, pCall->getType());
+            if (pInput != nullptr)
+            {
+                pCall->replaceAllUsesWith(pInput);
+                propagatedCalls.push_back(pCall);
+                m_eliminatedLocs.insert(loc);
+            }
+            else
+            {
+                // Type mismatch, this location must be kept for all of its imports
+                m_excludedLocs.insert(loc);
+            }
+        }
+    }
+
+    for (auto pCall : propagatedCalls)
+    {
+        const uint32_t loc = cast<ConstantInt>(pCall->getArgOperand(0))->getZExtValue();
+        if (m_excludedLocs.find(loc) != m_excludedLocs.end())
+        {
+            // NOTE: Another import of this location could not be propagated, the location stays active. The import
+            // replaced above is still correct, it is just not counted as an eliminated parameter export.
+            m_eliminatedLocs.erase(loc);
+        }
+        pCall->dropAllReferences();
+        pCall->eraseFromParent();
+    }
+
+    if (m_eliminatedLocs.empty() == false)
+    {
+        LLPC_OUTS("===============================================================================\n");
+        LLPC_OUTS("// LLPC constant output propagation results\n");
+        LLPC_OUTS("Parameter exports eliminated: " << m_eliminatedLocs.size() << " (locations:");
+        for (auto loc : m_eliminatedLocs)
+        {
+            LLPC_OUTS(" " << loc);
+        }
+        LLPC_OUTS(")\n\n");
+    }
+
+    return Result::Success;
+}
+
+// =====================================================================================================================
+// Collects generic outputs of the producer stage that are always written with the same compile-time constant. Returns
+// false if output locations cannot be determined statically.
+bool InOutPropagator::CollectConstantOutputs(
+    Module* pProducerModule)    // [in] LLVM module of the last pre-rasterization stage
+{
+    for (auto& func : *pProducerModule)
+    {
+        if (func.getName().startswith(LlpcName::OutputExportGeneric) == false)
+        {
+            continue;
+        }
+
+        for (auto pUser : func.users())
+        {
+            auto pCall = dyn_cast<CallInst>(pUser);
+            if (pCall == nullptr)
+            {
+                continue;
+            }
+
+            auto pLoc = dyn_cast<ConstantInt>(pCall->getArgOperand(0));
+            if (pLoc == nullptr)
+            {
+                return false;
+            }
+
+            const uint32_t loc = pLoc->getZExtValue();
+            Value* pOutput = pCall->getArgOperand(pCall->getNumArgOperands() - 1);
+            auto pOutputTy = pOutput->getType();
+
+            // NOTE: Only 32-bit outputs occupying one location are handled. Constant expressions are excluded since
+            // they might be relocatable and could not be materialized in another module.
+            auto pConstOutput = dyn_cast<Constant>(pOutput);
+            if ((pConstOutput == nullptr) ||
+                isa<ConstantExpr>(pConstOutput) ||
+                isa<UndefValue>(pConstOutput) ||
+                (pOutputTy->getScalarSizeInBits() != 32))
+            {
+                m_nonConstLocs.insert(loc);
+                if (pOutputTy->getPrimitiveSizeInBits() > (8 * SizeOfVec4))
+                {
+                    m_nonConstLocs.insert(loc + 1);
+                }
+                continue;
+            }
+
+            auto constOutput = m_constOutputs.find(loc);
+            if (constOutput == m_constOutputs.end())
+            {
+                m_constOutputs[loc] = pConstOutput;
+            }
+            else if (constOutput->second != pConstOutput)
+            {
+                // Written with different values on different paths
+                m_nonConstLocs.insert(loc);
+            }
+        }
+    }
+
+    return true;
+}
+
+// =====================================================================================================================
+// Collects input locations of fragment shader which are not allowed to be propagated. Returns false if input locations
+// cannot be determined statically.
+bool InOutPropagator::CollectExcludedInputs(
+    Module* pConsumerModule)    // [in] LLVM module of fragment shader
+{
+    for (auto& func : *pConsumerModule)
+    {
+        const bool isInterpolant = func.getName().startswith(LlpcName::InputImportInterpolant);
+        if ((isInterpolant == false) && (func.getName().startswith(LlpcName::InputImportGeneric) == false))
+        {
+            continue;
+        }
+
+        for (auto pUser : func.users())
+        {
+            auto pCall = dyn_cast<CallInst>(pUser);
+            if (pCall == nullptr)
+            {
+                continue;
+            }
+
+            auto pLoc = dyn_cast<ConstantInt>(pCall->getArgOperand(0));
+            if (pLoc == nullptr)
+            {
+                return false;
+            }
+
+            uint32_t loc = pLoc->getZExtValue();
+            if (isInterpolant)
+            {
+                // NOTE: Interpolation functions (interpolateAt*) keep the input in parameter cache, we do not try to
+                // propagate such locations.
+                auto pLocOffset = dyn_cast<ConstantInt>(pCall->getArgOperand(1));
+                if (pLocOffset == nullptr)
+                {
+                    return false;
+                }
+                m_excludedLocs.insert(loc + pLocOffset->getZExtValue());
+            }
+            else if (pCall->getType()->getPrimitiveSizeInBits() > (8 * SizeOfVec4))
+            {
+                // 64-bit inputs occupying two locations
+                m_excludedLocs.insert(loc);
+                m_excludedLocs.insert(loc + 1);
+            }
+        }
+    }
+
+    return true;
+}
+
+// =====================================================================================================================
+// Converts the constant output value to the type of input import. Returns nullptr if the conversion is not possible.
+Constant* InOutPropagator::ConvertConstant(
+    Constant* pOutput,  // [in] Constant output value
+    Type*     pInputTy  // [in] Type of input import
+    ) const
+{
+    auto pOutputTy = pOutput->getType();
+    if (pOutputTy == pInputTy)
+    {
+        return pOutput;
+    }
+
+    const uint32_t outputCompCount = pOutputTy->isVectorTy() ? pOutputTy->getVectorNumElements() : 1;
+    const uint32_t inputCompCount = pInputTy->isVectorTy() ? pInputTy->getVectorNumElements() : 1;
+    if ((pInputTy->getScalarSizeInBits() != 32) || (inputCompCount > outputCompCount))
+    {
+        return nullptr;
+    }
+
+    // Take the leading components of the output, reinterpreting them as the input component type
+    std::vector<Constant*> inputComps;
+    for (uint32_t i = 0; i < inputCompCount; ++i)
+    {
+        Constant* pComp = pOutputTy->isVectorTy() ? pOutput->getAggregateElement(i) : pOutput;
+        inputComps.push_back(ConstantExpr::getBitCast(pComp, pInputTy->getScalarType()));
+    }
+
+    return pInputTy->isVectorTy() ? ConstantVector::get(inputComps) : inputComps[0];
+}
+
+} // Llpc
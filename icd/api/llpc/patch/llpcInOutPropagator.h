@@ -0,0 +1,79 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  llpcInOutPropagator.h
+ * @brief LLPC header file: contains declaration of class Llpc::InOutPropagator.
+ ***********************************************************************************************************************
+ */
+#pragma once
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Module.h"
+
+#include <map>
+#include <unordered_set>
+#include "llpc.h"
+#include "llpcInternal.h"
+
+namespace Llpc
+{
+
+class Context;
+
+// =====================================================================================================================
+// Represents the manager doing cross-stage propagation of constant generic outputs. Generic outputs of the last
+// pre-rasterization stage that are written with a compile-time constant are substituted into the input imports of
+// fragment shader, so that the parameter export and the interpolation of this location can be eliminated.
+class InOutPropagator
+{
+public:
+    InOutPropagator(Context* pContext);
+
+    Result Run(llvm::Module* pProducerModule, llvm::Module* pConsumerModule);
+
+    // Gets the count of parameter exports eliminated by this propagation
+    uint32_t GetEliminatedExportCount() const { return m_eliminatedLocs.size(); }
+
+private:
+    LLPC_DISALLOW_DEFAULT_CTOR(InOutPropagator);
+    LLPC_DISALLOW_COPY_AND_ASSIGN(InOutPropagator);
+
+    bool CollectConstantOutputs(llvm::Module* pProducerModule);
+    bool CollectExcludedInputs(llvm::Module* pConsumerModule);
+
+    llvm::Constant* ConvertConstant(llvm::Constant* pOutput, llvm::Type* pInputTy) const;
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    Context*                            m_pContext;       // LLPC context
+
+    std::map<uint32_t, llvm::Constant*> m_constOutputs;   // Map from locations to constant output values
+    std::unordered_set<uint32_t>        m_nonConstLocs;   // Locations written with non-constant values
+    std::unordered_set<uint32_t>        m_excludedLocs;   // Input locations excluded from propagation
+    std::unordered_set<uint32_t>        m_eliminatedLocs; // Locations whose parameter exports are eliminated
+};
+
+} // Llpc
@@ -31,9 +31,11 @@
 #define DEBUG_TYPE "llpc-patch-resource-collect"
 
 #include "llvm/IR/Verifier.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include "SPIRVInternal.h"
 #include "llpcContext.h"
 #include "llpcIntrinsDefs.h"
@@ -42,6 +44,22 @@
 using namespace llvm;
 using namespace Llpc;
 
+namespace llvm
+{
+
+namespace cl
+{
+
+// -desc-promotion-analysis: analyze descriptor usage and recommend descriptors to be placed inline in user data
+static opt<bool> DescPromotionAnalysis("desc-promotion-analysis",
+                                       desc("Analyze descriptor usage frequency and recommend descriptors to be "
+                                            "placed inline in user data"),
+                                       init(false));
+
+} // cl
+
+} // llvm
+
 namespace Llpc
 {
 
@@ -81,6 +99,11 @@ bool PatchResourceCollect::runOnModule(
         m_pResUsage->pushConstSizeInBytes = 0;
     }
 
+    if (cl::DescPromotionAnalysis)
+    {
+        AnalyzeDescriptorPromotion();
+    }
+
     ClearInactiveInput();
 
     if (m_pContext->IsGraphics())
@@ -168,6 +191,7 @@ void PatchResourceCollect::visitCallInst(
             uint32_t binding = cast<ConstantInt>(callInst.getOperand(1))->getZExtValue();
             DescriptorPair descPair = { descSet, binding };
             m_pResUsage->descPairs.insert(descPair.u64All);
+            ++m_descAccessCounts[descPair.u64All];
         }
     }
     else if (mangledName.startswith(LlpcName::ImageCallPrefix))
@@ -183,7 +207,8 @@ void PatchResourceCollect::visitCallInst(
         SPIRVImageOpKind imageOp = imageCallMeta.OpKind;
 
         // NOTE: All "readonly" image operations are expected to be less than the numeric value of "ImageOpWrite".
-        if (isDeadCall && isImageOpReadOnly(imageOp))
+        const bool isRemovedCall = (isDeadCall && isImageOpReadOnly(imageOp));
+        if (isRemovedCall)
         {
             m_deadCalls.insert(&callInst);
         }
@@ -192,6 +217,10 @@ void PatchResourceCollect::visitCallInst(
         uint32_t binding = cast<ConstantInt>(callInst.getOperand(1))->getZExtValue();
         DescriptorPair descPair = { descSet, binding };
         m_pResUsage->descPairs.insert(descPair.u64All);
+        if (isRemovedCall == false)
+        {
+            ++m_descAccessCounts[descPair.u64All];
+        }
 
         std::string imageSampleName;
         std::string imageGatherName;
@@ -210,6 +239,10 @@ void PatchResourceCollect::visitCallInst(
             uint32_t binding = cast<ConstantInt>(callInst.getOperand(4))->getZExtValue();
             DescriptorPair descPair = { descSet, binding };
             m_pResUsage->descPairs.insert(descPair.u64All);
+            if (isRemovedCall == false)
+            {
+                ++m_descAccessCounts[descPair.u64All];
+            }
         }
     }
     else if (mangledName.startswith(LlpcName::InputImportGeneric))
@@ -2054,6 +2087,150 @@ void PatchResourceCollect::ReviseTessExecutionMode()
     }
 }
 
+// =====================================================================================================================
+// Analyzes descriptor usage frequency and recommends which descriptors should be placed inline in user data rather
+// than being loaded from descriptor tables.
+//
+// NOTE: Only single buffer descriptors residing in descriptor tables are candidates, which matches what the driver is
+// able to place directly in user data registers. The user data budget is estimated in the same way as the entry-point
+// mutation does (see PatchEntryPointMutate::GenerateEntryPointType()), so descriptors are only recommended if they do
+// not cause the root nodes to be spilled.
+void PatchResourceCollect::AnalyzeDescriptorPromotion()
+{
+    auto pShaderInfo = m_pContext->GetPipelineShaderInfo(m_shaderStage);
+    const auto& builtInUsage = m_pResUsage->builtInUsage;
+
+    std::vector<uint64_t> promotedDescPairs; // Recommended descriptor set/binding pairs, most frequently accessed first
+    uint32_t smemLoadsSaved = 0;             // Estimated count of scalar memory loads saved by the recommendation
+
+    // Collect the user data required by active root nodes and the candidates for promotion
+    const bool useFixedLayout = (m_shaderStage == ShaderStageCompute);
+    bool hasVbTable = false;
+    uint32_t requiredUserDataCount = 0;
+    std::vector<std::pair<uint32_t, uint64_t>> candidates; // Pairs of access count and descriptor set/binding
+
+    for (uint32_t i = 0; i < pShaderInfo->userDataNodeCount; ++i)
+    {
+        const ResourceMappingNode* pNode = &pShaderInfo->pUserDataNodes[i];
+        bool active = false;
+
+        if (pNode->type == ResourceMappingNodeType::IndirectUserDataVaPtr)
+        {
+            hasVbTable = true;
+            continue;
+        }
+        else if (pNode->type == ResourceMappingNodeType::PushConst)
+        {
+            active = m_hasPushConstOp;
+        }
+        else if (pNode->type == ResourceMappingNodeType::DescriptorTableVaPtr)
+        {
+            for (uint32_t j = 0; j < pNode->tablePtr.nodeCount; ++j)
+            {
+                const ResourceMappingNode* pInnerNode = &pNode->tablePtr.pNext[j];
+
+                DescriptorPair descPair = {};
+                descPair.descSet = pInnerNode->srdRange.set;
+                descPair.binding = pInnerNode->srdRange.binding;
+
+                auto it = m_descAccessCounts.find(descPair.u64All);
+                if (it != m_descAccessCounts.end())
+                {
+                    active = true;
+
+                    if ((pInnerNode->type == ResourceMappingNodeType::DescriptorBuffer) &&
+                        (pInnerNode->sizeInDwords == DescriptorSizeBufferInDwords))
+                    {
+                        candidates.push_back(std::make_pair(it->second, descPair.u64All));
+                    }
+                }
+            }
+        }
+        else
+        {
+            DescriptorPair descPair = {};
+            descPair.descSet = pNode->srdRange.set;
+            descPair.binding = pNode->srdRange.binding;
+            active = (m_descAccessCounts.find(descPair.u64All) != m_descAccessCounts.end());
+        }
+
+        if (active)
+        {
+            if (useFixedLayout)
+            {
+                requiredUserDataCount = std::max(requiredUserDataCount, pNode->offsetInDwords + pNode->sizeInDwords);
+            }
+            else
+            {
+                requiredUserDataCount += pNode->sizeInDwords;
+            }
+        }
+    }
+
+    // Estimate available user data, two registers are always occupied by internal tables
+    uint32_t availUserDataCount = m_pContext->GetGpuProperty()->maxUserDataCount - 2;
+    if (useFixedLayout)
+    {
+        availUserDataCount = InterfaceData::MaxCsUserDataCount;
+    }
+    else if (m_shaderStage == ShaderStageVertex)
+    {
+        availUserDataCount -= hasVbTable ? 1 : 0;
+        availUserDataCount -= (builtInUsage.vs.baseVertex || builtInUsage.vs.baseInstance) ? 2 : 0;
+        availUserDataCount -= builtInUsage.vs.drawIndex ? 1 : 0;
+    }
+
+    if (useFixedLayout && builtInUsage.cs.numWorkgroups)
+    {
+        availUserDataCount -= 2;
+    }
+
+    uint32_t freeUserDataCount =
+        (availUserDataCount > requiredUserDataCount) ? (availUserDataCount - requiredUserDataCount) : 0;
+
+    // Greedily promote the most frequently accessed descriptors. Each access of a promoted descriptor saves the
+    // scalar memory load of the descriptor from its table.
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [](const std::pair<uint32_t, uint64_t>& lhs, const std::pair<uint32_t, uint64_t>& rhs)
+                     { return lhs.first > rhs.first; });
+
+    LLPC_OUTS("===============================================================================\n");
+    LLPC_OUTS("// LLPC descriptor promotion results (" << GetShaderStageName(m_shaderStage) << " shader)\n\n");
+
+    for (const auto& candidate : candidates)
+    {
+        if (freeUserDataCount < DescriptorSizeBufferInDwords)
+        {
+            break;
+        }
+
+        DescriptorPair descPair = {};
+        descPair.u64All = candidate.second;
+
+        promotedDescPairs.push_back(descPair.u64All);
+        smemLoadsSaved += candidate.first;
+        freeUserDataCount -= DescriptorSizeBufferInDwords;
+
+        LLPC_OUTS("(" << GetShaderStageAbbreviation(m_shaderStage, true) << ") Promote: set = " << descPair.descSet
+                      << ", binding = " << descPair.binding << ", accesses = " << candidate.first << "\n");
+    }
+
+    LLPC_OUTS("(" << GetShaderStageAbbreviation(m_shaderStage, true) << ") SMEM loads saved = "
+                  << smemLoadsSaved << " (user data left = " << freeUserDataCount << ")\n");
+
+    // Report the recommendation in the format of the driver's DescriptorPromotionBindings setting
+    LLPC_OUTS("(" << GetShaderStageAbbreviation(m_shaderStage, true) << ") DescriptorPromotionBindings = ");
+    for (uint32_t i = 0; i < promotedDescPairs.size(); ++i)
+    {
+        DescriptorPair descPair = {};
+        descPair.u64All = promotedDescPairs[i];
+
+        LLPC_OUTS(((i > 0) ? ";" : "") << descPair.descSet << ":" << descPair.binding);
+    }
+    LLPC_OUTS("\n\n");
+}
+
 } // Llpc
 
 // =====================================================================================================================
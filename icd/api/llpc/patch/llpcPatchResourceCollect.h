@@ -32,6 +32,7 @@
 
 #include "llvm/IR/InstVisitor.h"
 
+#include <unordered_map>
 #include <unordered_set>
 #include "llpcPatch.h"
 
@@ -67,8 +68,13 @@ private:
 
     void ReviseTessExecutionMode();
 
+    void AnalyzeDescriptorPromotion();
+
     // -----------------------------------------------------------------------------------------------------------------
 
+    // Dword size of a buffer descriptor that could be placed inline in user data
+    static const uint32_t DescriptorSizeBufferInDwords = 4;
+
     std::unordered_set<llvm::CallInst*> m_deadCalls;            // Dead calls
 
     std::unordered_set<uint32_t>    m_activeInputLocs;          // Locations of active generic inputs
@@ -77,6 +83,8 @@ private:
     std::unordered_set<uint32_t>    m_importedOutputLocs;       // Locations of imported generic outputs
     std::unordered_set<uint32_t>    m_importedOutputBuiltIns;   // IDs of imported built-in outputs
 
+    std::unordered_map<uint64_t, uint32_t> m_descAccessCounts;  // Access counts of descriptor set/binding pairs
+
     bool            m_hasPushConstOp;           // Whether push constant is active
     bool            m_hasDynIndexedInput;       // Whether dynamic indices are used in generic input addressing (valid
                                                 // for tessellation shader, fragment shader with input interpolation)
@@ -46,6 +46,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/SourceMgr.h"
@@ -63,6 +64,11 @@
     #endif
 #endif
 
+#ifndef WIN_OS
+    #include <stdio.h>
+    #include <unistd.h>
+#endif
+
 // NOTE: To enable VLD, please add option BUILD_WIN_VLD=1 in build option.To run amdllpc with VLD enabled,
 // please copy vld.ini and all files in.\winVisualMemDetector\bin\Win64 to current directory of amdllpc.
 #ifdef BUILD_WIN_VLD
@@ -79,6 +85,7 @@
 #include "llpcDebug.h"
 #include "llpcElf.h"
 #include "llpcInternal.h"
+#include "llpcPipelineDumper.h"
 
 using namespace llvm;
 using namespace Llpc;
@@ -120,6 +127,28 @@ static opt<std::string> EntryTarget("entry-target",
 static opt<bool> IgnoreColorAttachmentFormats("ignore-color-attachment-formats",
                                               desc("Ignore color attachment formats"), init(false));
 
+// -shader-stats: print shader statistics recorded in the pipeline binary
+static opt<bool> ShaderStatsPrint("shader-stats", desc("Print shader statistics of the built pipeline"), init(false));
+
+// -shader-stats-json: output shader statistics in JSON format
+static opt<std::string> ShaderStatsJson("shader-stats-json",
+                                        desc("Output shader statistics of the built pipeline in JSON format"),
+                                        value_desc("filename"));
+
+// -soak-iterations: rebuild the pipeline repeatedly and report memory usage
+static opt<uint32_t> SoakIterations("soak-iterations",
+                                    desc("Rebuild the pipeline the specified number of extra times and report memory "
+                                         "usage across the sequence (soak test)"),
+                                    init(0));
+
+// -pipeline-dump-benchmark: measure the compile time overhead of pipeline dump
+static opt<uint32_t> PipelineDumpBenchmark("pipeline-dump-benchmark",
+                                           desc("Rebuild the pipeline the specified number of times with pipeline "
+                                                "dump disabled and enabled, and report the overhead of the dump"),
+                                           init(0));
+
+extern opt<bool> EnablePipelineDump;
+
 #ifdef WIN_OS
 // -assert-to-msgbox: pop message box when an assert is hit, only valid in Windows
 static opt<bool>        AssertToMsgBox("assert-to-msgbox", desc("Pop message box when assert is hit"));
@@ -894,6 +923,121 @@ static Result OutputElf(
     return result;
 }
 
+// =====================================================================================================================
+// Outputs shader statistics recorded in the pipeline binary along with the compile times reported by the build
+// feedback, as plain text and/or in JSON format.
+static Result OutputShaderStats(
+    CompileInfo*       pCompileInfo,  // [in] Compilation info of LLPC standalone tool
+    const std::string& jsonFile)      // [in] Name of the file to output JSON (empty if not required)
+{
+    Result result = Result::Success;
+
+    const bool isGraphics = (pCompileInfo->stageMask & ShaderStageToMask(ShaderStageCompute)) ? false : true;
+    const BinaryData* pPipelineBin = isGraphics ? &pCompileInfo->gfxPipelineOut.pipelineBin :
+                                                  &pCompileInfo->compPipelineOut.pipelineBin;
+
+    std::vector<ShaderStats> allStats;
+    for (uint32_t stage = 0; stage < ShaderStageCountInternal; ++stage)
+    {
+        ShaderStats stats = {};
+        if (ICompiler::GetShaderStats(pPipelineBin, static_cast<ShaderStage>(stage), &stats) == Result::Success)
+        {
+            allStats.push_back(stats);
+        }
+    }
+
+    // Compile times are not recorded in the pipeline binary, they come from the build feedback of this compilation.
+    // Copy shader is reported along with geometry shader.
+    std::vector<PipelineBuildFeedback> allFeedback(allStats.size());
+    for (uint32_t i = 0; i < allStats.size(); ++i)
+    {
+        const ShaderStage stage = allStats[i].shaderStage;
+        memset(&allFeedback[i], 0, sizeof(PipelineBuildFeedback));
+
+        if (isGraphics && (stage < ShaderStageGfxCount))
+        {
+            allFeedback[i] = pCompileInfo->gfxPipelineOut.stageFeedback[stage];
+        }
+        else if ((isGraphics == false) && (stage == ShaderStageCompute))
+        {
+            allFeedback[i] = pCompileInfo->compPipelineOut.stageFeedback;
+        }
+    }
+
+    if (cl::ShaderStatsPrint)
+    {
+        outs() << "===============================================================================\n";
+        outs() << "// LLPC shader statistics\n";
+        outs() << format("%-10s %6s %6s %8s %8s %8s %8s %6s %10s %10s %10s %10s\n",
+                         "stage", "vgprs", "sgprs", "lds", "scratch", "insts", "code", "waves",
+                         "trans(us)", "lower(us)", "patch(us)", "cgen(us)");
+        for (uint32_t i = 0; i < allStats.size(); ++i)
+        {
+            const auto& stats = allStats[i];
+            const auto& compileTimeUs = allFeedback[i].phaseTimeUs;
+            outs() << format("%-10s %6u %6u %8u %8u %8u %8u %6u %10u %10u %10u %10u\n",
+                             GetShaderStageName(stats.shaderStage),
+                             stats.numUsedVgprs,
+                             stats.numUsedSgprs,
+                             stats.ldsSizeInBytes,
+                             stats.scratchSizeInBytes,
+                             stats.instructionCount,
+                             stats.codeSizeInBytes,
+                             stats.occupancy,
+                             compileTimeUs.translateTime,
+                             compileTimeUs.lowerTime,
+                             compileTimeUs.patchTime,
+                             compileTimeUs.codeGenTime);
+        }
+        outs().flush();
+    }
+
+    if (jsonFile.empty() == false)
+    {
+        std::error_code errCode;
+        raw_fd_ostream jsonStream(jsonFile, errCode, sys::fs::F_Text);
+        if (errCode)
+        {
+            LLPC_ERRS("Failed to open output file: " << jsonFile << "\n");
+            result = Result::ErrorUnavailable;
+        }
+        else
+        {
+            jsonStream << "{\n";
+            jsonStream << "  \"gfxIp\": \"" << pCompileInfo->gfxIp.major << "."
+                                           << pCompileInfo->gfxIp.minor << "."
+                                           << pCompileInfo->gfxIp.stepping << "\",\n";
+            jsonStream << "  \"shaders\": [";
+            for (uint32_t i = 0; i < allStats.size(); ++i)
+            {
+                const auto& stats = allStats[i];
+                const auto& compileTimeUs = allFeedback[i].phaseTimeUs;
+                jsonStream << ((i == 0) ? "\n" : ",\n");
+                jsonStream << "    {\n";
+                jsonStream << "      \"stage\": \"" << GetShaderStageName(stats.shaderStage) << "\",\n";
+                jsonStream << "      \"numUsedVgprs\": " << stats.numUsedVgprs << ",\n";
+                jsonStream << "      \"numUsedSgprs\": " << stats.numUsedSgprs << ",\n";
+                jsonStream << "      \"ldsSizeInBytes\": " << stats.ldsSizeInBytes << ",\n";
+                jsonStream << "      \"scratchSizeInBytes\": " << stats.scratchSizeInBytes << ",\n";
+                jsonStream << "      \"instructionCount\": " << stats.instructionCount << ",\n";
+                jsonStream << "      \"codeSizeInBytes\": " << stats.codeSizeInBytes << ",\n";
+                jsonStream << "      \"occupancy\": " << stats.occupancy << ",\n";
+                jsonStream << "      \"compileTimeUs\": {\n";
+                jsonStream << "        \"translate\": " << compileTimeUs.translateTime << ",\n";
+                jsonStream << "        \"lower\": " << compileTimeUs.lowerTime << ",\n";
+                jsonStream << "        \"patch\": " << compileTimeUs.patchTime << ",\n";
+                jsonStream << "        \"codeGen\": " << compileTimeUs.codeGenTime << "\n";
+                jsonStream << "      }\n";
+                jsonStream << "    }";
+            }
+            jsonStream << "\n  ]\n";
+            jsonStream << "}\n";
+        }
+    }
+
+    return result;
+}
+
 #ifdef WIN_OS
 // =====================================================================================================================
 // Callback function for SIGABRT.
@@ -908,6 +1052,123 @@ extern "C" void LlpcSignalAbortHandler(
 }
 #endif
 
+// =====================================================================================================================
+// Gets the resident memory size of this process in bytes, or 0 if it is not available on this platform.
+static size_t GetResidentMemorySize()
+{
+    size_t residentSize = 0;
+
+#ifndef WIN_OS
+    FILE* pStatFile = fopen("/proc/self/statm", "r");
+    if (pStatFile != nullptr)
+    {
+        unsigned long totalPages    = 0;
+        unsigned long residentPages = 0;
+        if (fscanf(pStatFile, "%lu %lu", &totalPages, &residentPages) == 2)
+        {
+            residentSize = residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+        fclose(pStatFile);
+    }
+#endif
+
+    return residentSize;
+}
+
+// =====================================================================================================================
+// Rebuilds the pipeline repeatedly and reports how the memory usage of the process evolves, to check that compiler
+// memory stays bounded over a long compile sequence.
+static Result SoakTestPipeline(
+    ICompiler*    pCompiler,     // [in] LLPC compiler object
+    CompileInfo*  pCompileInfo)  // [in,out] Compilation info of LLPC standalone tool
+{
+    Result result = Result::Success;
+
+    const uint32_t iterations     = cl::SoakIterations;
+    const uint32_t reportInterval = (iterations >= 10) ? (iterations / 10) : 1;
+
+    outs() << "===============================================================================\n";
+    outs() << "// LLPC soak test\n";
+    outs() << format("%-10s %16s %16s\n", "Iteration", "Resident (KB)", "Malloc (KB)");
+    outs() << format("%-10u %16zu %16zu\n", 0, GetResidentMemorySize() / 1024, sys::Process::GetMallocUsage() / 1024);
+
+    for (uint32_t i = 1; (i <= iterations) && (result == Result::Success); ++i)
+    {
+        // Free the output of the previous build, the new one is allocated by the build itself
+        free(pCompileInfo->pPipelineBuf);
+        pCompileInfo->pPipelineBuf = nullptr;
+
+        result = BuildPipeline(pCompiler, pCompileInfo);
+
+        if ((result == Result::Success) && (((i % reportInterval) == 0) || (i == iterations)))
+        {
+            outs() << format("%-10u %16zu %16zu\n",
+                             i,
+                             GetResidentMemorySize() / 1024,
+                             sys::Process::GetMallocUsage() / 1024);
+        }
+    }
+
+    outs().flush();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Rebuilds the pipeline repeatedly with pipeline dump disabled and then enabled, and reports the average compile time
+// of both, as well as the time the pipeline dumper needs to write the remaining queued files afterwards.
+static Result BenchmarkPipelineDump(
+    ICompiler*    pCompiler,     // [in] LLPC compiler object
+    CompileInfo*  pCompileInfo)  // [in,out] Compilation info of LLPC standalone tool
+{
+    Result result = Result::Success;
+
+    const uint32_t iterations      = cl::PipelineDumpBenchmark;
+    const bool     enableDump      = cl::EnablePipelineDump;
+    const double   ticksPerMs      = GetPerfFrequency() / 1000.0;
+    double         averageTimes[2] = {};
+
+    for (uint32_t pass = 0; (pass < 2) && (result == Result::Success); ++pass)
+    {
+        cl::EnablePipelineDump = (pass == 1);
+
+        const int64_t startTime = GetPerfCpuTime();
+        for (uint32_t i = 0; (i < iterations) && (result == Result::Success); ++i)
+        {
+            // Forget the dumped pipelines so that every build writes its dump
+            PipelineDumper::Get()->Reset();
+
+            free(pCompileInfo->pPipelineBuf);
+            pCompileInfo->pPipelineBuf = nullptr;
+
+            result = BuildPipeline(pCompiler, pCompileInfo);
+        }
+        averageTimes[pass] = (GetPerfCpuTime() - startTime) / ticksPerMs / iterations;
+    }
+
+    const int64_t flushStartTime = GetPerfCpuTime();
+    PipelineDumper::Get()->Flush();
+    const double flushTime = (GetPerfCpuTime() - flushStartTime) / ticksPerMs;
+
+    cl::EnablePipelineDump = enableDump;
+
+    if (result == Result::Success)
+    {
+        const double overheadTime = averageTimes[1] - averageTimes[0];
+        const double overheadRatio = (averageTimes[0] > 0.0) ? (100.0 * overheadTime / averageTimes[0]) : 0.0;
+
+        outs() << "===============================================================================\n";
+        outs() << "// LLPC pipeline dump benchmark (" << iterations << " builds per pass)\n";
+        outs() << format("Average build time, dump disabled : %10.3f ms\n", averageTimes[0]);
+        outs() << format("Average build time, dump enabled  : %10.3f ms\n", averageTimes[1]);
+        outs() << format("Dump overhead per build           : %10.3f ms (%.1f%%)\n", overheadTime, overheadRatio);
+        outs() << format("Time to write remaining dumps     : %10.3f ms\n", flushTime);
+        outs().flush();
+    }
+
+    return result;
+}
+
 #if defined(LLPC_MEM_TRACK_LEAK) && defined(_DEBUG)
 // =====================================================================================================================
 // Enable VC run-time based memory leak detection.
@@ -1193,6 +1454,21 @@ int32_t main(
         {
             result = OutputElf(&compileInfo, outFile);
         }
+
+        if ((result == Result::Success) && (cl::ShaderStatsPrint || (cl::ShaderStatsJson.empty() == false)))
+        {
+            result = OutputShaderStats(&compileInfo, cl::ShaderStatsJson);
+        }
+
+        if ((result == Result::Success) && (cl::SoakIterations > 0))
+        {
+            result = SoakTestPipeline(pCompiler, &compileInfo);
+        }
+
+        if ((result == Result::Success) && (cl::PipelineDumpBenchmark > 0))
+        {
+            result = BenchmarkPipelineDump(pCompiler, &compileInfo);
+        }
     }
 
     //
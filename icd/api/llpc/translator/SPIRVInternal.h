@@ -409,6 +409,7 @@ namespace gSPIRVMD {
   const static char ExecutionMode[]     = "spirv.ExecutionMode";
   const static char ImageCall[]         = "spriv.ImageCall";
   const static char ImageMemory[]       = "spriv.ImageMemory";
+  const static char NonUniform[]        = "spirv.NonUniform";
 }
 
 enum SPIRVBlockTypeKind {
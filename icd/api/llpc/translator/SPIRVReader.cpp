@@ -323,6 +323,7 @@ public:
   bool transFPContractMetadata();
   bool transKernelMetadata();
   bool transNonTemporalMetadata(Instruction *I);
+  bool transNonUniformMetadata(SPIRVValue *BV, Instruction *I);
   bool transSourceLanguage();
   bool transSourceExtension();
   void transGeneratorMD();
@@ -333,6 +334,12 @@ public:
   Instruction *transSPIRVBuiltinFromInst(SPIRVInstruction *BI, BasicBlock *BB);
   Instruction *transOCLBarrierFence(SPIRVInstruction* BI, BasicBlock *BB);
   Instruction *transSPIRVImageOpFromInst(SPIRVInstruction *BI, BasicBlock*BB);
+  Value *transGroupNonUniformInst(SPIRVInstruction *BI, BasicBlock *BB);
+  Value *transGroupNonUniformMove(const std::string &FuncName, Value *Val,
+      Value *Arg, BasicBlock *BB);
+  Value *transGroupNonUniformArith(SPIRVInstruction *BI, BasicBlock *BB);
+  CallInst *addSubgroupCall(const std::string &FuncName, Type *RetTy,
+      ArrayRef<Value *> Args, BasicBlock *BB);
   void transOCLVectorLoadStore(std::string& UnmangledName,
       std::vector<SPIRVWord> &BArgs);
 
@@ -1798,6 +1805,7 @@ SPIRVToLLVM::transValueWithoutDecoration(SPIRVValue *BV, Function *F,
                                 BL->SPIRVMemoryAccess::getAlignment(), BB);
     if (BL->SPIRVMemoryAccess::isNonTemporal())
       transNonTemporalMetadata(LI);
+    transNonUniformMetadata(BV, LI);
     return mapValue(BV, LI);
   }
 
@@ -2325,7 +2333,10 @@ SPIRVToLLVM::transValueWithoutDecoration(SPIRVValue *BV, Function *F,
   }
   default: {
     auto OC = BV->getOpCode();
-    if (isSPIRVCmpInstTransToLLVMInst(static_cast<SPIRVInstruction*>(BV))) {
+    if (isGroupNonUniformOpCode(OC)) {
+      return mapValue(BV, transGroupNonUniformInst(
+          static_cast<SPIRVInstruction *>(BV), BB));
+    } else if (isSPIRVCmpInstTransToLLVMInst(static_cast<SPIRVInstruction*>(BV))) {
       return mapValue(BV, transCmpInst(BV, BB, F));
     } else if (OCLSPIRVBuiltinMap::rfind(OC, nullptr) &&
                !isAtomicOpCode(OC) &&
@@ -2921,6 +2932,269 @@ SPIRVToLLVM::transSPIRVImageOpFromInst(SPIRVInstruction *BI, BasicBlock*BB)
   return Call;
 }
 
+// Adds a call to the subgroup emulation library. The callee is marked as
+// convergent so that it is not moved across control flow before it is
+// replaced by the library implementation in the patch phase.
+CallInst *
+SPIRVToLLVM::addSubgroupCall(const std::string &FuncName, Type *RetTy,
+                             ArrayRef<Value *> Args, BasicBlock *BB) {
+  std::vector<Type *> ArgTys;
+  for (auto Arg : Args)
+    ArgTys.push_back(Arg->getType());
+  FunctionType *FT = FunctionType::get(RetTy, ArgTys, false);
+  Function *Func = M->getFunction(FuncName);
+  if (!Func) {
+    Func = Function::Create(FT, GlobalValue::ExternalLinkage, FuncName, M);
+    Func->addFnAttr(Attribute::NoUnwind);
+    Func->addFnAttr(Attribute::Convergent);
+  }
+  assert(Func->getFunctionType() == FT && "Invalid subgroup function type");
+  auto Call = CallInst::Create(Func, Args, "", BB);
+  Call->setConvergent();
+  return Call;
+}
+
+// Translates a subgroup operation that moves values between invocations
+// (broadcast, shuffle and quad operations). The library works on 32-bit
+// values, so the value is split into dwords and each dword is moved
+// separately. Booleans and 16-bit values are extended to a dword.
+Value *
+SPIRVToLLVM::transGroupNonUniformMove(const std::string &FuncName, Value *Val,
+                                      Value *Arg, BasicBlock *BB) {
+  Type *Int32Ty = Type::getInt32Ty(*Context);
+  Type *Ty = Val->getType();
+
+  if (Ty->isVectorTy()) {
+    Value *Result = UndefValue::get(Ty);
+    for (unsigned I = 0, E = Ty->getVectorNumElements(); I != E; ++I) {
+      auto Index = ConstantInt::get(Int32Ty, I);
+      Value *Comp = ExtractElementInst::Create(Val, Index, "", BB);
+      Comp = transGroupNonUniformMove(FuncName, Comp, Arg, BB);
+      Result = InsertElementInst::Create(Result, Comp, Index, "", BB);
+    }
+    return Result;
+  }
+
+  std::vector<Value *> Args(1, nullptr);
+  if (Arg)
+    Args.push_back(Arg);
+
+  const unsigned BitWidth = Ty->getPrimitiveSizeInBits();
+  if (BitWidth == 64) {
+    Type *Int32x2Ty = VectorType::get(Int32Ty, 2);
+    Value *Dwords = CastInst::CreateBitOrPointerCast(Val, Int32x2Ty, "", BB);
+    Value *Result = UndefValue::get(Int32x2Ty);
+    for (unsigned I = 0; I < 2; ++I) {
+      auto Index = ConstantInt::get(Int32Ty, I);
+      Args[0] = ExtractElementInst::Create(Dwords, Index, "", BB);
+      Value *Dword = addSubgroupCall(FuncName, Int32Ty, Args, BB);
+      Result = InsertElementInst::Create(Result, Dword, Index, "", BB);
+    }
+    return CastInst::CreateBitOrPointerCast(Result, Ty, "", BB);
+  }
+
+  assert(BitWidth <= 32 && "Invalid subgroup value type");
+  Type *IntTy = IntegerType::get(*Context, BitWidth);
+  Value *Dword = CastInst::CreateBitOrPointerCast(Val, IntTy, "", BB);
+  Args[0] = CastInst::CreateZExtOrBitCast(Dword, Int32Ty, "", BB);
+  Dword = addSubgroupCall(FuncName, Int32Ty, Args, BB);
+  Dword = CastInst::CreateTruncOrBitCast(Dword, IntTy, "", BB);
+  return CastInst::CreateBitOrPointerCast(Dword, Ty, "", BB);
+}
+
+// Translates subgroup arithmetic operations (reduce, scan and clustered
+// reduce). The library is called per component with the SPIR-V opcode as
+// the first argument; logical operations reuse the bitwise implementations.
+// The library works on 32-bit values: bitwise operations on 64-bit integers
+// are done separately on each dword, other operations on 64-bit types fail
+// the translation.
+Value *
+SPIRVToLLVM::transGroupNonUniformArith(SPIRVInstruction *BI, BasicBlock *BB) {
+  Function *F = BB->getParent();
+  auto BOps = BI->getOperands();
+  Type *Int32Ty = Type::getInt32Ty(*Context);
+
+  std::string FuncName = "llpc.subgroup.";
+  auto GroupOp = static_cast<SPIRVConstant *>(BOps[1])->getZExtIntValue();
+  switch (GroupOp) {
+  case GroupOperationReduce:          FuncName += "reduce"; break;
+  case GroupOperationInclusiveScan:   FuncName += "inclusiveScan"; break;
+  case GroupOperationExclusiveScan:   FuncName += "exclusiveScan"; break;
+  case GroupOperationClusteredReduce: FuncName += "clusteredReduce"; break;
+  default: llvm_unreachable("Invalid group operation");
+  }
+
+  Op OC = BI->getOpCode();
+  switch (OC) {
+  case OpGroupNonUniformLogicalAnd: OC = OpGroupNonUniformBitwiseAnd; break;
+  case OpGroupNonUniformLogicalOr:  OC = OpGroupNonUniformBitwiseOr; break;
+  case OpGroupNonUniformLogicalXor: OC = OpGroupNonUniformBitwiseXor; break;
+  default: break;
+  }
+
+  Value *Val = transValue(BOps[2], F, BB);
+  Value *ClusterSize = (BOps.size() > 3) ? transValue(BOps[3], F, BB) :
+                                           nullptr;
+  Type *Ty = Val->getType();
+  Type *CompTy = Ty->getScalarType();
+  const bool IsFloat = CompTy->isFloatTy();
+  const bool IsBitwise = (OC == OpGroupNonUniformBitwiseAnd) ||
+                         (OC == OpGroupNonUniformBitwiseOr) ||
+                         (OC == OpGroupNonUniformBitwiseXor);
+  const bool IsSplit = IsBitwise && CompTy->isIntegerTy(64);
+  if (!IsFloat && !IsSplit && !CompTy->isIntegerTy(32) &&
+      !CompTy->isIntegerTy(1)) {
+    std::string TypeName;
+    raw_string_ostream TypeStream(TypeName);
+    CompTy->print(TypeStream);
+    getErrorLog().checkError(false, SPIRVEC_UnsupportedGroupOperation,
+                             OpCodeNameMap::map(BI->getOpCode()) + " on " +
+                             TypeStream.str());
+    return UndefValue::get(Ty);
+  }
+  FuncName += IsFloat ? ".f32" : ".i32";
+
+  const unsigned CompCount = Ty->isVectorTy() ? Ty->getVectorNumElements() : 1;
+  Value *Result = UndefValue::get(Ty);
+  for (unsigned I = 0; I < CompCount; ++I) {
+    auto Index = ConstantInt::get(Int32Ty, I);
+    Value *Comp = Ty->isVectorTy() ?
+        ExtractElementInst::Create(Val, Index, "", BB) : Val;
+    if (CompTy->isIntegerTy(1))
+      Comp = CastInst::CreateZExtOrBitCast(Comp, Int32Ty, "", BB);
+
+    std::vector<Value *> Args;
+    Args.push_back(ConstantInt::get(Int32Ty, OC));
+    Args.push_back(nullptr);
+    if (ClusterSize)
+      Args.push_back(ClusterSize);
+
+    if (IsSplit) {
+      Type *Int32x2Ty = VectorType::get(Int32Ty, 2);
+      Value *Dwords = CastInst::CreateBitOrPointerCast(Comp, Int32x2Ty, "", BB);
+      Value *SplitResult = UndefValue::get(Int32x2Ty);
+      for (unsigned J = 0; J < 2; ++J) {
+        auto DwordIndex = ConstantInt::get(Int32Ty, J);
+        Args[1] = ExtractElementInst::Create(Dwords, DwordIndex, "", BB);
+        Value *Dword = addSubgroupCall(FuncName, Int32Ty, Args, BB);
+        SplitResult = InsertElementInst::Create(SplitResult, Dword, DwordIndex,
+                                                "", BB);
+      }
+      Comp = CastInst::CreateBitOrPointerCast(SplitResult, CompTy, "", BB);
+    } else {
+      Args[1] = Comp;
+      Comp = addSubgroupCall(FuncName, Comp->getType(), Args, BB);
+    }
+
+    if (CompTy->isIntegerTy(1))
+      Comp = CastInst::CreateTruncOrBitCast(Comp, CompTy, "", BB);
+    Result = Ty->isVectorTy() ?
+        InsertElementInst::Create(Result, Comp, Index, "", BB) : Comp;
+  }
+  return Result;
+}
+
+// Translates SPIR-V non-uniform group instructions to calls of the subgroup
+// emulation library ("llpc.subgroup.*"). A subgroup is a hardware wave.
+// NOTE: Vulkan only allows subgroup scope, so the scope operand is ignored.
+Value *
+SPIRVToLLVM::transGroupNonUniformInst(SPIRVInstruction *BI, BasicBlock *BB) {
+  Function *F = BB->getParent();
+  auto BOps = BI->getOperands();
+  Type *RetTy = transType(BI->getType());
+  Type *Int32Ty = Type::getInt32Ty(*Context);
+  Type *BoolTy = Type::getInt1Ty(*Context);
+  auto transOperand = [&](unsigned I) { return transValue(BOps[I], F, BB); };
+
+  switch (BI->getOpCode()) {
+  case OpGroupNonUniformElect:
+    return addSubgroupCall("llpc.subgroup.elect", RetTy, {}, BB);
+  case OpGroupNonUniformAll:
+    return addSubgroupCall("llpc.subgroup.all", RetTy, { transOperand(1) }, BB);
+  case OpGroupNonUniformAny:
+    return addSubgroupCall("llpc.subgroup.any", RetTy, { transOperand(1) }, BB);
+  case OpGroupNonUniformAllEqual: {
+    // Values are equal if they are equal to that of the first active
+    // invocation
+    Value *Val = transOperand(1);
+    Value *First = transGroupNonUniformMove("llpc.subgroup.broadcastFirst.i32",
+                                            Val, nullptr, BB);
+    Value *Equal = nullptr;
+    if (Val->getType()->isFPOrFPVectorTy())
+      Equal = new FCmpInst(*BB, FCmpInst::FCMP_OEQ, Val, First);
+    else
+      Equal = new ICmpInst(*BB, ICmpInst::ICMP_EQ, Val, First);
+    if (Equal->getType()->isVectorTy()) {
+      Value *AllEqual = ConstantInt::getTrue(BoolTy);
+      for (unsigned I = 0, E = Equal->getType()->getVectorNumElements();
+           I != E; ++I) {
+        Value *Comp = ExtractElementInst::Create(
+            Equal, ConstantInt::get(Int32Ty, I), "", BB);
+        AllEqual = BinaryOperator::CreateAnd(AllEqual, Comp, "", BB);
+      }
+      Equal = AllEqual;
+    }
+    return addSubgroupCall("llpc.subgroup.all", RetTy, { Equal }, BB);
+  }
+  case OpGroupNonUniformBroadcast:
+    return transGroupNonUniformMove("llpc.subgroup.broadcast.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformBroadcastFirst:
+    return transGroupNonUniformMove("llpc.subgroup.broadcastFirst.i32",
+                                    transOperand(1), nullptr, BB);
+  case OpGroupNonUniformBallot:
+    return addSubgroupCall("llpc.subgroup.ballot", RetTy,
+                           { transOperand(1) }, BB);
+  case OpGroupNonUniformInverseBallot:
+    return addSubgroupCall("llpc.subgroup.inverseBallot", RetTy,
+                           { transOperand(1) }, BB);
+  case OpGroupNonUniformBallotBitExtract:
+    return addSubgroupCall("llpc.subgroup.ballotBitExtract", RetTy,
+                           { transOperand(1), transOperand(2) }, BB);
+  case OpGroupNonUniformBallotBitCount: {
+    std::string FuncName;
+    auto GroupOp = static_cast<SPIRVConstant *>(BOps[1])->getZExtIntValue();
+    switch (GroupOp) {
+    case GroupOperationReduce:
+      FuncName = "llpc.subgroup.ballotBitCount"; break;
+    case GroupOperationInclusiveScan:
+      FuncName = "llpc.subgroup.ballotInclusiveBitCount"; break;
+    case GroupOperationExclusiveScan:
+      FuncName = "llpc.subgroup.ballotExclusiveBitCount"; break;
+    default:
+      llvm_unreachable("Invalid group operation");
+    }
+    return addSubgroupCall(FuncName, RetTy, { transOperand(2) }, BB);
+  }
+  case OpGroupNonUniformBallotFindLSB:
+    return addSubgroupCall("llpc.subgroup.ballotFindLsb", RetTy,
+                           { transOperand(1) }, BB);
+  case OpGroupNonUniformBallotFindMSB:
+    return addSubgroupCall("llpc.subgroup.ballotFindMsb", RetTy,
+                           { transOperand(1) }, BB);
+  case OpGroupNonUniformShuffle:
+    return transGroupNonUniformMove("llpc.subgroup.shuffle.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformShuffleXor:
+    return transGroupNonUniformMove("llpc.subgroup.shuffleXor.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformShuffleUp:
+    return transGroupNonUniformMove("llpc.subgroup.shuffleUp.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformShuffleDown:
+    return transGroupNonUniformMove("llpc.subgroup.shuffleDown.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformQuadBroadcast:
+    return transGroupNonUniformMove("llpc.subgroup.quadBroadcast.i32",
+                                    transOperand(1), transOperand(2), BB);
+  case OpGroupNonUniformQuadSwap:
+    return transGroupNonUniformMove("llpc.subgroup.quadSwap.i32",
+                                    transOperand(1), transOperand(2), BB);
+  default:
+    return transGroupNonUniformArith(BI, BB);
+  }
+}
+
 std::string
 SPIRVToLLVM::getOCLBuiltinName(SPIRVInstruction* BI) {
   auto OC = BI->getOpCode();
@@ -3038,6 +3312,12 @@ SPIRVToLLVM::translate(ExecutionModel EntryExecModel, const char *EntryName) {
       transFunction(BF);
   }
 
+  // Fail on instructions that were found to be unsupported while translating
+  // the function bodies
+  std::string ErrMsg;
+  if (BM->getError(ErrMsg) != SPIRVEC_Success)
+    return false;
+
   if (!transKernelMetadata())
     return false;
   if (!transFPContractMetadata())
@@ -3144,6 +3424,34 @@ SPIRVToLLVM::transNonTemporalMetadata(Instruction *I) {
   return true;
 }
 
+// Marks a load of a descriptor (image, sampler or sampled image) as non-uniform
+// if the load itself, its pointer or one of the access chain indices used to
+// form that pointer is decorated with NonUniformEXT.
+bool
+SPIRVToLLVM::transNonUniformMetadata(SPIRVValue *BV, Instruction *I) {
+  SPIRVLoad *BL = static_cast<SPIRVLoad *>(BV);
+  SPIRVValue *Src = BL->getSrc();
+
+  bool IsNonUniform = BV->hasDecorate(DecorationNonUniformEXT) ||
+                      Src->hasDecorate(DecorationNonUniformEXT);
+  if (!IsNonUniform && isAccessChainOpCode(Src->getOpCode())) {
+    auto Indices = static_cast<SPIRVAccessChainBase *>(Src)->getIndices();
+    for (auto Index : Indices) {
+      if (Index->hasDecorate(DecorationNonUniformEXT)) {
+        IsNonUniform = true;
+        break;
+      }
+    }
+  }
+
+  if (!IsNonUniform)
+    return false;
+
+  MDNode *Node = MDNode::get(*Context, {});
+  I->setMetadata(gSPIRVMD::NonUniform, Node);
+  return true;
+}
+
 bool
 SPIRVToLLVM::transKernelMetadata() {
   NamedMDNode *KernelMDs = M->getOrInsertNamedMetadata(SPIR_MD_KERNELS);
@@ -187,6 +187,25 @@ SPIRVMap<SPIRVCapabilityKind, SPIRVCapVec>::init() {
   ADD_VEC_INIT(CapabilityDrawParameters, { CapabilityShader });
   ADD_VEC_INIT(CapabilityStencilExportEXT, { CapabilityShader });
   ADD_VEC_INIT(CapabilityShaderViewportIndexLayerEXT, { CapabilityMultiViewport });
+  ADD_VEC_INIT(CapabilityGroupNonUniformVote, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformArithmetic, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformBallot, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformShuffle, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformShuffleRelative, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformClustered, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityGroupNonUniformQuad, { CapabilityGroupNonUniform });
+  ADD_VEC_INIT(CapabilityShaderNonUniformEXT, { CapabilityShader });
+  ADD_VEC_INIT(CapabilityRuntimeDescriptorArrayEXT, { CapabilityShader });
+  ADD_VEC_INIT(CapabilityInputAttachmentArrayDynamicIndexingEXT, { CapabilityInputAttachment });
+  ADD_VEC_INIT(CapabilityUniformTexelBufferArrayDynamicIndexingEXT, { CapabilitySampledBuffer });
+  ADD_VEC_INIT(CapabilityStorageTexelBufferArrayDynamicIndexingEXT, { CapabilityImageBuffer });
+  ADD_VEC_INIT(CapabilityUniformBufferArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilitySampledImageArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilityStorageBufferArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilityStorageImageArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilityInputAttachmentArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilityUniformTexelBufferArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
+  ADD_VEC_INIT(CapabilityStorageTexelBufferArrayNonUniformIndexingEXT, { CapabilityShaderNonUniformEXT });
 }
 
 template<> inline void
@@ -349,6 +368,7 @@ SPIRVMap<Decoration, SPIRVCapVec>::init() {
   ADD_VEC_INIT(DecorationNoContraction, { CapabilityShader });
   ADD_VEC_INIT(DecorationInputAttachmentIndex, { CapabilityInputAttachment });
   ADD_VEC_INIT(DecorationAlignment, { CapabilityKernel });
+  ADD_VEC_INIT(DecorationNonUniformEXT, { CapabilityShaderNonUniformEXT });
 }
 
 template<> inline void
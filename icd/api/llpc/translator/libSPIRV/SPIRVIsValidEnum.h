@@ -415,6 +415,7 @@ isValid(spv::Decoration V) {
     case DecorationInputAttachmentIndex:
     case DecorationAlignment:
     case DecorationMaxByteOffset:
+    case DecorationNonUniformEXT:
       return true;
     default:
       return false;
@@ -495,6 +496,7 @@ isValid(spv::GroupOperation V) {
     case GroupOperationReduce:
     case GroupOperationInclusiveScan:
     case GroupOperationExclusiveScan:
+    case GroupOperationClusteredReduce:
       return true;
     default:
       return false;
@@ -575,8 +577,28 @@ isValid(spv::Capability V) {
     case CapabilitySubgroupDispatch:
     case CapabilityNamedBarrier:
     case CapabilityPipeStorage:
+    case CapabilityGroupNonUniform:
+    case CapabilityGroupNonUniformVote:
+    case CapabilityGroupNonUniformArithmetic:
+    case CapabilityGroupNonUniformBallot:
+    case CapabilityGroupNonUniformShuffle:
+    case CapabilityGroupNonUniformShuffleRelative:
+    case CapabilityGroupNonUniformClustered:
+    case CapabilityGroupNonUniformQuad:
     case CapabilityStencilExportEXT:
     case CapabilityShaderViewportIndexLayerEXT:
+    case CapabilityShaderNonUniformEXT:
+    case CapabilityRuntimeDescriptorArrayEXT:
+    case CapabilityInputAttachmentArrayDynamicIndexingEXT:
+    case CapabilityUniformTexelBufferArrayDynamicIndexingEXT:
+    case CapabilityStorageTexelBufferArrayDynamicIndexingEXT:
+    case CapabilityUniformBufferArrayNonUniformIndexingEXT:
+    case CapabilitySampledImageArrayNonUniformIndexingEXT:
+    case CapabilityStorageBufferArrayNonUniformIndexingEXT:
+    case CapabilityStorageImageArrayNonUniformIndexingEXT:
+    case CapabilityInputAttachmentArrayNonUniformIndexingEXT:
+    case CapabilityUniformTexelBufferArrayNonUniformIndexingEXT:
+    case CapabilityStorageTexelBufferArrayNonUniformIndexingEXT:
       return true;
     default:
       return false;
@@ -890,6 +912,40 @@ isValid(spv::Op V) {
     case OpNamedBarrierInitialize:
     case OpMemoryNamedBarrier:
     case OpModuleProcessed:
+    case OpGroupNonUniformElect:
+    case OpGroupNonUniformAll:
+    case OpGroupNonUniformAny:
+    case OpGroupNonUniformAllEqual:
+    case OpGroupNonUniformBroadcast:
+    case OpGroupNonUniformBroadcastFirst:
+    case OpGroupNonUniformBallot:
+    case OpGroupNonUniformInverseBallot:
+    case OpGroupNonUniformBallotBitExtract:
+    case OpGroupNonUniformBallotBitCount:
+    case OpGroupNonUniformBallotFindLSB:
+    case OpGroupNonUniformBallotFindMSB:
+    case OpGroupNonUniformShuffle:
+    case OpGroupNonUniformShuffleXor:
+    case OpGroupNonUniformShuffleUp:
+    case OpGroupNonUniformShuffleDown:
+    case OpGroupNonUniformIAdd:
+    case OpGroupNonUniformFAdd:
+    case OpGroupNonUniformIMul:
+    case OpGroupNonUniformFMul:
+    case OpGroupNonUniformSMin:
+    case OpGroupNonUniformUMin:
+    case OpGroupNonUniformFMin:
+    case OpGroupNonUniformSMax:
+    case OpGroupNonUniformUMax:
+    case OpGroupNonUniformFMax:
+    case OpGroupNonUniformBitwiseAnd:
+    case OpGroupNonUniformBitwiseOr:
+    case OpGroupNonUniformBitwiseXor:
+    case OpGroupNonUniformLogicalAnd:
+    case OpGroupNonUniformLogicalOr:
+    case OpGroupNonUniformLogicalXor:
+    case OpGroupNonUniformQuadBroadcast:
+    case OpGroupNonUniformQuadSwap:
     case OpForward:
       return true;
     default:
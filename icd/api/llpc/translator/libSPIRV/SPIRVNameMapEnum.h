@@ -345,6 +345,7 @@ SPIRVMap<Decoration, std::string>::init() {
   add(DecorationInputAttachmentIndex, "InputAttachmentIndex");
   add(DecorationAlignment, "Alignment");
   add(DecorationMaxByteOffset, "MaxByteOffset");
+  add(DecorationNonUniformEXT, "NonUniformEXT");
 }
 SPIRV_DEF_NAMEMAP(Decoration, SPIRVDecorationNameMap)
 
@@ -413,6 +414,7 @@ SPIRVMap<GroupOperation, std::string>::init() {
   add(GroupOperationReduce, "Reduce");
   add(GroupOperationInclusiveScan, "InclusiveScan");
   add(GroupOperationExclusiveScan, "ExclusiveScan");
+  add(GroupOperationClusteredReduce, "ClusteredReduce");
 }
 SPIRV_DEF_NAMEMAP(GroupOperation, SPIRVGroupOperationNameMap)
 
@@ -485,6 +487,26 @@ SPIRVMap<Capability, std::string>::init() {
   add(CapabilityMultiViewport, "MultiViewport");
   add(CapabilityStencilExportEXT, "StencilExportEXT");
   add(CapabilityShaderViewportIndexLayerEXT, "ShaderViewportIndexLayerEXT");
+  add(CapabilityGroupNonUniform, "GroupNonUniform");
+  add(CapabilityGroupNonUniformVote, "GroupNonUniformVote");
+  add(CapabilityGroupNonUniformArithmetic, "GroupNonUniformArithmetic");
+  add(CapabilityGroupNonUniformBallot, "GroupNonUniformBallot");
+  add(CapabilityGroupNonUniformShuffle, "GroupNonUniformShuffle");
+  add(CapabilityGroupNonUniformShuffleRelative, "GroupNonUniformShuffleRelative");
+  add(CapabilityGroupNonUniformClustered, "GroupNonUniformClustered");
+  add(CapabilityGroupNonUniformQuad, "GroupNonUniformQuad");
+  add(CapabilityShaderNonUniformEXT, "ShaderNonUniformEXT");
+  add(CapabilityRuntimeDescriptorArrayEXT, "RuntimeDescriptorArrayEXT");
+  add(CapabilityInputAttachmentArrayDynamicIndexingEXT, "InputAttachmentArrayDynamicIndexingEXT");
+  add(CapabilityUniformTexelBufferArrayDynamicIndexingEXT, "UniformTexelBufferArrayDynamicIndexingEXT");
+  add(CapabilityStorageTexelBufferArrayDynamicIndexingEXT, "StorageTexelBufferArrayDynamicIndexingEXT");
+  add(CapabilityUniformBufferArrayNonUniformIndexingEXT, "UniformBufferArrayNonUniformIndexingEXT");
+  add(CapabilitySampledImageArrayNonUniformIndexingEXT, "SampledImageArrayNonUniformIndexingEXT");
+  add(CapabilityStorageBufferArrayNonUniformIndexingEXT, "StorageBufferArrayNonUniformIndexingEXT");
+  add(CapabilityStorageImageArrayNonUniformIndexingEXT, "StorageImageArrayNonUniformIndexingEXT");
+  add(CapabilityInputAttachmentArrayNonUniformIndexingEXT, "InputAttachmentArrayNonUniformIndexingEXT");
+  add(CapabilityUniformTexelBufferArrayNonUniformIndexingEXT, "UniformTexelBufferArrayNonUniformIndexingEXT");
+  add(CapabilityStorageTexelBufferArrayNonUniformIndexingEXT, "StorageTexelBufferArrayNonUniformIndexingEXT");
 }
 SPIRV_DEF_NAMEMAP(Capability, SPIRVCapabilityNameMap)
 
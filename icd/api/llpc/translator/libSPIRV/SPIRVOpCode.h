@@ -148,6 +148,17 @@ inline bool isGroupOpCode(Op OpCode) {
   return OpGroupAll <= OC && OC <= OpGroupSMax;
 }
 
+inline bool isGroupNonUniformOpCode(Op OpCode) {
+  unsigned OC = OpCode;
+  return OpGroupNonUniformElect <= OC && OC <= OpGroupNonUniformQuadSwap;
+}
+
+inline bool hasGroupNonUniformOperation(Op OpCode) {
+  unsigned OC = OpCode;
+  return (OpGroupNonUniformIAdd <= OC && OC <= OpGroupNonUniformLogicalXor) ||
+         (OC == OpGroupNonUniformBallotBitCount);
+}
+
 inline bool isPipeOpCode(Op OpCode) {
   unsigned OC = OpCode;
   return OpReadPipe <= OC && OC <= OpGroupCommitWritePipe;
@@ -295,4 +295,38 @@ _SPIRV_OP(TypePipeStorage, 322)
 _SPIRV_OP(ConstantPipeStorage, 323)
 _SPIRV_OP(CreatePipeFromPipeStorage, 324)
 _SPIRV_OP(ModuleProcessed, 330)
+_SPIRV_OP(GroupNonUniformElect, 333)
+_SPIRV_OP(GroupNonUniformAll, 334)
+_SPIRV_OP(GroupNonUniformAny, 335)
+_SPIRV_OP(GroupNonUniformAllEqual, 336)
+_SPIRV_OP(GroupNonUniformBroadcast, 337)
+_SPIRV_OP(GroupNonUniformBroadcastFirst, 338)
+_SPIRV_OP(GroupNonUniformBallot, 339)
+_SPIRV_OP(GroupNonUniformInverseBallot, 340)
+_SPIRV_OP(GroupNonUniformBallotBitExtract, 341)
+_SPIRV_OP(GroupNonUniformBallotBitCount, 342)
+_SPIRV_OP(GroupNonUniformBallotFindLSB, 343)
+_SPIRV_OP(GroupNonUniformBallotFindMSB, 344)
+_SPIRV_OP(GroupNonUniformShuffle, 345)
+_SPIRV_OP(GroupNonUniformShuffleXor, 346)
+_SPIRV_OP(GroupNonUniformShuffleUp, 347)
+_SPIRV_OP(GroupNonUniformShuffleDown, 348)
+_SPIRV_OP(GroupNonUniformIAdd, 349)
+_SPIRV_OP(GroupNonUniformFAdd, 350)
+_SPIRV_OP(GroupNonUniformIMul, 351)
+_SPIRV_OP(GroupNonUniformFMul, 352)
+_SPIRV_OP(GroupNonUniformSMin, 353)
+_SPIRV_OP(GroupNonUniformUMin, 354)
+_SPIRV_OP(GroupNonUniformFMin, 355)
+_SPIRV_OP(GroupNonUniformSMax, 356)
+_SPIRV_OP(GroupNonUniformUMax, 357)
+_SPIRV_OP(GroupNonUniformFMax, 358)
+_SPIRV_OP(GroupNonUniformBitwiseAnd, 359)
+_SPIRV_OP(GroupNonUniformBitwiseOr, 360)
+_SPIRV_OP(GroupNonUniformBitwiseXor, 361)
+_SPIRV_OP(GroupNonUniformLogicalAnd, 362)
+_SPIRV_OP(GroupNonUniformLogicalOr, 363)
+_SPIRV_OP(GroupNonUniformLogicalXor, 364)
+_SPIRV_OP(GroupNonUniformQuadBroadcast, 365)
+_SPIRV_OP(GroupNonUniformQuadSwap, 366)
 _SPIRV_OP(Forward, 1024)
@@ -46,6 +46,7 @@
 #endif
 #include "llpcInternal.h"
 #include "llpcMd5.h"
+#include "llpcPipelineDumper.h"
 
 namespace llvm
 {
@@ -86,8 +87,6 @@ using namespace llvm;
 namespace Llpc
 {
 
-static ManagedStatic<sys::Mutex> s_dumpMutex;
-
 // =====================================================================================================================
 // Gets the value of option "allow-out".
 bool EnableOuts()
@@ -552,6 +551,27 @@ raw_ostream& operator<<(
                         }
                         break;
                     }
+                case static_cast<Util::Abi::PipelineAbiNoteType>(ShaderStatsNoteType):
+                    {
+                        out << "    ShaderStats                  (name = "
+                            << pNode->name << "  size = " << pNode->descSize << ")\n";
+
+                        const uint32_t statsCount = pNode->descSize / sizeof(ShaderStats);
+                        auto pStats = reinterpret_cast<const ShaderStats*>(pSection->pData + offset + noteHeaderSize);
+
+                        for (uint32_t i = 0; i < statsCount; ++i)
+                        {
+                            out << "        " << GetShaderStageName(pStats[i].shaderStage) << " shader:\n";
+                            out << "            numUsedVgprs       = " << pStats[i].numUsedVgprs << "\n";
+                            out << "            numUsedSgprs       = " << pStats[i].numUsedSgprs << "\n";
+                            out << "            ldsSizeInBytes     = " << pStats[i].ldsSizeInBytes << "\n";
+                            out << "            scratchSizeInBytes = " << pStats[i].scratchSizeInBytes << "\n";
+                            out << "            instructionCount   = " << pStats[i].instructionCount << "\n";
+                            out << "            codeSizeInBytes    = " << pStats[i].codeSizeInBytes << "\n";
+                            out << "            occupancy          = " << pStats[i].occupancy << "\n";
+                        }
+                        break;
+                    }
                 default:
                     {
                         out << "    unknown note type " << (uint32_t)pNode->type << "\n";
@@ -725,39 +745,19 @@ std::string GetPipelineInfoFileName(
 }
 
 // =====================================================================================================================
-// Creates a file to dump graphics/compute pipeline info.
-raw_fd_ostream* CreatePipelineDumpFile(
+// Gets the full path name of the file to dump graphics/compute pipeline info.
+std::string GetPipelineDumpFileName(
     const char*                      pDumpDir,               // [in] Directory of pipeline dump
     const ComputePipelineBuildInfo*  pComputePipelineInfo,   // [in] Info of the compute pipeline to be built
     const GraphicsPipelineBuildInfo* pGraphicsPipelineInfo,  // [in] Info of the graphics pipeline to be built
     const Md5::Hash*                 pHash)                  // [in] Pipeline hash code
 {
-    std::error_code errCode;
-
     std::string dumpFileName = pDumpDir;
     dumpFileName += "/";
     dumpFileName += GetPipelineInfoFileName(pComputePipelineInfo, pGraphicsPipelineInfo, pHash);
     dumpFileName += ".pipe";
 
-    // Open dump file
-    s_dumpMutex->lock();
-    raw_fd_ostream* pDumpFile = new raw_fd_ostream(dumpFileName, errCode, sys::fs::F_Text);
-    if (errCode.value() != 0)
-    {
-        delete pDumpFile;
-        pDumpFile = nullptr;
-        s_dumpMutex->unlock();
-    }
-    return pDumpFile;
-}
-
-// =====================================================================================================================
-// Destroys the file used for dumping graphics/compute pipeline info.
-void DestroyPipelineDumpFile(
-    raw_fd_ostream* pDumpFile) // [in] Dump file
-{
-    delete pDumpFile;
-    s_dumpMutex->unlock();
+    return dumpFileName;
 }
 
 // =====================================================================================================================
@@ -765,7 +765,7 @@ void DestroyPipelineDumpFile(
 void DumpResourceMappingNode(
     const ResourceMappingNode* pUserDataNode,    // [in] User data nodes to be dumped
     const char*                pPrefix,          // [in] Prefix string for each line
-    raw_fd_ostream&            dumpFile)         // [out] dump file
+    raw_ostream&               dumpFile)         // [out] dump file
 {
     dumpFile << pPrefix << ".type = " << pUserDataNode->type << "\n";
     dumpFile << pPrefix << ".offsetInDwords = " << pUserDataNode->offsetInDwords << "\n";
@@ -818,7 +818,7 @@ void DumpResourceMappingNode(
 void DumpPipelineShaderInfo(
     ShaderStage               stage,       // Shader stage
     const PipelineShaderInfo* pShaderInfo, // [in] Shader info of specified shader stage
-    raw_fd_ostream&           dumpFile)    // [out] dump file
+    raw_ostream&              dumpFile)    // [out] dump file
 {
     const ShaderModuleData* pModuleData = reinterpret_cast<const ShaderModuleData*>(pShaderInfo->pModuleData);
 
@@ -906,26 +906,25 @@ void DumpPipelineShaderInfo(
 void DumpSpirvBinary(
     const char*                     pDumpDir,     // [in] Directory of pipeline dump
     const BinaryData*               pSpirvBin,    // [in] SPIR-V binary
-    Md5::Hash*                      pHash)        // [in] Pipeline hash code
+    Md5::Hash*                      pHash)        // [in] Shader hash code
 {
-    std::error_code errCode = {};
+    PipelineDumper* pDumper = PipelineDumper::Get();
 
-    std::string pathName = pDumpDir;
-    pathName += "/";
-    pathName += GetSpirvBinaryFileName(pHash);
-
-    // Open dumpfile
-    raw_fd_ostream dumpFile(pathName, errCode, sys::fs::F_None);
-    if (errCode.value() == 0)
+    // The same shader module is often created many times; only the first one is written.
+    if (pDumper->BeginDump(Md5::Compact64(pHash)))
     {
-        dumpFile.write(reinterpret_cast<const char*>(pSpirvBin->pCode), pSpirvBin->codeSize);
+        std::string pathName = pDumpDir;
+        pathName += "/";
+        pathName += GetSpirvBinaryFileName(pHash);
+
+        pDumper->WriteBinary(pathName, pSpirvBin);
     }
 }
 
 // =====================================================================================================================
-// Disassembles pipeline binary and dumps it to pipeline info file.
+// Disassembles pipeline binary and dumps it to output stream.
 void DumpPipelineBinary(
-    raw_fd_ostream*                  pDumpFile,              // [in] Directory of pipeline dump
+    raw_ostream*                     pDumpFile,              // [out] Pipeline dump stream
     GfxIpVersion                     gfxIp,                  // Graphics IP version info
     const BinaryData*                pPipelineBin)           // [in] Pipeline binary (ELF)
 {
@@ -941,7 +940,7 @@ void DumpPipelineBinary(
 // =====================================================================================================================
 // Dumps LLPC version info to file
 void DumpVersionInfo(
-    raw_fd_ostream&                  dumpFile)      // [out] dump file
+    raw_ostream&                     dumpFile)      // [out] dump file
 {
     dumpFile << "[Version]\n";
     dumpFile << "version = " << Version << "\n\n";
@@ -951,7 +950,7 @@ void DumpVersionInfo(
 // Dumps compute pipeline state info to file.
 void DumpComputeStateInfo(
     const ComputePipelineBuildInfo* pPipelineInfo,  // [in] Info of the graphics pipeline to be built
-    raw_fd_ostream&                  dumpFile)      // [out] dump file
+    raw_ostream&                     dumpFile)      // [out] dump file
 {
     dumpFile << "[ComputePipelineState]\n";
 
@@ -962,7 +961,7 @@ void DumpComputeStateInfo(
 // =====================================================================================================================
 // Dumps compute pipeline information to file.
 void DumpComputePipelineInfo(
-    raw_fd_ostream*                 pDumpFile,         // [in] Pipeline dump file
+    raw_ostream*                    pDumpFile,         // [out] Pipeline dump stream
     const ComputePipelineBuildInfo* pPipelineInfo      // [in] Info of the compute pipeline to be built
     )
 {
@@ -977,7 +976,7 @@ void DumpComputePipelineInfo(
 // Dumps graphics pipeline state info to file.
 void DumpGraphicsStateInfo(
     const GraphicsPipelineBuildInfo* pPipelineInfo, // [in] Info of the graphics pipeline to be built
-    raw_fd_ostream&                  dumpFile)      // [out] dump file
+    raw_ostream&                     dumpFile)      // [out] dump file
 {
     dumpFile << "[GraphicsPipelineState]\n";
 
@@ -1037,7 +1036,7 @@ void DumpGraphicsStateInfo(
 // =====================================================================================================================
 // Dumps graphics pipeline build info to file.
 void DumpGraphicsPipelineInfo(
-    raw_fd_ostream*                  pDumpFile,       // [in] Pipeline dump file
+    raw_ostream*                     pDumpFile,       // [out] Pipeline dump stream
     const GraphicsPipelineBuildInfo* pPipelineInfo)   // [in] Info of the graphics pipeline to be built
 {
     DumpVersionInfo(*pDumpFile);
@@ -57,6 +57,8 @@
 // Output general message
 #define LLPC_OUTS(_msg) { if (EnableOuts()) { outs() << _msg; } }
 
+#include <string>
+
 namespace llvm { class raw_ostream; }
 namespace llvm { class raw_fd_ostream; }
 
@@ -80,36 +82,32 @@ bool EnableOuts();
 // Gets the value of option "enable-errs"
 bool EnableErrs();
 
-// Creates a file to dump graphics/compute pipeline info.
-llvm::raw_fd_ostream* CreatePipelineDumpFile(
+// Gets the full path name of the file to dump graphics/compute pipeline info.
+std::string GetPipelineDumpFileName(
     const char*                      pDumpDir,
     const ComputePipelineBuildInfo*  pComputePipelineInfo,
     const GraphicsPipelineBuildInfo* pGraphicsPipelineInfo,
     const Md5::Hash*                 pHash);
 
-// Destroys the file used for dumping graphics/compute pipeline info.
-void DestroyPipelineDumpFile(
-    llvm::raw_fd_ostream* pDumpFile);
-
 // Dumps SPIRV shader binary to extenal file
 void DumpSpirvBinary(
     const char*                     pDumpDir,
     const BinaryData*               pSpirvBin,
     Md5::Hash*                      pHash);
 
-// Dumps compute pipeline info to extenal file
+// Dumps compute pipeline info to output stream
 void DumpComputePipelineInfo(
-    llvm::raw_fd_ostream*           pDumpFile,
+    llvm::raw_ostream*              pDumpFile,
     const ComputePipelineBuildInfo* pPipelineInfo);
 
-// Dumps graphics pipeline info to extenal file
+// Dumps graphics pipeline info to output stream
 void DumpGraphicsPipelineInfo(
-    llvm::raw_fd_ostream*            pDumpFile,
+    llvm::raw_ostream*               pDumpFile,
     const GraphicsPipelineBuildInfo* pPipelineInfo);
 
-// Disassembles pipeline binary and dumps it to pipeline info file
+// Disassembles pipeline binary and dumps it to output stream
 void DumpPipelineBinary(
-    llvm::raw_fd_ostream*            pDumpFile,
+    llvm::raw_ostream*               pDumpFile,
     GfxIpVersion                     gfxIp,
     const BinaryData*                pPipelineBin);
 
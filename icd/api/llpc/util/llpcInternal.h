@@ -337,19 +337,26 @@ struct TimeProfileResult
 class TimeProfiler
 {
 public:
-    TimeProfiler(int64_t* pAccumTime)
+    TimeProfiler(int64_t* pAccumTime, int64_t* pStageAccumTime = nullptr)
     {
         m_pAccumTime = pAccumTime;
+        m_pStageAccumTime = pStageAccumTime;
         m_startTime = GetPerfCpuTime();
     }
 
     ~TimeProfiler()
     {
-        *m_pAccumTime += (GetPerfCpuTime() - m_startTime);
+        const int64_t elapsedTime = GetPerfCpuTime() - m_startTime;
+        *m_pAccumTime += elapsedTime;
+        if (m_pStageAccumTime != nullptr)
+        {
+            *m_pStageAccumTime += elapsedTime;
+        }
     }
 
-    int64_t m_startTime;     // Start time
-    int64_t* m_pAccumTime;   // Pointer to accumulated time
+    int64_t m_startTime;          // Start time
+    int64_t* m_pAccumTime;        // Pointer to accumulated time
+    int64_t* m_pStageAccumTime;   // Pointer to accumulated time of a particular shader stage (optional)
 };
 
 } // Llpc
@@ -0,0 +1,269 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  llpcPipelineDumper.cpp
+ * @brief LLPC source file: contains implementation of class Llpc::PipelineDumper.
+ ***********************************************************************************************************************
+ */
+#define DEBUG_TYPE "llpc-pipeline-dumper"
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Compression.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+
+#include "llpcDebug.h"
+#include "llpcPipelineDumper.h"
+
+namespace llvm
+{
+
+namespace cl
+{
+
+// -pipeline-dump-queue-size: maximum number of pipeline dump files waiting to be written
+static opt<uint32_t> PipelineDumpQueueSize("pipeline-dump-queue-size",
+                                           desc("Maximum number of pipeline dump files waiting to be written, "
+                                                "compiles block when the queue is full"),
+                                           init(64));
+
+// -pipeline-dump-compress: compress pipeline dump files with zlib
+static opt<bool> PipelineDumpCompress("pipeline-dump-compress",
+                                      desc("Compress pipeline dump files with zlib (written with extension .z)"),
+                                      init(false));
+
+} // cl
+
+} // llvm
+
+using namespace llvm;
+
+namespace Llpc
+{
+
+static ManagedStatic<PipelineDumper> s_pipelineDumper;
+
+// =====================================================================================================================
+PipelineDumper::PipelineDumper()
+    :
+    m_activeJobCount(0),
+    m_exit(false)
+{
+}
+
+// =====================================================================================================================
+// Writes all pending dump files, then stops the writer thread.
+PipelineDumper::~PipelineDumper()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_exit = true;
+    }
+    m_jobQueuedCond.notify_all();
+
+    if (m_writerThread.joinable())
+    {
+        m_writerThread.join();
+    }
+}
+
+// =====================================================================================================================
+// Gets the global pipeline dumper.
+PipelineDumper* PipelineDumper::Get()
+{
+    return &*s_pipelineDumper;
+}
+
+// =====================================================================================================================
+// Registers a dump of the pipeline or shader with the specified hash. Returns false if it has been dumped already, in
+// which case the caller should skip dumping it.
+bool PipelineDumper::BeginDump(
+    uint64_t hash)  // Hash code of the pipeline or shader
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_dumpedHashes.insert(hash).second;
+}
+
+// =====================================================================================================================
+// Queues a binary file (e.g. SPIR-V) to be written.
+void PipelineDumper::WriteBinary(
+    const std::string& fileName,   // [in] Full path name of the file
+    const BinaryData*  pBinary)    // [in] Content of the file
+{
+    DumpJob job = {};
+    job.fileName = fileName;
+    job.content.assign(static_cast<const char*>(pBinary->pCode), pBinary->codeSize);
+    job.isBinary = true;
+
+    Enqueue(&job);
+}
+
+// =====================================================================================================================
+// Queues a pipeline info file to be written. The disassembly of the pipeline binary, if any, is appended to the
+// pipeline info by the writer thread.
+void PipelineDumper::WritePipeline(
+    const std::string& fileName,       // [in] Full path name of the file
+    std::string&&      pipelineInfo,   // [in] Formatted pipeline info
+    GfxIpVersion       gfxIp,          // Graphics IP version info
+    const BinaryData*  pPipelineBin)   // [in] Pipeline binary (ELF), may be null if the compile failed
+{
+    DumpJob job = {};
+    job.fileName = fileName;
+    job.content  = std::move(pipelineInfo);
+    job.gfxIp    = gfxIp;
+    job.isBinary = false;
+
+    if (pPipelineBin != nullptr)
+    {
+        const char* pCode = static_cast<const char*>(pPipelineBin->pCode);
+        job.pipelineBin.assign(pCode, pCode + pPipelineBin->codeSize);
+    }
+
+    Enqueue(&job);
+}
+
+// =====================================================================================================================
+// Waits until all queued dump files have been written.
+void PipelineDumper::Flush()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    while ((m_jobs.empty() == false) || (m_activeJobCount > 0))
+    {
+        m_jobDoneCond.wait(lock);
+    }
+}
+
+// =====================================================================================================================
+// Forgets which pipelines and shaders have been dumped, so that they are dumped again by subsequent compiles.
+void PipelineDumper::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_dumpedHashes.clear();
+}
+
+// =====================================================================================================================
+// Moves the specified job into the queue, blocking while the queue is full.
+void PipelineDumper::Enqueue(
+    DumpJob* pJob)  // [in] Job to be queued, its content is moved away
+{
+    const size_t maxQueueSize = std::max(static_cast<uint32_t>(cl::PipelineDumpQueueSize), 1u);
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (m_jobs.size() >= maxQueueSize)
+    {
+        m_jobDoneCond.wait(lock);
+    }
+
+    if (m_writerThread.joinable() == false)
+    {
+        m_writerThread = std::thread(&PipelineDumper::WriterThreadFunc, this);
+    }
+
+    m_jobs.push_back(std::move(*pJob));
+    m_jobQueuedCond.notify_one();
+}
+
+// =====================================================================================================================
+// Main loop of the writer thread. Writes queued jobs in order until it is asked to exit and the queue is empty.
+void PipelineDumper::WriterThreadFunc()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    while (true)
+    {
+        while (m_jobs.empty() && (m_exit == false))
+        {
+            m_jobQueuedCond.wait(lock);
+        }
+
+        if (m_jobs.empty())
+        {
+            break;
+        }
+
+        DumpJob job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        ++m_activeJobCount;
+        m_jobDoneCond.notify_all();
+
+        lock.unlock();
+        WriteFile(&job);
+        lock.lock();
+
+        --m_activeJobCount;
+        m_jobDoneCond.notify_all();
+    }
+}
+
+// =====================================================================================================================
+// Writes the file of the specified job. Runs on the writer thread.
+void PipelineDumper::WriteFile(
+    DumpJob* pJob)  // [in] Job to be written
+{
+    std::string fileName = pJob->fileName;
+
+    if (pJob->pipelineBin.empty() == false)
+    {
+        BinaryData pipelineBin = {};
+        pipelineBin.codeSize = pJob->pipelineBin.size();
+        pipelineBin.pCode    = pJob->pipelineBin.data();
+
+        raw_string_ostream contentStream(pJob->content);
+        DumpPipelineBinary(&contentStream, pJob->gfxIp, &pipelineBin);
+        contentStream.flush();
+    }
+
+    bool isBinary = pJob->isBinary;
+
+    if (cl::PipelineDumpCompress && zlib::isAvailable())
+    {
+        SmallVector<char, 0> compressed;
+        if (Error err = zlib::compress(pJob->content, compressed))
+        {
+            // Fall back to write the file uncompressed
+            consumeError(std::move(err));
+        }
+        else
+        {
+            pJob->content.assign(compressed.begin(), compressed.end());
+            fileName += ".z";
+            isBinary = true;
+        }
+    }
+
+    std::error_code errCode;
+    raw_fd_ostream dumpFile(fileName, errCode, isBinary ? sys::fs::F_None : sys::fs::F_Text);
+    if (errCode.value() == 0)
+    {
+        dumpFile.write(pJob->content.data(), pJob->content.size());
+    }
+}
+
+} // Llpc
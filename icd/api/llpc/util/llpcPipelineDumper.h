@@ -0,0 +1,104 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  llpcPipelineDumper.h
+ * @brief LLPC header file: contains declaration of class Llpc::PipelineDumper.
+ ***********************************************************************************************************************
+ */
+#pragma once
+
+#include "llpc.h"
+#include "llpcInternal.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Llpc
+{
+
+// =====================================================================================================================
+// Writes pipeline dump files (pipeline info with ELF disassembly, and SPIR-V binaries) on a background thread.
+//
+// The compile path only formats the pipeline info and copies the binaries. ELF disassembly, optional compression and
+// file I/O are done by the writer thread. Dumps are deduplicated by hash, and the job queue is bounded so that a slow
+// disk throttles the compiling threads instead of growing memory without limit.
+class PipelineDumper
+{
+public:
+    PipelineDumper();
+    ~PipelineDumper();
+
+    static PipelineDumper* Get();
+
+    bool BeginDump(uint64_t hash);
+
+    void WriteBinary(const std::string& fileName, const BinaryData* pBinary);
+
+    void WritePipeline(const std::string& fileName,
+                       std::string&&      pipelineInfo,
+                       GfxIpVersion       gfxIp,
+                       const BinaryData*  pPipelineBin);
+
+    void Flush();
+
+    void Reset();
+
+private:
+    LLPC_DISALLOW_COPY_AND_ASSIGN(PipelineDumper);
+
+    // Represents a dump file waiting to be written by the writer thread
+    struct DumpJob
+    {
+        std::string       fileName;     // Full path name of the file
+        std::string       content;      // Text or binary content of the file
+        std::vector<char> pipelineBin;  // Pipeline ELF whose disassembly is appended to the content (may be empty)
+        GfxIpVersion      gfxIp;        // Graphics IP version info, used to disassemble the pipeline ELF
+        bool              isBinary;     // Whether the file is a binary file
+    };
+
+    void Enqueue(DumpJob* pJob);
+    void WriterThreadFunc();
+
+    static void WriteFile(DumpJob* pJob);
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    std::mutex                   m_lock;            // Lock of all members below
+    std::condition_variable      m_jobQueuedCond;   // Signaled when a job is queued or the writer should exit
+    std::condition_variable      m_jobDoneCond;     // Signaled when a job is dequeued or written
+    std::deque<DumpJob>          m_jobs;            // Jobs waiting to be written
+    uint32_t                     m_activeJobCount;  // Number of jobs being written by the writer thread
+    std::unordered_set<uint64_t> m_dumpedHashes;    // Hashes of pipelines and shaders that have been dumped
+    std::thread                  m_writerThread;    // Writer thread, started on the first dump
+    bool                         m_exit;            // Whether the writer thread should exit
+};
+
+} // Llpc
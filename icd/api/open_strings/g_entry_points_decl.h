@@ -695,6 +695,42 @@ extern const char vkTrimCommandPoolKHR_name[];
 static const char* VKTRIMCOMMANDPOOLKHR_name = vkTrimCommandPoolKHR_name;
 #define vkTrimCommandPoolKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
 #define vkTrimCommandPoolKHR_condition_value vk::DeviceExtensions::KHR_MAINTENANCE1
+extern const char vkCmdPushDescriptorSetKHR_name[];
+static const char* VKCMDPUSHDESCRIPTORSETKHR_name = vkCmdPushDescriptorSetKHR_name;
+#define vkCmdPushDescriptorSetKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdPushDescriptorSetKHR_condition_value vk::DeviceExtensions::KHR_PUSH_DESCRIPTOR
+extern const char vkCmdPushDescriptorSetWithTemplateKHR_name[];
+static const char* VKCMDPUSHDESCRIPTORSETWITHTEMPLATEKHR_name = vkCmdPushDescriptorSetWithTemplateKHR_name;
+#define vkCmdPushDescriptorSetWithTemplateKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdPushDescriptorSetWithTemplateKHR_condition_value vk::DeviceExtensions::KHR_PUSH_DESCRIPTOR
+extern const char vkGetSemaphoreCounterValueKHR_name[];
+static const char* VKGETSEMAPHORECOUNTERVALUEKHR_name = vkGetSemaphoreCounterValueKHR_name;
+#define vkGetSemaphoreCounterValueKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkGetSemaphoreCounterValueKHR_condition_value vk::DeviceExtensions::KHR_TIMELINE_SEMAPHORE
+extern const char vkWaitSemaphoresKHR_name[];
+static const char* VKWAITSEMAPHORESKHR_name = vkWaitSemaphoresKHR_name;
+#define vkWaitSemaphoresKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkWaitSemaphoresKHR_condition_value vk::DeviceExtensions::KHR_TIMELINE_SEMAPHORE
+extern const char vkSignalSemaphoreKHR_name[];
+static const char* VKSIGNALSEMAPHOREKHR_name = vkSignalSemaphoreKHR_name;
+#define vkSignalSemaphoreKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkSignalSemaphoreKHR_condition_value vk::DeviceExtensions::KHR_TIMELINE_SEMAPHORE
+extern const char vkCmdDrawIndirectCountKHR_name[];
+static const char* VKCMDDRAWINDIRECTCOUNTKHR_name = vkCmdDrawIndirectCountKHR_name;
+#define vkCmdDrawIndirectCountKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdDrawIndirectCountKHR_condition_value vk::DeviceExtensions::KHR_DRAW_INDIRECT_COUNT
+extern const char vkCmdDrawIndexedIndirectCountKHR_name[];
+static const char* VKCMDDRAWINDEXEDINDIRECTCOUNTKHR_name = vkCmdDrawIndexedIndirectCountKHR_name;
+#define vkCmdDrawIndexedIndirectCountKHR_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdDrawIndexedIndirectCountKHR_condition_value vk::DeviceExtensions::KHR_DRAW_INDIRECT_COUNT
+extern const char vkCmdBeginConditionalRenderingEXT_name[];
+static const char* VKCMDBEGINCONDITIONALRENDERINGEXT_name = vkCmdBeginConditionalRenderingEXT_name;
+#define vkCmdBeginConditionalRenderingEXT_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdBeginConditionalRenderingEXT_condition_value vk::DeviceExtensions::EXT_CONDITIONAL_RENDERING
+extern const char vkCmdEndConditionalRenderingEXT_name[];
+static const char* VKCMDENDCONDITIONALRENDERINGEXT_name = vkCmdEndConditionalRenderingEXT_name;
+#define vkCmdEndConditionalRenderingEXT_condition_type vk::secure::entry::ENTRY_POINT_DEVICE_EXTENSION
+#define vkCmdEndConditionalRenderingEXT_condition_value vk::DeviceExtensions::EXT_CONDITIONAL_RENDERING
 extern const char vkDestroySurfaceKHR_name[];
 static const char* VKDESTROYSURFACEKHR_name = vkDestroySurfaceKHR_name;
 #define vkDestroySurfaceKHR_condition_type vk::secure::entry::ENTRY_POINT_INSTANCE_EXTENSION
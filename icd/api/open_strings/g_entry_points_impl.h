@@ -191,6 +191,15 @@ const char vkGetSemaphoreFdKHR_name[] = "vkGetSemaphoreFdKHR";
 const char vkImportSemaphoreWin32HandleKHR_name[] = "vkImportSemaphoreWin32HandleKHR";
 const char vkGetSemaphoreWin32HandleKHR_name[] = "vkGetSemaphoreWin32HandleKHR";
 const char vkTrimCommandPoolKHR_name[] = "vkTrimCommandPoolKHR";
+const char vkCmdPushDescriptorSetKHR_name[] = "vkCmdPushDescriptorSetKHR";
+const char vkCmdPushDescriptorSetWithTemplateKHR_name[] = "vkCmdPushDescriptorSetWithTemplateKHR";
+const char vkGetSemaphoreCounterValueKHR_name[] = "vkGetSemaphoreCounterValueKHR";
+const char vkWaitSemaphoresKHR_name[] = "vkWaitSemaphoresKHR";
+const char vkSignalSemaphoreKHR_name[] = "vkSignalSemaphoreKHR";
+const char vkCmdDrawIndirectCountKHR_name[] = "vkCmdDrawIndirectCountKHR";
+const char vkCmdDrawIndexedIndirectCountKHR_name[] = "vkCmdDrawIndexedIndirectCountKHR";
+const char vkCmdBeginConditionalRenderingEXT_name[] = "vkCmdBeginConditionalRenderingEXT";
+const char vkCmdEndConditionalRenderingEXT_name[] = "vkCmdEndConditionalRenderingEXT";
 const char vkDestroySurfaceKHR_name[] = "vkDestroySurfaceKHR";
 const char vkGetPhysicalDeviceSurfaceCapabilitiesKHR_name[] = "vkGetPhysicalDeviceSurfaceCapabilitiesKHR";
 const char vkGetPhysicalDeviceSurfaceFormatsKHR_name[] = "vkGetPhysicalDeviceSurfaceFormatsKHR";
@@ -71,6 +71,12 @@ extern const char VK_KHR_maintenance1_name[];
 static const char* VK_KHR_MAINTENANCE1_name = VK_KHR_maintenance1_name;
 extern const char VK_KHR_maintenance2_name[];
 static const char* VK_KHR_MAINTENANCE2_name = VK_KHR_maintenance2_name;
+extern const char VK_KHR_push_descriptor_name[];
+static const char* VK_KHR_PUSH_DESCRIPTOR_name = VK_KHR_push_descriptor_name;
+extern const char VK_KHR_timeline_semaphore_name[];
+static const char* VK_KHR_TIMELINE_SEMAPHORE_name = VK_KHR_timeline_semaphore_name;
+extern const char VK_KHR_draw_indirect_count_name[];
+static const char* VK_KHR_DRAW_INDIRECT_COUNT_name = VK_KHR_draw_indirect_count_name;
 extern const char VK_KHR_relaxed_block_layout_name[];
 static const char* VK_KHR_RELAXED_BLOCK_LAYOUT_name = VK_KHR_relaxed_block_layout_name;
 extern const char VK_KHR_sampler_mirror_clamp_to_edge_name[];
@@ -125,5 +131,13 @@ extern const char VK_AMD_shader_fragment_mask_name[];
 static const char* VK_AMD_SHADER_FRAGMENT_MASK_name = VK_AMD_shader_fragment_mask_name;
 extern const char VK_EXT_sample_locations_name[];
 static const char* VK_EXT_SAMPLE_LOCATIONS_name = VK_EXT_sample_locations_name;
+extern const char VK_EXT_descriptor_indexing_name[];
+static const char* VK_EXT_DESCRIPTOR_INDEXING_name = VK_EXT_descriptor_indexing_name;
+extern const char VK_EXT_pipeline_creation_feedback_name[];
+static const char* VK_EXT_PIPELINE_CREATION_FEEDBACK_name = VK_EXT_pipeline_creation_feedback_name;
+extern const char VK_EXT_conditional_rendering_name[];
+static const char* VK_EXT_CONDITIONAL_RENDERING_name = VK_EXT_conditional_rendering_name;
+extern const char VK_EXT_memory_budget_name[];
+static const char* VK_EXT_MEMORY_BUDGET_name = VK_EXT_memory_budget_name;
 extern const char VK_KHR_win32_keyed_mutex_name[];
 static const char* VK_KHR_WIN32_KEYED_MUTEX_name = VK_KHR_win32_keyed_mutex_name;
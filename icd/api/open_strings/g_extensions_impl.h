@@ -47,6 +47,9 @@ const char VK_KHR_external_fence_fd_name[] = "VK_KHR_external_fence_fd";
 const char VK_KHR_external_fence_win32_name[] = "VK_KHR_external_fence_win32";
 const char VK_KHR_maintenance1_name[] = "VK_KHR_maintenance1";
 const char VK_KHR_maintenance2_name[] = "VK_KHR_maintenance2";
+const char VK_KHR_push_descriptor_name[] = "VK_KHR_push_descriptor";
+const char VK_KHR_timeline_semaphore_name[] = "VK_KHR_timeline_semaphore";
+const char VK_KHR_draw_indirect_count_name[] = "VK_KHR_draw_indirect_count";
 const char VK_KHR_relaxed_block_layout_name[] = "VK_KHR_relaxed_block_layout";
 const char VK_KHR_sampler_mirror_clamp_to_edge_name[] = "VK_KHR_sampler_mirror_clamp_to_edge";
 const char VK_KHR_shader_draw_parameters_name[] = "VK_KHR_shader_draw_parameters";
@@ -74,4 +77,8 @@ const char VK_EXT_shader_viewport_index_layer_name[] = "VK_EXT_shader_viewport_i
 const char VK_KHR_get_memory_requirements2_name[] = "VK_KHR_get_memory_requirements2";
 const char VK_AMD_shader_fragment_mask_name[] = "VK_AMD_shader_fragment_mask";
 const char VK_EXT_sample_locations_name[] = "VK_EXT_sample_locations";
+const char VK_EXT_descriptor_indexing_name[] = "VK_EXT_descriptor_indexing";
+const char VK_EXT_pipeline_creation_feedback_name[] = "VK_EXT_pipeline_creation_feedback";
+const char VK_EXT_conditional_rendering_name[] = "VK_EXT_conditional_rendering";
+const char VK_EXT_memory_budget_name[] = "VK_EXT_memory_budget";
 const char VK_KHR_win32_keyed_mutex_name[] = "VK_KHR_win32_keyed_mutex";
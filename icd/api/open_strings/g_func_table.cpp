@@ -790,6 +790,50 @@ extern void GetNextDeviceLayerTable(
                            pInstance, pDevice, remainingCount, pRemainingTables,
                            VK_SECURE_ENTRY(vkTrimCommandPoolKHR)));
 #endif
+#if VK_KHR_push_descriptor
+    pNextLayerFuncs->vkCmdPushDescriptorSetKHR =
+                       reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdPushDescriptorSetKHR)));
+    pNextLayerFuncs->vkCmdPushDescriptorSetWithTemplateKHR =
+                       reinterpret_cast<PFN_vkCmdPushDescriptorSetWithTemplateKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdPushDescriptorSetWithTemplateKHR)));
+#endif
+#if VK_KHR_timeline_semaphore
+    pNextLayerFuncs->vkGetSemaphoreCounterValueKHR =
+                       reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkGetSemaphoreCounterValueKHR)));
+    pNextLayerFuncs->vkWaitSemaphoresKHR =
+                       reinterpret_cast<PFN_vkWaitSemaphoresKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkWaitSemaphoresKHR)));
+    pNextLayerFuncs->vkSignalSemaphoreKHR =
+                       reinterpret_cast<PFN_vkSignalSemaphoreKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkSignalSemaphoreKHR)));
+#endif
+#if VK_KHR_draw_indirect_count
+    pNextLayerFuncs->vkCmdDrawIndirectCountKHR =
+                       reinterpret_cast<PFN_vkCmdDrawIndirectCountKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdDrawIndirectCountKHR)));
+    pNextLayerFuncs->vkCmdDrawIndexedIndirectCountKHR =
+                       reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdDrawIndexedIndirectCountKHR)));
+#endif
+#if VK_EXT_conditional_rendering
+    pNextLayerFuncs->vkCmdBeginConditionalRenderingEXT =
+                       reinterpret_cast<PFN_vkCmdBeginConditionalRenderingEXT>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdBeginConditionalRenderingEXT)));
+    pNextLayerFuncs->vkCmdEndConditionalRenderingEXT =
+                       reinterpret_cast<PFN_vkCmdEndConditionalRenderingEXT>(vk::GetIcdProcAddr(
+                           pInstance, pDevice, remainingCount, pRemainingTables,
+                           VK_SECURE_ENTRY(vkCmdEndConditionalRenderingEXT)));
+#endif
 #if VK_KHR_surface
     pNextLayerFuncs->vkDestroySurfaceKHR =
                        reinterpret_cast<PFN_vkDestroySurfaceKHR>(vk::GetIcdProcAddr(
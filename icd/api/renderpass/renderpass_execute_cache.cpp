@@ -0,0 +1,212 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#include "include/vk_device.h"
+#include "include/vk_instance.h"
+
+#include "renderpass/renderpass_execute_cache.h"
+
+#include "palHashMapImpl.h"
+
+namespace vk
+{
+
+// =====================================================================================================================
+RenderPassExecuteCache::RenderPassExecuteCache(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entries(NumEntryBuckets, pDevice->VkInstance()->Allocator()),
+    m_refs(NumEntryBuckets, pDevice->VkInstance()->Allocator()),
+    m_lookupCount(0),
+    m_hitCount(0)
+{
+
+}
+
+// =====================================================================================================================
+// Initializes the cache.  Should be called during device create.
+VkResult RenderPassExecuteCache::Init()
+{
+    Pal::Result result = m_mutex.Init();
+
+    if (result == Pal::Result::Success)
+    {
+        result = m_entries.Init();
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        result = m_refs.Init();
+    }
+
+    return PalToVkResult(result);
+}
+
+// =====================================================================================================================
+// Destroys the cache.  Should be called during device destroy, after all render passes have been destroyed.
+void RenderPassExecuteCache::Destroy()
+{
+    Util::MutexAuto lock(&m_mutex);
+
+    for (auto it = m_refs.Begin(); it.Get() != nullptr; it.Next())
+    {
+        Entry* pEntry = it.Get()->value;
+
+        m_pDevice->VkInstance()->FreeMem(pEntry->pExecuteInfo);
+        m_pDevice->VkInstance()->FreeMem(pEntry);
+    }
+}
+
+// =====================================================================================================================
+// Looks up a previously built execute info by the structural hash of a render pass create info.  On a hit, the
+// returned execute info is referenced and must be released with Release() when the render pass is destroyed.
+const RenderPassExecuteInfo* RenderPassExecuteCache::Find(
+    const Util::Md5::Hash& hash)
+{
+    const RenderPassExecuteInfo* pExecuteInfo = nullptr;
+
+    Util::MutexAuto lock(&m_mutex);
+
+    m_lookupCount++;
+
+    Entry** ppEntry = m_entries.FindKey(hash);
+
+    if (ppEntry != nullptr)
+    {
+        VK_ASSERT((*ppEntry)->refCount > 0);
+
+        (*ppEntry)->refCount++;
+
+        pExecuteInfo = (*ppEntry)->pExecuteInfo;
+
+        m_hitCount++;
+    }
+
+    return pExecuteInfo;
+}
+
+// =====================================================================================================================
+// Adds a newly built execute info to the cache and returns the shared execute info to use, which is referenced.  The
+// cache takes ownership of the given execute info: if another thread has inserted an execute info for the same hash
+// in the meantime, or on failure, the given one is freed.  Returns nullptr on failure.
+const RenderPassExecuteInfo* RenderPassExecuteCache::Insert(
+    const Util::Md5::Hash& hash,
+    RenderPassExecuteInfo* pExecuteInfo)
+{
+    Util::MutexAuto lock(&m_mutex);
+
+    bool    existed = false;
+    Entry** ppEntry = nullptr;
+
+    Pal::Result result = m_entries.FindAllocate(hash, &existed, &ppEntry);
+
+    if ((result == Pal::Result::Success) && (existed == false))
+    {
+        Entry* pNewEntry = static_cast<Entry*>(m_pDevice->VkInstance()->AllocMem(
+            sizeof(Entry), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE));
+
+        if (pNewEntry != nullptr)
+        {
+            pNewEntry->hash         = hash;
+            pNewEntry->pExecuteInfo = pExecuteInfo;
+            pNewEntry->refCount     = 0;
+
+            result = m_refs.Insert(pExecuteInfo, pNewEntry);
+
+            if (result == Pal::Result::Success)
+            {
+                *ppEntry = pNewEntry;
+            }
+            else
+            {
+                m_pDevice->VkInstance()->FreeMem(pNewEntry);
+            }
+        }
+        else
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+
+        if (result != Pal::Result::Success)
+        {
+            m_entries.Erase(hash);
+        }
+    }
+
+    const RenderPassExecuteInfo* pSharedInfo = nullptr;
+
+    if (result == Pal::Result::Success)
+    {
+        if ((*ppEntry)->pExecuteInfo != pExecuteInfo)
+        {
+            // Lost the race against another thread building the same render pass
+            m_pDevice->VkInstance()->FreeMem(pExecuteInfo);
+        }
+
+        (*ppEntry)->refCount++;
+
+        pSharedInfo = (*ppEntry)->pExecuteInfo;
+    }
+    else
+    {
+        m_pDevice->VkInstance()->FreeMem(pExecuteInfo);
+    }
+
+    return pSharedInfo;
+}
+
+// =====================================================================================================================
+// Releases a reference to a shared execute info.  The execute info is freed once the last render pass using it is
+// destroyed.
+void RenderPassExecuteCache::Release(
+    const RenderPassExecuteInfo* pExecuteInfo)
+{
+    Util::MutexAuto lock(&m_mutex);
+
+    Entry** ppEntry = m_refs.FindKey(pExecuteInfo);
+
+    VK_ASSERT(ppEntry != nullptr);
+
+    if (ppEntry != nullptr)
+    {
+        Entry* pEntry = *ppEntry;
+
+        VK_ASSERT(pEntry->refCount > 0);
+
+        pEntry->refCount--;
+
+        if (pEntry->refCount == 0)
+        {
+            m_refs.Erase(pExecuteInfo);
+            m_entries.Erase(pEntry->hash);
+
+            m_pDevice->VkInstance()->FreeMem(pEntry->pExecuteInfo);
+            m_pDevice->VkInstance()->FreeMem(pEntry);
+        }
+    }
+}
+
+} // namespace vk
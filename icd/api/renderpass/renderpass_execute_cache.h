@@ -0,0 +1,99 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+#ifndef __RENDERPASS_RENDERPASS_EXECUTE_CACHE_H__
+#define __RENDERPASS_RENDERPASS_EXECUTE_CACHE_H__
+#pragma once
+
+#include "include/khronos/vulkan.h"
+#include "include/vk_alloccb.h"
+
+#include "renderpass/renderpass_types.h"
+
+#include "palHashMap.h"
+#include "palMd5.h"
+#include "palMutex.h"
+
+namespace vk
+{
+
+class Device;
+
+// =====================================================================================================================
+// Device-level cache of built render pass execute infos.  Render passes whose create infos are structurally identical
+// (same attachments, subpasses and dependencies) share one immutable, reference counted RenderPassExecuteInfo instead
+// of running the RenderPassBuilder again.
+//
+// Execute infos handed to this cache must be allocated through the instance allocation callbacks since they may
+// outlive the render pass that created them.
+class RenderPassExecuteCache
+{
+public:
+    RenderPassExecuteCache(Device* pDevice);
+
+    VkResult Init();
+    void Destroy();
+
+    const RenderPassExecuteInfo* Find(const Util::Md5::Hash& hash);
+
+    const RenderPassExecuteInfo* Insert(const Util::Md5::Hash& hash, RenderPassExecuteInfo* pExecuteInfo);
+
+    void Release(const RenderPassExecuteInfo* pExecuteInfo);
+
+    // Number of lookups done by render pass creation
+    VK_INLINE uint32_t GetLookupCount() const
+        { return m_lookupCount; }
+
+    // Number of lookups which found an existing execute info
+    VK_INLINE uint32_t GetHitCount() const
+        { return m_hitCount; }
+
+private:
+    static const uint32_t NumEntryBuckets = 64;
+
+    struct Entry
+    {
+        Util::Md5::Hash        hash;          // Structural hash of the render pass create info (copy of the key)
+        RenderPassExecuteInfo* pExecuteInfo;  // Shared execute info
+        uint32_t               refCount;      // Reference count of render passes holding on to this execute info
+    };
+
+    Device* const                                  m_pDevice;
+    Util::Mutex                                    m_mutex;
+
+    Util::HashMap<Util::Md5::Hash,
+                  Entry*,
+                  PalAllocator>                    m_entries;  // Maps structural hashes to entries
+    Util::HashMap<const RenderPassExecuteInfo*,
+                  Entry*,
+                  PalAllocator>                    m_refs;     // Maps shared execute infos back to their entries
+
+    volatile uint32_t                              m_lookupCount;
+    volatile uint32_t                              m_hitCount;
+};
+
+} // namespace vk
+
+#endif /* __RENDERPASS_RENDERPASS_EXECUTE_CACHE_H__ */
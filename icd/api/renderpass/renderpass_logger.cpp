@@ -106,7 +106,8 @@ RenderPassLogger::RenderPassLogger(
     const Device*        pDevice)
     :
     m_pArena(pArena),
-    m_settings(pDevice->GetRuntimeSettings())
+    m_settings(pDevice->GetRuntimeSettings()),
+    m_pExecuteCache(pDevice->GetRenderPassExecuteCache())
 {
     m_logging = true;
 }
@@ -927,6 +928,15 @@ void RenderPassLogger::LogStatistics()
     Log("== Statistics:\n\n");
 
     Log("Temporary memory allocated during building: %llu bytes\n", (uint64_t)m_pArena->GetTotalAllocated());
+
+    if (m_settings.renderPassExecuteCacheEnable)
+    {
+        const uint32_t lookups = m_pExecuteCache->GetLookupCount();
+        const uint32_t hits    = m_pExecuteCache->GetHitCount();
+
+        Log("Execute info cache hits: %u of %u lookups (%.1f%%)\n",
+            hits, lookups, (lookups > 0) ? (100.0 * hits / lookups) : 0.0);
+    }
 }
 
 // =====================================================================================================================
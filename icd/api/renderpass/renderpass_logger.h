@@ -48,6 +48,7 @@ namespace vk
 {
 
 class RenderPassBuilder;
+class RenderPassExecuteCache;
 
 // =====================================================================================================================
 // This class dumps render passes in .asciidoc format as they are created.
@@ -93,6 +94,7 @@ private:
 
     utils::TempMemArena*           m_pArena;
     const RuntimeSettings&         m_settings;
+    const RenderPassExecuteCache*  m_pExecuteCache;
     const VkRenderPassCreateInfo*  m_pApiInfo;
     const RenderPassCreateInfo*    m_pInfo;
     const RenderPassExecuteInfo*   m_pExecute;
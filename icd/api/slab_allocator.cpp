@@ -0,0 +1,416 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ **********************************************************************************************************************
+ * @file  slab_allocator.cpp
+ * @brief Implementation of the size-class slab allocator used for Vulkan API objects.
+ **********************************************************************************************************************
+ */
+
+#include "include/slab_allocator.h"
+#include "include/vk_conv.h"
+
+#include "palDbgPrint.h"
+#include "palSysUtil.h"
+
+namespace vk
+{
+
+const uint32_t SlabAllocator::SizeClassBlockSize[SlabAllocator::SizeClassCount] =
+{
+    64, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+// =====================================================================================================================
+SlabAllocator::SlabAllocator(
+    const VkAllocationCallbacks* pFallbackCallbacks)
+    :
+    m_pFallbackCallbacks(pFallbackCallbacks),
+    m_pArena(nullptr),
+    m_arenaSize(0),
+    m_arenaUsed(0),
+    m_pChunkSizeClass(nullptr),
+    m_fallbackAllocCount(0)
+{
+    m_callbacks.pUserData             = this;
+    m_callbacks.pfnAllocation         = AllocFunc;
+    m_callbacks.pfnReallocation       = ReallocFunc;
+    m_callbacks.pfnFree               = FreeFunc;
+    m_callbacks.pfnInternalAllocation = pFallbackCallbacks->pfnInternalAllocation;
+    m_callbacks.pfnInternalFree       = pFallbackCallbacks->pfnInternalFree;
+
+    for (uint32_t i = 0; i < SizeClassCount; ++i)
+    {
+        SizeClass* pClass = &m_sizeClasses[i];
+
+        pClass->pFreeList      = nullptr;
+        pClass->pCarve         = nullptr;
+        pClass->pCarveEnd      = nullptr;
+        pClass->chunkCount     = 0;
+        pClass->carvedBlocks   = 0;
+        pClass->usedBlocks     = 0;
+        pClass->peakUsedBlocks = 0;
+    }
+}
+
+// =====================================================================================================================
+// Reserves the arena.  The arena is only touched as chunks are handed to size classes, so most of it is never backed by
+// physical memory unless it is needed.
+VkResult SlabAllocator::Init(
+    size_t arenaSize)
+{
+    VK_ASSERT(m_pArena == nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    m_arenaSize = Util::Pow2Align(arenaSize, ChunkSize);
+
+    const size_t chunkCount = m_arenaSize / ChunkSize;
+
+    if (chunkCount > 0)
+    {
+        m_pArena = static_cast<uint8_t*>(m_pFallbackCallbacks->pfnAllocation(
+            m_pFallbackCallbacks->pUserData,
+            m_arenaSize,
+            ChunkSize,
+            VK_SYSTEM_ALLOCATION_SCOPE_DEVICE));
+
+        m_pChunkSizeClass = static_cast<uint8_t*>(m_pFallbackCallbacks->pfnAllocation(
+            m_pFallbackCallbacks->pUserData,
+            chunkCount,
+            VK_DEFAULT_MEM_ALIGN,
+            VK_SYSTEM_ALLOCATION_SCOPE_DEVICE));
+    }
+
+    if ((m_pArena != nullptr) && (m_pChunkSizeClass != nullptr))
+    {
+        Pal::Result palResult = m_arenaLock.Init();
+
+        for (uint32_t i = 0; (i < SizeClassCount) && (palResult == Pal::Result::Success); ++i)
+        {
+            palResult = m_sizeClasses[i].lock.Init();
+        }
+
+        result = PalToVkResult(palResult);
+    }
+    else
+    {
+        result = VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        Destroy();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases the arena.  Any block still allocated from it becomes invalid.
+void SlabAllocator::Destroy()
+{
+    if (m_pArena != nullptr)
+    {
+        m_pFallbackCallbacks->pfnFree(m_pFallbackCallbacks->pUserData, m_pArena);
+    }
+
+    if (m_pChunkSizeClass != nullptr)
+    {
+        m_pFallbackCallbacks->pfnFree(m_pFallbackCallbacks->pUserData, m_pChunkSizeClass);
+    }
+
+    m_pArena          = nullptr;
+    m_pChunkSizeClass = nullptr;
+    m_arenaSize       = 0;
+    m_arenaUsed       = 0;
+}
+
+// =====================================================================================================================
+// Hands the next unused chunk of the arena to the given size class.  Returns nullptr if the arena is exhausted.
+uint8_t* SlabAllocator::AllocChunk(
+    uint32_t sizeClass)
+{
+    Util::MutexAuto lock(&m_arenaLock);
+
+    uint8_t* pChunk = nullptr;
+
+    if ((m_arenaUsed + ChunkSize) <= m_arenaSize)
+    {
+        pChunk = m_pArena + m_arenaUsed;
+
+        m_pChunkSizeClass[m_arenaUsed / ChunkSize] = static_cast<uint8_t>(sizeClass);
+        m_arenaUsed += ChunkSize;
+    }
+
+    return pChunk;
+}
+
+// =====================================================================================================================
+void* SlabAllocator::Alloc(
+    size_t                  size,
+    size_t                  alignment,
+    VkSystemAllocationScope allocationScope)
+{
+    void* pMem = nullptr;
+
+    uint32_t sizeClass = SizeClassCount;
+
+    if (alignment <= MaxAlignment)
+    {
+        for (uint32_t i = 0; i < SizeClassCount; ++i)
+        {
+            if (size <= SizeClassBlockSize[i])
+            {
+                sizeClass = i;
+                break;
+            }
+        }
+    }
+
+    if (sizeClass < SizeClassCount)
+    {
+        SizeClass*     pClass    = &m_sizeClasses[sizeClass];
+        const uint32_t blockSize = SizeClassBlockSize[sizeClass];
+
+        Util::MutexAuto lock(&pClass->lock);
+
+        if (pClass->pFreeList != nullptr)
+        {
+            pMem              = pClass->pFreeList;
+            pClass->pFreeList = *static_cast<void**>(pMem);
+        }
+        else
+        {
+            if (pClass->pCarve == pClass->pCarveEnd)
+            {
+                uint8_t* pChunk = AllocChunk(sizeClass);
+
+                if (pChunk != nullptr)
+                {
+                    pClass->pCarve    = pChunk;
+                    pClass->pCarveEnd = pChunk + ((ChunkSize / blockSize) * blockSize);
+                    pClass->chunkCount++;
+                }
+            }
+
+            if (pClass->pCarve != pClass->pCarveEnd)
+            {
+                pMem            = pClass->pCarve;
+                pClass->pCarve += blockSize;
+                pClass->carvedBlocks++;
+            }
+        }
+
+        if (pMem != nullptr)
+        {
+            pClass->usedBlocks++;
+            pClass->peakUsedBlocks = Util::Max(pClass->peakUsedBlocks, pClass->usedBlocks);
+        }
+    }
+
+    if (pMem == nullptr)
+    {
+        Util::AtomicIncrement(&m_fallbackAllocCount);
+
+        pMem = m_pFallbackCallbacks->pfnAllocation(m_pFallbackCallbacks->pUserData, size, alignment, allocationScope);
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+void SlabAllocator::Free(
+    void* pMem)
+{
+    if (IsSlabMemory(pMem))
+    {
+        const size_t   chunk     = static_cast<size_t>(static_cast<uint8_t*>(pMem) - m_pArena) / ChunkSize;
+        const uint32_t sizeClass = m_pChunkSizeClass[chunk];
+        SizeClass*     pClass    = &m_sizeClasses[sizeClass];
+
+        Util::MutexAuto lock(&pClass->lock);
+
+        VK_ASSERT(pClass->usedBlocks > 0);
+
+        *static_cast<void**>(pMem) = pClass->pFreeList;
+        pClass->pFreeList          = pMem;
+        pClass->usedBlocks--;
+    }
+    else if (pMem != nullptr)
+    {
+        m_pFallbackCallbacks->pfnFree(m_pFallbackCallbacks->pUserData, pMem);
+    }
+}
+
+// =====================================================================================================================
+void* SlabAllocator::Realloc(
+    void*                   pOriginal,
+    size_t                  size,
+    size_t                  alignment,
+    VkSystemAllocationScope allocationScope)
+{
+    void* pMem = nullptr;
+
+    if (pOriginal == nullptr)
+    {
+        pMem = Alloc(size, alignment, allocationScope);
+    }
+    else if (size == 0)
+    {
+        Free(pOriginal);
+    }
+    else if (IsSlabMemory(pOriginal))
+    {
+        const size_t   chunk     = static_cast<size_t>(static_cast<uint8_t*>(pOriginal) - m_pArena) / ChunkSize;
+        const uint32_t blockSize = SizeClassBlockSize[m_pChunkSizeClass[chunk]];
+
+        if ((size <= blockSize) && Util::IsPow2Aligned(reinterpret_cast<uint64_t>(pOriginal), alignment))
+        {
+            pMem = pOriginal;
+        }
+        else
+        {
+            pMem = Alloc(size, alignment, allocationScope);
+
+            if (pMem != nullptr)
+            {
+                memcpy(pMem, pOriginal, Util::Min(size, static_cast<size_t>(blockSize)));
+
+                Free(pOriginal);
+            }
+        }
+    }
+    else
+    {
+        pMem = m_pFallbackCallbacks->pfnReallocation(
+            m_pFallbackCallbacks->pUserData, pOriginal, size, alignment, allocationScope);
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+void* VKAPI_PTR SlabAllocator::AllocFunc(
+    void*                   pUserData,
+    size_t                  size,
+    size_t                  alignment,
+    VkSystemAllocationScope allocationScope)
+{
+    return static_cast<SlabAllocator*>(pUserData)->Alloc(size, alignment, allocationScope);
+}
+
+// =====================================================================================================================
+void* VKAPI_PTR SlabAllocator::ReallocFunc(
+    void*                   pUserData,
+    void*                   pOriginal,
+    size_t                  size,
+    size_t                  alignment,
+    VkSystemAllocationScope allocationScope)
+{
+    return static_cast<SlabAllocator*>(pUserData)->Realloc(pOriginal, size, alignment, allocationScope);
+}
+
+// =====================================================================================================================
+void VKAPI_PTR SlabAllocator::FreeFunc(
+    void* pUserData,
+    void* pMem)
+{
+    static_cast<SlabAllocator*>(pUserData)->Free(pMem);
+}
+
+// =====================================================================================================================
+// Takes a snapshot of the per-class occupancy of the allocator.
+void SlabAllocator::GetStats(
+    SlabAllocatorStats* pStats)
+{
+    static_assert(SizeClassCount <= VK_ARRAY_SIZE(pStats->sizeClasses), "Too many size classes");
+
+    memset(pStats, 0, sizeof(*pStats));
+
+    {
+        Util::MutexAuto lock(&m_arenaLock);
+
+        pStats->arenaSize = m_arenaSize;
+        pStats->arenaUsed = m_arenaUsed;
+    }
+
+    pStats->fallbackAllocCount = m_fallbackAllocCount;
+    pStats->sizeClassCount     = SizeClassCount;
+
+    for (uint32_t i = 0; i < SizeClassCount; ++i)
+    {
+        SizeClass*          pClass = &m_sizeClasses[i];
+        SlabSizeClassStats* pOut   = &pStats->sizeClasses[i];
+
+        Util::MutexAuto lock(&pClass->lock);
+
+        pOut->blockSize      = SizeClassBlockSize[i];
+        pOut->chunkCount     = pClass->chunkCount;
+        pOut->carvedBlocks   = pClass->carvedBlocks;
+        pOut->usedBlocks     = pClass->usedBlocks;
+        pOut->peakUsedBlocks = pClass->peakUsedBlocks;
+    }
+}
+
+// =====================================================================================================================
+// Prints the occupancy of every size class that owns any chunk.  Occupancy is the fraction of the class' chunk memory
+// holding live blocks; fragmentation is the fraction of the blocks handed out at least once that now sit on the free
+// list.
+void SlabAllocator::LogStats()
+{
+    SlabAllocatorStats stats;
+
+    GetStats(&stats);
+
+    Util::DbgPrintf(Util::DbgPrintCatInfoMsg, Util::DbgPrintStyleDefault,
+                    "API object slab allocator: %zu of %zu KB of arena used, %u fallback allocations",
+                    stats.arenaUsed / 1024,
+                    stats.arenaSize / 1024,
+                    stats.fallbackAllocCount);
+
+    for (uint32_t i = 0; i < stats.sizeClassCount; ++i)
+    {
+        const SlabSizeClassStats& sizeClass = stats.sizeClasses[i];
+
+        if (sizeClass.chunkCount > 0)
+        {
+            const uint64_t chunkBytes = static_cast<uint64_t>(sizeClass.chunkCount) * ChunkSize;
+            const uint64_t usedBytes  = static_cast<uint64_t>(sizeClass.usedBlocks) * sizeClass.blockSize;
+            const uint32_t freeBlocks = sizeClass.carvedBlocks - sizeClass.usedBlocks;
+
+            Util::DbgPrintf(Util::DbgPrintCatInfoMsg, Util::DbgPrintStyleDefault,
+                            "  %4u bytes: %3u chunks, %6u used (peak %6u), occupancy %3u%%, fragmentation %3u%%",
+                            sizeClass.blockSize,
+                            sizeClass.chunkCount,
+                            sizeClass.usedBlocks,
+                            sizeClass.peakUsedBlocks,
+                            static_cast<uint32_t>((usedBytes * 100) / chunkBytes),
+                            (sizeClass.carvedBlocks > 0) ? ((freeBlocks * 100) / sizeClass.carvedBlocks) : 0);
+        }
+    }
+}
+
+} // namespace vk
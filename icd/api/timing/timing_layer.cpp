@@ -0,0 +1,1453 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  timing_layer.cpp
+ * @brief Implementation of the API timing layer.  This layer is an internal driver layer (not true loader-aware layer)
+ *        that wraps a set of entry points to record how much CPU time each call spends inside the driver.
+ ***********************************************************************************************************************
+ */
+
+#include "include/vk_cmdbuffer.h"
+#include "include/vk_device.h"
+#include "include/vk_queue.h"
+#include "timing/timing_layer.h"
+#include "timing/timing_mgr.h"
+
+#include "palSysUtil.h"
+
+namespace vk
+{
+
+// =====================================================================================================================
+// Returns the API timing manager of the device owning the given handle.
+VK_INLINE ApiTimingMgr* GetApiTimingMgr(
+    VkCommandBuffer commandBuffer)
+{
+    return ApiCmdBuffer::ObjectFromHandle(commandBuffer)->VkDevice()->GetApiTimingMgr();
+}
+
+// =====================================================================================================================
+VK_INLINE ApiTimingMgr* GetApiTimingMgr(
+    VkQueue queue)
+{
+    return ApiQueue::ObjectFromHandle(queue)->VkDevice()->GetApiTimingMgr();
+}
+
+// =====================================================================================================================
+VK_INLINE ApiTimingMgr* GetApiTimingMgr(
+    VkDevice device)
+{
+    return ApiDevice::ObjectFromHandle(device)->GetApiTimingMgr();
+}
+
+namespace entry
+{
+
+namespace timing
+{
+
+// Looks up the timing manager from the dispatchable handle and samples the start time of the call
+#define TIMING_SETUP(handle) \
+    ApiTimingMgr* pTimingMgr = GetApiTimingMgr(handle); \
+    const int64_t startTime  = Util::GetPerfCpuTime();
+
+// Helper function to call the next layer's function by name
+#define TIMING_CALL_NEXT_LAYER(entry_name) \
+    pTimingMgr->GetNextLayer()->entry_name
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer(
+    VkCommandBuffer                             commandBuffer,
+    const VkCommandBufferBeginInfo*             pBeginInfo)
+{
+    TIMING_SETUP(commandBuffer);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkBeginCommandBuffer)(commandBuffer, pBeginInfo);
+
+    pTimingMgr->RecordCall(ApiTimingVkBeginCommandBuffer, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer(
+    VkCommandBuffer                             commandBuffer)
+{
+    TIMING_SETUP(commandBuffer);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkEndCommandBuffer)(commandBuffer);
+
+    pTimingMgr->RecordCall(ApiTimingVkEndCommandBuffer, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkCommandBufferResetFlags                   flags)
+{
+    TIMING_SETUP(commandBuffer);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkResetCommandBuffer)(commandBuffer, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkResetCommandBuffer, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBindPipeline(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipeline                                  pipeline)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBindPipeline)(commandBuffer, pipelineBindPoint, pipeline);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBindPipeline, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBindDescriptorSets(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    firstSet,
+    uint32_t                                    descriptorSetCount,
+    const VkDescriptorSet*                      pDescriptorSets,
+    uint32_t                                    dynamicOffsetCount,
+    const uint32_t*                             pDynamicOffsets)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBindDescriptorSets)(commandBuffer, pipelineBindPoint, layout, firstSet,
+        descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBindDescriptorSets, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBindIndexBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkIndexType                                 indexType)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBindIndexBuffer)(commandBuffer, buffer, offset, indexType);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBindIndexBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBindVertexBuffers(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    const VkBuffer*                             pBuffers,
+    const VkDeviceSize*                         pOffsets)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBindVertexBuffers)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBindVertexBuffers, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDraw(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    vertexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstVertex,
+    uint32_t                                    firstInstance)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDraw)(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDraw, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexed(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    indexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstIndex,
+    int32_t                                     vertexOffset,
+    uint32_t                                    firstInstance)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDrawIndexed)(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
+        firstInstance);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDrawIndexed, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDrawIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDrawIndirect, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDrawIndexedIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDrawIndexedIndirect, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDispatch)(commandBuffer, groupCountX, groupCountY, groupCountZ);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDispatch, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDispatchIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdDispatchIndirect)(commandBuffer, buffer, offset);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdDispatchIndirect, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    srcBuffer,
+    VkBuffer                                    dstBuffer,
+    uint32_t                                    regionCount,
+    const VkBufferCopy*                         pRegions)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdCopyBuffer)(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdCopyBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageCopy*                          pRegions)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdCopyImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+        regionCount, pRegions);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdCopyImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBlitImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageBlit*                          pRegions,
+    VkFilter                                    filter)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBlitImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+        regionCount, pRegions, filter);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBlitImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    srcBuffer,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkBufferImageCopy*                    pRegions)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdCopyBufferToImage)(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount,
+        pRegions);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdCopyBufferToImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyImageToBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkBuffer                                    dstBuffer,
+    uint32_t                                    regionCount,
+    const VkBufferImageCopy*                    pRegions)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdCopyImageToBuffer)(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount,
+        pRegions);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdCopyImageToBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdUpdateBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                dataSize,
+    const void*                                 pData)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdUpdateBuffer)(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdUpdateBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdFillBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                size,
+    uint32_t                                    data)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdFillBuffer)(commandBuffer, dstBuffer, dstOffset, size, data);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdFillBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdClearColorImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     image,
+    VkImageLayout                               imageLayout,
+    const VkClearColorValue*                    pColor,
+    uint32_t                                    rangeCount,
+    const VkImageSubresourceRange*              pRanges)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdClearColorImage)(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdClearColorImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdClearDepthStencilImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     image,
+    VkImageLayout                               imageLayout,
+    const VkClearDepthStencilValue*             pDepthStencil,
+    uint32_t                                    rangeCount,
+    const VkImageSubresourceRange*              pRanges)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdClearDepthStencilImage)(commandBuffer, image, imageLayout, pDepthStencil, rangeCount,
+        pRanges);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdClearDepthStencilImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdClearAttachments(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    attachmentCount,
+    const VkClearAttachment*                    pAttachments,
+    uint32_t                                    rectCount,
+    const VkClearRect*                          pRects)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdClearAttachments)(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdClearAttachments, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdResolveImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageResolve*                       pRegions)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdResolveImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout,
+        regionCount, pRegions);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdResolveImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetEvent(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags                        stageMask)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetEvent)(commandBuffer, event, stageMask);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetEvent, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdResetEvent(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags                        stageMask)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdResetEvent)(commandBuffer, event, stageMask);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdResetEvent, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdWaitEvents(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    eventCount,
+    const VkEvent*                              pEvents,
+    VkPipelineStageFlags                        srcStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    uint32_t                                    memoryBarrierCount,
+    const VkMemoryBarrier*                      pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdWaitEvents)(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask,
+        memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+        pImageMemoryBarriers);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdWaitEvents, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlags                        srcStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    VkDependencyFlags                           dependencyFlags,
+    uint32_t                                    memoryBarrierCount,
+    const VkMemoryBarrier*                      pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdPipelineBarrier)(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+        memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+        pImageMemoryBarriers);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdPipelineBarrier, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBeginQuery(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query,
+    VkQueryControlFlags                         flags)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBeginQuery)(commandBuffer, queryPool, query, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBeginQuery, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdEndQuery(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdEndQuery)(commandBuffer, queryPool, query);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdEndQuery, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdResetQueryPool(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdResetQueryPool)(commandBuffer, queryPool, firstQuery, queryCount);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdResetQueryPool, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlagBits                     pipelineStage,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdWriteTimestamp)(commandBuffer, pipelineStage, queryPool, query);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdWriteTimestamp, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdCopyQueryPoolResults(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                stride,
+    VkQueryResultFlags                          flags)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdCopyQueryPoolResults)(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer,
+        dstOffset, stride, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdCopyQueryPoolResults, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdPushConstants(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineLayout                            layout,
+    VkShaderStageFlags                          stageFlags,
+    uint32_t                                    offset,
+    uint32_t                                    size,
+    const void*                                 pValues)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdPushConstants)(commandBuffer, layout, stageFlags, offset, size, pValues);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdPushConstants, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBeginRenderPass(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderPassBeginInfo*                pRenderPassBegin,
+    VkSubpassContents                           contents)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdBeginRenderPass)(commandBuffer, pRenderPassBegin, contents);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdBeginRenderPass, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdNextSubpass(
+    VkCommandBuffer                             commandBuffer,
+    VkSubpassContents                           contents)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdNextSubpass)(commandBuffer, contents);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdNextSubpass, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdEndRenderPass(
+    VkCommandBuffer                             commandBuffer)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdEndRenderPass)(commandBuffer);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdEndRenderPass, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdExecuteCommands(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    commandBufferCount,
+    const VkCommandBuffer*                      pCommandBuffers)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdExecuteCommands)(commandBuffer, commandBufferCount, pCommandBuffers);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdExecuteCommands, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetViewport(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    const VkViewport*                           pViewports)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetViewport)(commandBuffer, firstViewport, viewportCount, pViewports);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetViewport, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetScissor(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstScissor,
+    uint32_t                                    scissorCount,
+    const VkRect2D*                             pScissors)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetScissor)(commandBuffer, firstScissor, scissorCount, pScissors);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetScissor, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetLineWidth(
+    VkCommandBuffer                             commandBuffer,
+    float                                       lineWidth)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetLineWidth)(commandBuffer, lineWidth);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetLineWidth, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBias(
+    VkCommandBuffer                             commandBuffer,
+    float                                       depthBiasConstantFactor,
+    float                                       depthBiasClamp,
+    float                                       depthBiasSlopeFactor)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetDepthBias)(commandBuffer, depthBiasConstantFactor, depthBiasClamp,
+        depthBiasSlopeFactor);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetDepthBias, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetBlendConstants(
+    VkCommandBuffer                             commandBuffer,
+    const float                                 blendConstants[4])
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetBlendConstants)(commandBuffer, blendConstants);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetBlendConstants, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetDepthBounds(
+    VkCommandBuffer                             commandBuffer,
+    float                                       minDepthBounds,
+    float                                       maxDepthBounds)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetDepthBounds)(commandBuffer, minDepthBounds, maxDepthBounds);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetDepthBounds, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilCompareMask(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    compareMask)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetStencilCompareMask)(commandBuffer, faceMask, compareMask);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetStencilCompareMask, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilWriteMask(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    writeMask)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetStencilWriteMask)(commandBuffer, faceMask, writeMask);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetStencilWriteMask, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdSetStencilReference(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    reference)
+{
+    TIMING_SETUP(commandBuffer);
+
+    TIMING_CALL_NEXT_LAYER(vkCmdSetStencilReference)(commandBuffer, faceMask, reference);
+
+    pTimingMgr->RecordCall(ApiTimingVkCmdSetStencilReference, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit(
+    VkQueue                                     queue,
+    uint32_t                                    submitCount,
+    const VkSubmitInfo*                         pSubmits,
+    VkFence                                     fence)
+{
+    TIMING_SETUP(queue);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkQueueSubmit)(queue, submitCount, pSubmits, fence);
+
+    pTimingMgr->RecordCall(ApiTimingVkQueueSubmit, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkQueueWaitIdle(
+    VkQueue                                     queue)
+{
+    TIMING_SETUP(queue);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkQueueWaitIdle)(queue);
+
+    pTimingMgr->RecordCall(ApiTimingVkQueueWaitIdle, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(
+    VkQueue                                     queue,
+    const VkPresentInfoKHR*                     pPresentInfo)
+{
+    TIMING_SETUP(queue);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkQueuePresentKHR)(queue, pPresentInfo);
+
+    pTimingMgr->RecordCall(ApiTimingVkQueuePresentKHR, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkDeviceWaitIdle(
+    VkDevice                                    device)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkDeviceWaitIdle)(device);
+
+    pTimingMgr->RecordCall(ApiTimingVkDeviceWaitIdle, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    uint64_t                                    timeout,
+    VkSemaphore                                 semaphore,
+    VkFence                                     fence,
+    uint32_t*                                   pImageIndex)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkAcquireNextImageKHR)(device, swapchain, timeout, semaphore, fence,
+        pImageIndex);
+
+    pTimingMgr->RecordCall(ApiTimingVkAcquireNextImageKHR, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences(
+    VkDevice                                    device,
+    uint32_t                                    fenceCount,
+    const VkFence*                              pFences,
+    VkBool32                                    waitAll,
+    uint64_t                                    timeout)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkWaitForFences)(device, fenceCount, pFences, waitAll, timeout);
+
+    pTimingMgr->RecordCall(ApiTimingVkWaitForFences, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkResetFences(
+    VkDevice                                    device,
+    uint32_t                                    fenceCount,
+    const VkFence*                              pFences)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkResetFences)(device, fenceCount, pFences);
+
+    pTimingMgr->RecordCall(ApiTimingVkResetFences, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkGetFenceStatus(
+    VkDevice                                    device,
+    VkFence                                     fence)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkGetFenceStatus)(device, fence);
+
+    pTimingMgr->RecordCall(ApiTimingVkGetFenceStatus, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(
+    VkDevice                                    device,
+    const VkMemoryAllocateInfo*                 pAllocateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDeviceMemory*                             pMemory)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkAllocateMemory)(device, pAllocateInfo, pAllocator, pMemory);
+
+    pTimingMgr->RecordCall(ApiTimingVkAllocateMemory, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkFreeMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory,
+    const VkAllocationCallbacks*                pAllocator)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkFreeMemory)(device, memory, pAllocator);
+
+    pTimingMgr->RecordCall(ApiTimingVkFreeMemory, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkMapMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory,
+    VkDeviceSize                                offset,
+    VkDeviceSize                                size,
+    VkMemoryMapFlags                            flags,
+    void**                                      ppData)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkMapMemory)(device, memory, offset, size, flags, ppData);
+
+    pTimingMgr->RecordCall(ApiTimingVkMapMemory, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkUnmapMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkUnmapMemory)(device, memory);
+
+    pTimingMgr->RecordCall(ApiTimingVkUnmapMemory, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkFlushMappedMemoryRanges(
+    VkDevice                                    device,
+    uint32_t                                    memoryRangeCount,
+    const VkMappedMemoryRange*                  pMemoryRanges)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkFlushMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+
+    pTimingMgr->RecordCall(ApiTimingVkFlushMappedMemoryRanges, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkInvalidateMappedMemoryRanges(
+    VkDevice                                    device,
+    uint32_t                                    memoryRangeCount,
+    const VkMappedMemoryRange*                  pMemoryRanges)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkInvalidateMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+
+    pTimingMgr->RecordCall(ApiTimingVkInvalidateMappedMemoryRanges, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(
+    VkDevice                                    device,
+    const VkBufferCreateInfo*                   pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkBuffer*                                   pBuffer)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateBuffer)(device, pCreateInfo, pAllocator, pBuffer);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateBuffer, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(
+    VkDevice                                    device,
+    VkBuffer                                    buffer,
+    const VkAllocationCallbacks*                pAllocator)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkDestroyBuffer)(device, buffer, pAllocator);
+
+    pTimingMgr->RecordCall(ApiTimingVkDestroyBuffer, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(
+    VkDevice                                    device,
+    const VkImageCreateInfo*                    pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkImage*                                    pImage)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateImage)(device, pCreateInfo, pAllocator, pImage);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateImage, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkDestroyImage(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkAllocationCallbacks*                pAllocator)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkDestroyImage)(device, image, pAllocator);
+
+    pTimingMgr->RecordCall(ApiTimingVkDestroyImage, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(
+    VkDevice                                    device,
+    const VkImageViewCreateInfo*                pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkImageView*                                pView)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateImageView)(device, pCreateInfo, pAllocator, pView);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateImageView, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(
+    VkDevice                                    device,
+    VkImageView                                 imageView,
+    const VkAllocationCallbacks*                pAllocator)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkDestroyImageView)(device, imageView, pAllocator);
+
+    pTimingMgr->RecordCall(ApiTimingVkDestroyImageView, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler(
+    VkDevice                                    device,
+    const VkSamplerCreateInfo*                  pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSampler*                                  pSampler)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateSampler)(device, pCreateInfo, pAllocator, pSampler);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateSampler, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkGraphicsPipelineCreateInfo*         pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateGraphicsPipelines)(device, pipelineCache, createInfoCount,
+        pCreateInfos, pAllocator, pPipelines);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateGraphicsPipelines, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateComputePipelines(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkComputePipelineCreateInfo*          pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateComputePipelines)(device, pipelineCache, createInfoCount,
+        pCreateInfos, pAllocator, pPipelines);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateComputePipelines, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    const VkAllocationCallbacks*                pAllocator)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkDestroyPipeline)(device, pipeline, pAllocator);
+
+    pTimingMgr->RecordCall(ApiTimingVkDestroyPipeline, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorPool(
+    VkDevice                                    device,
+    const VkDescriptorPoolCreateInfo*           pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDescriptorPool*                           pDescriptorPool)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateDescriptorPool)(device, pCreateInfo, pAllocator, pDescriptorPool);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateDescriptorPool, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkResetDescriptorPool(
+    VkDevice                                    device,
+    VkDescriptorPool                            descriptorPool,
+    VkDescriptorPoolResetFlags                  flags)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkResetDescriptorPool)(device, descriptorPool, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkResetDescriptorPool, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets(
+    VkDevice                                    device,
+    const VkDescriptorSetAllocateInfo*          pAllocateInfo,
+    VkDescriptorSet*                            pDescriptorSets)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkAllocateDescriptorSets)(device, pAllocateInfo, pDescriptorSets);
+
+    pTimingMgr->RecordCall(ApiTimingVkAllocateDescriptorSets, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets(
+    VkDevice                                    device,
+    VkDescriptorPool                            descriptorPool,
+    uint32_t                                    descriptorSetCount,
+    const VkDescriptorSet*                      pDescriptorSets)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkFreeDescriptorSets)(device, descriptorPool, descriptorSetCount,
+        pDescriptorSets);
+
+    pTimingMgr->RecordCall(ApiTimingVkFreeDescriptorSets, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSets(
+    VkDevice                                    device,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites,
+    uint32_t                                    descriptorCopyCount,
+    const VkCopyDescriptorSet*                  pDescriptorCopies)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkUpdateDescriptorSets)(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+        pDescriptorCopies);
+
+    pTimingMgr->RecordCall(ApiTimingVkUpdateDescriptorSets, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool(
+    VkDevice                                    device,
+    const VkCommandPoolCreateInfo*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCommandPool*                              pCommandPool)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateCommandPool)(device, pCreateInfo, pAllocator, pCommandPool);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateCommandPool, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    VkCommandPoolResetFlags                     flags)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkResetCommandPool)(device, commandPool, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkResetCommandPool, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers(
+    VkDevice                                    device,
+    const VkCommandBufferAllocateInfo*          pAllocateInfo,
+    VkCommandBuffer*                            pCommandBuffers)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkAllocateCommandBuffers)(device, pAllocateInfo, pCommandBuffers);
+
+    pTimingMgr->RecordCall(ApiTimingVkAllocateCommandBuffers, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    uint32_t                                    commandBufferCount,
+    const VkCommandBuffer*                      pCommandBuffers)
+{
+    TIMING_SETUP(device);
+
+    TIMING_CALL_NEXT_LAYER(vkFreeCommandBuffers)(device, commandPool, commandBufferCount, pCommandBuffers);
+
+    pTimingMgr->RecordCall(ApiTimingVkFreeCommandBuffers, startTime);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool(
+    VkDevice                                    device,
+    const VkQueryPoolCreateInfo*                pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkQueryPool*                                pQueryPool)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateQueryPool)(device, pCreateInfo, pAllocator, pQueryPool);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateQueryPool, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkGetQueryPoolResults(
+    VkDevice                                    device,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    size_t                                      dataSize,
+    void*                                       pData,
+    VkDeviceSize                                stride,
+    VkQueryResultFlags                          flags)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkGetQueryPoolResults)(device, queryPool, firstQuery, queryCount, dataSize,
+        pData, stride, flags);
+
+    pTimingMgr->RecordCall(ApiTimingVkGetQueryPoolResults, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer(
+    VkDevice                                    device,
+    const VkFramebufferCreateInfo*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkFramebuffer*                              pFramebuffer)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateFramebuffer)(device, pCreateInfo, pAllocator, pFramebuffer);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateFramebuffer, startTime);
+
+    return result;
+}
+
+// =====================================================================================================================
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo*               pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass)
+{
+    TIMING_SETUP(device);
+
+    VkResult result = TIMING_CALL_NEXT_LAYER(vkCreateRenderPass)(device, pCreateInfo, pAllocator, pRenderPass);
+
+    pTimingMgr->RecordCall(ApiTimingVkCreateRenderPass, startTime);
+
+    return result;
+}
+
+#define TIMING_DISPATCH_ENTRY(entry_name) VK_DISPATCH_ENTRY(entry_name, vk::entry::timing::entry_name)
+
+// This is the API timing layer dispatch table.  It contains an entry for every Vulkan entry point that this layer
+// shadows.
+const DispatchTableEntry g_ApiTimingDispatchTable[] =
+{
+    TIMING_DISPATCH_ENTRY(vkBeginCommandBuffer),
+    TIMING_DISPATCH_ENTRY(vkEndCommandBuffer),
+    TIMING_DISPATCH_ENTRY(vkResetCommandBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdBindPipeline),
+    TIMING_DISPATCH_ENTRY(vkCmdBindDescriptorSets),
+    TIMING_DISPATCH_ENTRY(vkCmdBindIndexBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdBindVertexBuffers),
+    TIMING_DISPATCH_ENTRY(vkCmdDraw),
+    TIMING_DISPATCH_ENTRY(vkCmdDrawIndexed),
+    TIMING_DISPATCH_ENTRY(vkCmdDrawIndirect),
+    TIMING_DISPATCH_ENTRY(vkCmdDrawIndexedIndirect),
+    TIMING_DISPATCH_ENTRY(vkCmdDispatch),
+    TIMING_DISPATCH_ENTRY(vkCmdDispatchIndirect),
+    TIMING_DISPATCH_ENTRY(vkCmdCopyBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdCopyImage),
+    TIMING_DISPATCH_ENTRY(vkCmdBlitImage),
+    TIMING_DISPATCH_ENTRY(vkCmdCopyBufferToImage),
+    TIMING_DISPATCH_ENTRY(vkCmdCopyImageToBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdUpdateBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdFillBuffer),
+    TIMING_DISPATCH_ENTRY(vkCmdClearColorImage),
+    TIMING_DISPATCH_ENTRY(vkCmdClearDepthStencilImage),
+    TIMING_DISPATCH_ENTRY(vkCmdClearAttachments),
+    TIMING_DISPATCH_ENTRY(vkCmdResolveImage),
+    TIMING_DISPATCH_ENTRY(vkCmdSetEvent),
+    TIMING_DISPATCH_ENTRY(vkCmdResetEvent),
+    TIMING_DISPATCH_ENTRY(vkCmdWaitEvents),
+    TIMING_DISPATCH_ENTRY(vkCmdPipelineBarrier),
+    TIMING_DISPATCH_ENTRY(vkCmdBeginQuery),
+    TIMING_DISPATCH_ENTRY(vkCmdEndQuery),
+    TIMING_DISPATCH_ENTRY(vkCmdResetQueryPool),
+    TIMING_DISPATCH_ENTRY(vkCmdWriteTimestamp),
+    TIMING_DISPATCH_ENTRY(vkCmdCopyQueryPoolResults),
+    TIMING_DISPATCH_ENTRY(vkCmdPushConstants),
+    TIMING_DISPATCH_ENTRY(vkCmdBeginRenderPass),
+    TIMING_DISPATCH_ENTRY(vkCmdNextSubpass),
+    TIMING_DISPATCH_ENTRY(vkCmdEndRenderPass),
+    TIMING_DISPATCH_ENTRY(vkCmdExecuteCommands),
+    TIMING_DISPATCH_ENTRY(vkCmdSetViewport),
+    TIMING_DISPATCH_ENTRY(vkCmdSetScissor),
+    TIMING_DISPATCH_ENTRY(vkCmdSetLineWidth),
+    TIMING_DISPATCH_ENTRY(vkCmdSetDepthBias),
+    TIMING_DISPATCH_ENTRY(vkCmdSetBlendConstants),
+    TIMING_DISPATCH_ENTRY(vkCmdSetDepthBounds),
+    TIMING_DISPATCH_ENTRY(vkCmdSetStencilCompareMask),
+    TIMING_DISPATCH_ENTRY(vkCmdSetStencilWriteMask),
+    TIMING_DISPATCH_ENTRY(vkCmdSetStencilReference),
+    TIMING_DISPATCH_ENTRY(vkQueueSubmit),
+    TIMING_DISPATCH_ENTRY(vkQueueWaitIdle),
+    TIMING_DISPATCH_ENTRY(vkQueuePresentKHR),
+    TIMING_DISPATCH_ENTRY(vkDeviceWaitIdle),
+    TIMING_DISPATCH_ENTRY(vkAcquireNextImageKHR),
+    TIMING_DISPATCH_ENTRY(vkWaitForFences),
+    TIMING_DISPATCH_ENTRY(vkResetFences),
+    TIMING_DISPATCH_ENTRY(vkGetFenceStatus),
+    TIMING_DISPATCH_ENTRY(vkAllocateMemory),
+    TIMING_DISPATCH_ENTRY(vkFreeMemory),
+    TIMING_DISPATCH_ENTRY(vkMapMemory),
+    TIMING_DISPATCH_ENTRY(vkUnmapMemory),
+    TIMING_DISPATCH_ENTRY(vkFlushMappedMemoryRanges),
+    TIMING_DISPATCH_ENTRY(vkInvalidateMappedMemoryRanges),
+    TIMING_DISPATCH_ENTRY(vkCreateBuffer),
+    TIMING_DISPATCH_ENTRY(vkDestroyBuffer),
+    TIMING_DISPATCH_ENTRY(vkCreateImage),
+    TIMING_DISPATCH_ENTRY(vkDestroyImage),
+    TIMING_DISPATCH_ENTRY(vkCreateImageView),
+    TIMING_DISPATCH_ENTRY(vkDestroyImageView),
+    TIMING_DISPATCH_ENTRY(vkCreateSampler),
+    TIMING_DISPATCH_ENTRY(vkCreateGraphicsPipelines),
+    TIMING_DISPATCH_ENTRY(vkCreateComputePipelines),
+    TIMING_DISPATCH_ENTRY(vkDestroyPipeline),
+    TIMING_DISPATCH_ENTRY(vkCreateDescriptorPool),
+    TIMING_DISPATCH_ENTRY(vkResetDescriptorPool),
+    TIMING_DISPATCH_ENTRY(vkAllocateDescriptorSets),
+    TIMING_DISPATCH_ENTRY(vkFreeDescriptorSets),
+    TIMING_DISPATCH_ENTRY(vkUpdateDescriptorSets),
+    TIMING_DISPATCH_ENTRY(vkCreateCommandPool),
+    TIMING_DISPATCH_ENTRY(vkResetCommandPool),
+    TIMING_DISPATCH_ENTRY(vkAllocateCommandBuffers),
+    TIMING_DISPATCH_ENTRY(vkFreeCommandBuffers),
+    TIMING_DISPATCH_ENTRY(vkCreateQueryPool),
+    TIMING_DISPATCH_ENTRY(vkGetQueryPoolResults),
+    TIMING_DISPATCH_ENTRY(vkCreateFramebuffer),
+    TIMING_DISPATCH_ENTRY(vkCreateRenderPass),
+
+    VK_DISPATCH_TABLE_END()
+};
+
+} // namespace timing
+
+} // namespace entry
+
+} // namespace vk
@@ -0,0 +1,58 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  timing_layer.h
+ * @brief Contains shadowed entry points of the internal API timing layer, which measures the CPU time spent inside
+ *        the driver by each Vulkan entry point.
+ ***********************************************************************************************************************
+ */
+
+#ifndef __TIMING_TIMING_LAYER_H__
+#define __TIMING_TIMING_LAYER_H__
+
+#pragma once
+
+#include "include/khronos/vulkan.h"
+
+#include "include/vk_dispatch.h"
+
+namespace vk
+{
+
+namespace entry
+{
+
+namespace timing
+{
+// Dispatch table of entry points that are shadowed to measure their CPU time
+extern const DispatchTableEntry g_ApiTimingDispatchTable[];
+}
+
+}; // namespace entry
+
+}; // namespace vk
+
+#endif /* __TIMING_TIMING_LAYER_H__ */
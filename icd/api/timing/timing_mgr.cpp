@@ -0,0 +1,435 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  timing_mgr.cpp
+ * @brief Implementation of the API timing layer state management objects
+ ***********************************************************************************************************************
+ */
+
+#include "include/vk_device.h"
+#include "include/vk_instance.h"
+#include "timing/timing_mgr.h"
+#include "timing/timing_layer.h"
+
+#include "palFile.h"
+#include "palInlineFuncs.h"
+#include "palSysUtil.h"
+
+#include <climits>
+#include <string.h>
+
+namespace vk
+{
+
+// Names of the shadowed entry points, indexed by ApiTimingEntry
+static const char* ApiTimingEntryNames[ApiTimingEntryCount] =
+{
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandBuffer",
+    "vkCmdBindPipeline",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindVertexBuffers",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyImage",
+    "vkCmdBlitImage",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer",
+    "vkCmdFillBuffer",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdClearAttachments",
+    "vkCmdResolveImage",
+    "vkCmdSetEvent",
+    "vkCmdResetEvent",
+    "vkCmdWaitEvents",
+    "vkCmdPipelineBarrier",
+    "vkCmdBeginQuery",
+    "vkCmdEndQuery",
+    "vkCmdResetQueryPool",
+    "vkCmdWriteTimestamp",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdPushConstants",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdExecuteCommands",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdSetLineWidth",
+    "vkCmdSetDepthBias",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetStencilReference",
+    "vkQueueSubmit",
+    "vkQueueWaitIdle",
+    "vkQueuePresentKHR",
+    "vkDeviceWaitIdle",
+    "vkAcquireNextImageKHR",
+    "vkWaitForFences",
+    "vkResetFences",
+    "vkGetFenceStatus",
+    "vkAllocateMemory",
+    "vkFreeMemory",
+    "vkMapMemory",
+    "vkUnmapMemory",
+    "vkFlushMappedMemoryRanges",
+    "vkInvalidateMappedMemoryRanges",
+    "vkCreateBuffer",
+    "vkDestroyBuffer",
+    "vkCreateImage",
+    "vkDestroyImage",
+    "vkCreateImageView",
+    "vkDestroyImageView",
+    "vkCreateSampler",
+    "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines",
+    "vkDestroyPipeline",
+    "vkCreateDescriptorPool",
+    "vkResetDescriptorPool",
+    "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets",
+    "vkCreateCommandPool",
+    "vkResetCommandPool",
+    "vkAllocateCommandBuffers",
+    "vkFreeCommandBuffers",
+    "vkCreateQueryPool",
+    "vkGetQueryPoolResults",
+    "vkCreateFramebuffer",
+    "vkCreateRenderPass",
+};
+
+static volatile uint32_t g_nextApiTimingMgrId = 0; // Source of unique manager IDs
+
+// Non-zero for each per-thread block slot owned by a running thread
+static volatile uint32_t g_threadSlotUsed[ApiTimingMgr::MaxThreadCount] = {};
+
+// Per-thread block slot of the calling thread.  The slot is released when the thread exits, so that the blocks of all
+// managers at that index can be reused by a thread created later.
+struct ApiTimingThreadSlot
+{
+    ApiTimingThreadSlot() : index(UINT32_MAX) { }
+
+    ~ApiTimingThreadSlot()
+    {
+        if (index < ApiTimingMgr::MaxThreadCount)
+        {
+            // The barrier makes this thread's last updates visible to the next owner of the slot
+            Util::AtomicCompareAndSwap(&g_threadSlotUsed[index], 1, 0);
+        }
+    }
+
+    uint32_t index; // UINT32_MAX until the first call; MaxThreadCount if all slots were in use at that time
+};
+
+static thread_local ApiTimingThreadSlot t_threadSlot;
+
+// =====================================================================================================================
+ApiTimingMgr::ApiTimingMgr(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_perfFrequency(Util::Max(Util::GetPerfFrequency(), static_cast<int64_t>(1))),
+    m_id(Util::AtomicIncrement(&g_nextApiTimingMgrId) - 1),
+    m_dumpThreadExit(0)
+{
+    for (uint32_t i = 0; i < MaxThreadCount; ++i)
+    {
+        m_pThreadStats[i] = nullptr;
+    }
+
+    memset(&m_overflowStats, 0, sizeof(m_overflowStats));
+}
+
+// =====================================================================================================================
+// Stops the dump thread, writes the final statistics and frees the per-thread blocks.
+ApiTimingMgr::~ApiTimingMgr()
+{
+    if (m_dumpThread.IsCreated())
+    {
+        m_dumpThreadExit = 1;
+
+        m_dumpThreadEvent.Set();
+        m_dumpThread.Join();
+    }
+
+    Dump();
+
+    for (uint32_t i = 0; i < MaxThreadCount; ++i)
+    {
+        if (m_pThreadStats[i] != nullptr)
+        {
+            m_pDevice->VkInstance()->FreeMem(m_pThreadStats[i]);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Initializes the layer state and starts the thread dumping the statistics periodically.  Must be called after the
+// device's dispatch tables are set up.
+Pal::Result ApiTimingMgr::Init()
+{
+    const RuntimeSettings& settings = m_pDevice->GetRuntimeSettings();
+
+    GetNextDeviceLayerTable(m_pDevice->VkInstance(), m_pDevice, vk::entry::timing::g_ApiTimingDispatchTable,
+        &m_nextLayer);
+
+    Pal::Result result = m_overflowLock.Init();
+
+    if ((result == Pal::Result::Success) && (settings.apiTimingDumpIntervalMs > 0))
+    {
+        Util::EventCreateFlags eventFlags = {};
+
+        eventFlags.manualReset = true;
+
+        result = m_dumpThreadEvent.Init(eventFlags);
+
+        if (result == Pal::Result::Success)
+        {
+            result = m_dumpThread.Begin(DumpThreadFunc, this);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Entry point of the dump thread: writes the statistics once per dump interval until the manager is destroyed.
+void ApiTimingMgr::DumpThreadFunc(
+    void* pParameter)
+{
+    ApiTimingMgr* pMgr = static_cast<ApiTimingMgr*>(pParameter);
+
+    const float intervalSec = static_cast<float>(pMgr->m_pDevice->GetRuntimeSettings().apiTimingDumpIntervalMs) /
+                              1000.0f;
+
+    while (pMgr->m_dumpThreadExit == 0)
+    {
+        // The wait only ends before the interval elapses when the thread has to exit
+        pMgr->m_dumpThreadEvent.Wait(intervalSec);
+
+        if (pMgr->m_dumpThreadExit == 0)
+        {
+            pMgr->Dump();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns the calling thread's private block of counters, allocating it on the thread's first call.  Returns nullptr
+// if the thread must use the shared overflow block instead.
+ApiTimingMgr::ThreadStats* ApiTimingMgr::GetThreadStats()
+{
+    if (t_threadSlot.index == UINT32_MAX)
+    {
+        t_threadSlot.index = MaxThreadCount;
+
+        for (uint32_t i = 0; i < MaxThreadCount; ++i)
+        {
+            if ((g_threadSlotUsed[i] == 0) && (Util::AtomicCompareAndSwap(&g_threadSlotUsed[i], 0, 1) == 0))
+            {
+                t_threadSlot.index = i;
+
+                break;
+            }
+        }
+    }
+
+    const uint32_t slot   = t_threadSlot.index;
+    ThreadStats*   pStats = nullptr;
+
+    if (slot < MaxThreadCount)
+    {
+        pStats = m_pThreadStats[slot];
+
+        if (pStats == nullptr)
+        {
+            // Only the owner of the slot ever writes it, but Dump() may read it concurrently so the cleared block is
+            // published with a full barrier.
+            pStats = static_cast<ThreadStats*>(m_pDevice->VkInstance()->AllocMem(
+                sizeof(ThreadStats), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE));
+
+            if (pStats != nullptr)
+            {
+                memset(pStats, 0, sizeof(ThreadStats));
+
+                Util::AtomicExchangePointer(reinterpret_cast<void* volatile*>(&m_pThreadStats[slot]), pStats);
+            }
+        }
+    }
+
+    return pStats;
+}
+
+// =====================================================================================================================
+// Records one call of the given entry point that started at the given CPU time.
+void ApiTimingMgr::RecordCall(
+    ApiTimingEntry entry,
+    int64_t        startTime)
+{
+    const int64_t  now    = Util::GetPerfCpuTime();
+    const uint64_t ticks  = static_cast<uint64_t>(Util::Max(now - startTime, static_cast<int64_t>(1)));
+    const uint32_t bucket = Util::Log2(static_cast<uint32_t>(Util::Min(ticks, static_cast<uint64_t>(UINT_MAX))));
+
+    ThreadStats* pStats = GetThreadStats();
+
+    if (pStats != nullptr)
+    {
+        EntryStats* pEntry = &pStats->entries[entry];
+
+        pEntry->callCount++;
+        pEntry->totalTicks += ticks;
+        pEntry->histogram[bucket]++;
+
+        if (ticks > pEntry->maxTicks)
+        {
+            pEntry->maxTicks = ticks;
+        }
+    }
+    else
+    {
+        Util::MutexAuto lock(&m_overflowLock);
+
+        EntryStats* pEntry = &m_overflowStats.entries[entry];
+
+        pEntry->callCount++;
+        pEntry->totalTicks += ticks;
+        pEntry->histogram[bucket]++;
+
+        if (ticks > pEntry->maxTicks)
+        {
+            pEntry->maxTicks = ticks;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes the statistics accumulated so far by all threads to the log file, replacing its previous contents.  Counters
+// of other threads are read without synchronization, so a dump taken while they record may be off by a few calls.
+void ApiTimingMgr::Dump()
+{
+    const RuntimeSettings& settings = m_pDevice->GetRuntimeSettings();
+
+    char  executableNameBuffer[PATH_MAX];
+    char* pExecutableName = nullptr;
+
+    if (Util::GetExecutableName(&executableNameBuffer[0], &pExecutableName, sizeof(executableNameBuffer)) !=
+        Pal::Result::Success)
+    {
+        pExecutableName = nullptr;
+    }
+
+    char fileName[512];
+
+    Util::Snprintf(fileName, sizeof(fileName), "%s/ApiTiming_%s_%u.txt",
+        settings.apiTimingLogDir,
+        (pExecutableName != nullptr) ? pExecutableName : "unknown",
+        m_id);
+
+    Util::File file;
+
+    if (file.Open(fileName, Util::FileAccessWrite) == Pal::Result::Success)
+    {
+        const double ticksPerUs = static_cast<double>(m_perfFrequency) / 1000000.0;
+
+        file.Printf("# Entry point, calls, total (us), average (us), max (us), calls per duration bucket\n");
+        file.Printf("# Bucket N counts calls that took less than 2^(N+1) ticks; one tick is %.3f us\n",
+            1.0 / ticksPerUs);
+
+        for (uint32_t entry = 0; entry < ApiTimingEntryCount; ++entry)
+        {
+            EntryStats total = {};
+
+            for (uint32_t thread = 0; thread <= MaxThreadCount; ++thread)
+            {
+                const ThreadStats* pStats = (thread < MaxThreadCount) ? m_pThreadStats[thread] : &m_overflowStats;
+
+                if (pStats != nullptr)
+                {
+                    const EntryStats& stats = pStats->entries[entry];
+
+                    total.callCount  += stats.callCount;
+                    total.totalTicks += stats.totalTicks;
+                    total.maxTicks    = Util::Max(total.maxTicks, stats.maxTicks);
+
+                    for (uint32_t bucket = 0; bucket < HistogramBucketCount; ++bucket)
+                    {
+                        total.histogram[bucket] += stats.histogram[bucket];
+                    }
+                }
+            }
+
+            if (total.callCount > 0)
+            {
+                file.Printf("%s, %llu, %.1f, %.3f, %.1f,",
+                    ApiTimingEntryNames[entry],
+                    total.callCount,
+                    total.totalTicks / ticksPerUs,
+                    (total.totalTicks / ticksPerUs) / total.callCount,
+                    total.maxTicks / ticksPerUs);
+
+                for (uint32_t bucket = 0; bucket < HistogramBucketCount; ++bucket)
+                {
+                    if (total.histogram[bucket] > 0)
+                    {
+                        file.Printf(" [%u]=%llu", bucket, total.histogram[bucket]);
+                    }
+                }
+
+                file.Printf("\n");
+            }
+        }
+
+        file.Printf("# Device counter, value\n");
+        file.Printf("Deferred vkCmdPipelineBarrier calls, %llu\n", m_pDevice->GetMergedBarrierApiCount());
+        file.Printf("Merged PAL barriers, %llu\n", m_pDevice->GetMergedBarrierPalCount());
+        file.Printf("Event recycle barriers, %u\n", m_pDevice->GetEventRecycleBarrierCount());
+        file.Printf("Event recycle barriers avoided, %u\n", m_pDevice->GetEventRecycleBarrierAvoidedCount());
+
+        const PhysicalDevice* pPhysicalDevice = m_pDevice->VkPhysicalDevice(DefaultDeviceIndex);
+
+        for (uint32_t heap = 0; heap < Pal::GpuHeapCount; ++heap)
+        {
+            file.Printf("Peak memory usage of PAL heap %u (MB), %llu\n", heap,
+                pPhysicalDevice->GetMemoryUsagePeak(static_cast<Pal::GpuHeap>(heap)) / (1024 * 1024));
+        }
+
+        file.Close();
+    }
+}
+
+}; // namespace vk
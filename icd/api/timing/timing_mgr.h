@@ -0,0 +1,205 @@
+/*
+ *******************************************************************************
+ *
+ * Copyright (c) 2014-2017 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/**
+ ***********************************************************************************************************************
+ * @file  timing_mgr.h
+ * @brief Contains the API timing manager which accumulates per-entry-point CPU call counts and latency histograms
+ *        for the internal API timing layer and periodically dumps them, along with device-level driver counters, to a
+ *        log file.
+ ***********************************************************************************************************************
+ */
+
+#ifndef __TIMING_TIMING_MGR_H__
+#define __TIMING_TIMING_MGR_H__
+
+#pragma once
+
+#include "include/khronos/vulkan.h"
+
+#include "include/vk_dispatch.h"
+
+#include "palEvent.h"
+#include "palMutex.h"
+#include "palThread.h"
+
+namespace vk
+{
+
+class Device;
+
+// Identifies each Vulkan entry point shadowed by the API timing layer.
+enum ApiTimingEntry : uint32_t
+{
+    ApiTimingVkBeginCommandBuffer = 0,
+    ApiTimingVkEndCommandBuffer,
+    ApiTimingVkResetCommandBuffer,
+    ApiTimingVkCmdBindPipeline,
+    ApiTimingVkCmdBindDescriptorSets,
+    ApiTimingVkCmdBindIndexBuffer,
+    ApiTimingVkCmdBindVertexBuffers,
+    ApiTimingVkCmdDraw,
+    ApiTimingVkCmdDrawIndexed,
+    ApiTimingVkCmdDrawIndirect,
+    ApiTimingVkCmdDrawIndexedIndirect,
+    ApiTimingVkCmdDispatch,
+    ApiTimingVkCmdDispatchIndirect,
+    ApiTimingVkCmdCopyBuffer,
+    ApiTimingVkCmdCopyImage,
+    ApiTimingVkCmdBlitImage,
+    ApiTimingVkCmdCopyBufferToImage,
+    ApiTimingVkCmdCopyImageToBuffer,
+    ApiTimingVkCmdUpdateBuffer,
+    ApiTimingVkCmdFillBuffer,
+    ApiTimingVkCmdClearColorImage,
+    ApiTimingVkCmdClearDepthStencilImage,
+    ApiTimingVkCmdClearAttachments,
+    ApiTimingVkCmdResolveImage,
+    ApiTimingVkCmdSetEvent,
+    ApiTimingVkCmdResetEvent,
+    ApiTimingVkCmdWaitEvents,
+    ApiTimingVkCmdPipelineBarrier,
+    ApiTimingVkCmdBeginQuery,
+    ApiTimingVkCmdEndQuery,
+    ApiTimingVkCmdResetQueryPool,
+    ApiTimingVkCmdWriteTimestamp,
+    ApiTimingVkCmdCopyQueryPoolResults,
+    ApiTimingVkCmdPushConstants,
+    ApiTimingVkCmdBeginRenderPass,
+    ApiTimingVkCmdNextSubpass,
+    ApiTimingVkCmdEndRenderPass,
+    ApiTimingVkCmdExecuteCommands,
+    ApiTimingVkCmdSetViewport,
+    ApiTimingVkCmdSetScissor,
+    ApiTimingVkCmdSetLineWidth,
+    ApiTimingVkCmdSetDepthBias,
+    ApiTimingVkCmdSetBlendConstants,
+    ApiTimingVkCmdSetDepthBounds,
+    ApiTimingVkCmdSetStencilCompareMask,
+    ApiTimingVkCmdSetStencilWriteMask,
+    ApiTimingVkCmdSetStencilReference,
+    ApiTimingVkQueueSubmit,
+    ApiTimingVkQueueWaitIdle,
+    ApiTimingVkQueuePresentKHR,
+    ApiTimingVkDeviceWaitIdle,
+    ApiTimingVkAcquireNextImageKHR,
+    ApiTimingVkWaitForFences,
+    ApiTimingVkResetFences,
+    ApiTimingVkGetFenceStatus,
+    ApiTimingVkAllocateMemory,
+    ApiTimingVkFreeMemory,
+    ApiTimingVkMapMemory,
+    ApiTimingVkUnmapMemory,
+    ApiTimingVkFlushMappedMemoryRanges,
+    ApiTimingVkInvalidateMappedMemoryRanges,
+    ApiTimingVkCreateBuffer,
+    ApiTimingVkDestroyBuffer,
+    ApiTimingVkCreateImage,
+    ApiTimingVkDestroyImage,
+    ApiTimingVkCreateImageView,
+    ApiTimingVkDestroyImageView,
+    ApiTimingVkCreateSampler,
+    ApiTimingVkCreateGraphicsPipelines,
+    ApiTimingVkCreateComputePipelines,
+    ApiTimingVkDestroyPipeline,
+    ApiTimingVkCreateDescriptorPool,
+    ApiTimingVkResetDescriptorPool,
+    ApiTimingVkAllocateDescriptorSets,
+    ApiTimingVkFreeDescriptorSets,
+    ApiTimingVkUpdateDescriptorSets,
+    ApiTimingVkCreateCommandPool,
+    ApiTimingVkResetCommandPool,
+    ApiTimingVkAllocateCommandBuffers,
+    ApiTimingVkFreeCommandBuffers,
+    ApiTimingVkCreateQueryPool,
+    ApiTimingVkGetQueryPoolResults,
+    ApiTimingVkCreateFramebuffer,
+    ApiTimingVkCreateRenderPass,
+    ApiTimingEntryCount
+};
+
+// =====================================================================================================================
+// This class manages the CPU timing statistics of the API timing layer at the device level.
+//
+// Every calling thread records into its own block of counters, so the recording path takes no locks and issues no
+// atomics.  Block slots are released when their thread exits and reused by new threads, so only threads beyond
+// MaxThreadCount running at the same time share a single overflow block, which is protected by a lock.  The log file
+// is written by a dedicated thread so that recording threads never wait for file I/O.
+class ApiTimingMgr
+{
+public:
+    static constexpr uint32_t MaxThreadCount       = 64; // Number of threads that get a private block of counters
+    static constexpr uint32_t HistogramBucketCount = 32; // Bucket N counts calls that took [2^N, 2^(N+1)) ticks
+
+    ApiTimingMgr(Device* pDevice);
+    ~ApiTimingMgr();
+
+    Pal::Result Init();
+
+    void RecordCall(ApiTimingEntry entry, int64_t startTime);
+
+    void Dump();
+
+    VK_INLINE const EntryPointTable* GetNextLayer() const
+        { return &m_nextLayer; }
+
+private:
+    // Statistics of a single entry point
+    struct EntryStats
+    {
+        volatile uint64_t callCount;
+        volatile uint64_t totalTicks;
+        volatile uint64_t maxTicks;
+        volatile uint64_t histogram[HistogramBucketCount];
+    };
+
+    // Statistics of all entry points as recorded by a single thread
+    struct ThreadStats
+    {
+        EntryStats entries[ApiTimingEntryCount];
+    };
+
+    ThreadStats* GetThreadStats();
+
+    static void DumpThreadFunc(void* pParameter);
+
+    Device*               m_pDevice;
+    int64_t               m_perfFrequency;      // CPU performance counter ticks per second
+    uint32_t              m_id;                 // Unique ID of this manager, used to name its log file
+
+    ThreadStats* volatile m_pThreadStats[MaxThreadCount];
+    ThreadStats           m_overflowStats;      // Shared by threads without a private block
+    Util::Mutex           m_overflowLock;       // Protects m_overflowStats
+
+    Util::Thread          m_dumpThread;         // Writes the log file periodically
+    Util::Event           m_dumpThreadEvent;    // Wakes the dump thread up early when it has to exit
+    volatile uint32_t     m_dumpThreadExit;     // Non-zero when the dump thread has to exit
+
+    // Jump table to the next layer's functions
+    EntryPointTable       m_nextLayer;
+};
+
+}; // namespace vk
+
+#endif /* __TIMING_TIMING_MGR_H__ */
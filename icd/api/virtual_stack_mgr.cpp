@@ -35,18 +35,36 @@
 #include "include/vk_utils.h"
 
 #include "palListImpl.h"
+#include "palSysUtil.h"
 
 namespace vk
 {
 
 constexpr size_t MaxVirtualStackSize = 256 * 1024;  // 256 kilobytes
 
+static volatile uint32_t     g_nextCacheSlot = 0;          // Next home cache slot to hand out to a thread
+static thread_local uint32_t t_homeCacheSlot = UINT32_MAX; // Home cache slot of the calling thread
+
+// =====================================================================================================================
+// Returns the home cache slot of the calling thread, assigning one round-robin on first use.
+static uint32_t GetHomeCacheSlot(
+    uint32_t slotCount)
+{
+    if (t_homeCacheSlot == UINT32_MAX)
+    {
+        t_homeCacheSlot = (Util::AtomicIncrement(&g_nextCacheSlot) - 1) % slotCount;
+    }
+
+    return t_homeCacheSlot;
+}
+
 // =====================================================================================================================
 VirtualStackMgr::VirtualStackMgr(
     Instance* pInstance)
   : m_pInstance(pInstance),
     m_stackList(pInstance->Allocator())
 {
+    memset(const_cast<VirtualStackAllocator**>(m_cacheSlots), 0, sizeof(m_cacheSlots));
 }
 
 // =====================================================================================================================
@@ -100,6 +118,17 @@ Pal::Result VirtualStackMgr::Init()
 // Tears down the virtual stack manager.
 void VirtualStackMgr::Destroy()
 {
+    // Release the allocators parked in the cache slots
+    for (uint32_t slot = 0; slot < CacheSlotCount; ++slot)
+    {
+        if (m_cacheSlots[slot] != nullptr)
+        {
+            PAL_DELETE(m_cacheSlots[slot], m_pInstance->Allocator());
+
+            m_cacheSlots[slot] = nullptr;
+        }
+    }
+
     // Release all virtual stack allocators
     while (m_stackList.NumElements() > 0)
     {
@@ -121,6 +150,32 @@ void VirtualStackMgr::Destroy()
 // Acquires a virtual stack allocator.
 Pal::Result VirtualStackMgr::AcquireAllocator(
     VirtualStackAllocator** ppAllocator)
+{
+    Pal::Result palResult = Pal::Result::Success;
+
+    // Take the allocator parked in this thread's home slot, if any.  Taking it with an atomic exchange means that
+    // two threads sharing a slot can never both get the same allocator.
+    const uint32_t slot = GetHomeCacheSlot(CacheSlotCount);
+
+    VirtualStackAllocator* pCachedAllocator = static_cast<VirtualStackAllocator*>(
+        Util::AtomicExchangePointer(reinterpret_cast<void* volatile*>(&m_cacheSlots[slot]), nullptr));
+
+    if (pCachedAllocator != nullptr)
+    {
+        *ppAllocator = pCachedAllocator;
+    }
+    else
+    {
+        palResult = AcquireSharedAllocator(ppAllocator);
+    }
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Acquires a virtual stack allocator from the shared list of available allocators, or creates a new one.
+Pal::Result VirtualStackMgr::AcquireSharedAllocator(
+    VirtualStackAllocator** ppAllocator)
 {
     Util::MutexAuto lock(&m_lock);
 
@@ -174,14 +229,25 @@ Pal::Result VirtualStackMgr::AcquireAllocator(
 void VirtualStackMgr::ReleaseAllocator(
     VirtualStackAllocator* pAllocator)
 {
-    Util::MutexAuto lock(&m_lock);
-
     VK_ASSERT(pAllocator != nullptr);
 
-    // Simply put the allocator to the front of the list of available stack allocators
-    if (m_stackList.PushFront(pAllocator) != Pal::Result::Success)
+    // Park the allocator in this thread's home slot.  If the slot was already occupied (e.g. the thread records
+    // several command buffers at once, or shares the slot with another thread), the displaced allocator goes back to
+    // the shared list instead.
+    const uint32_t slot = GetHomeCacheSlot(CacheSlotCount);
+
+    VirtualStackAllocator* pDisplacedAllocator = static_cast<VirtualStackAllocator*>(
+        Util::AtomicExchangePointer(reinterpret_cast<void* volatile*>(&m_cacheSlots[slot]), pAllocator));
+
+    if (pDisplacedAllocator != nullptr)
     {
-        PAL_DELETE(pAllocator, m_pInstance->Allocator());
+        Util::MutexAuto lock(&m_lock);
+
+        // Simply put the allocator to the front of the list of available stack allocators
+        if (m_stackList.PushFront(pDisplacedAllocator) != Pal::Result::Success)
+        {
+            PAL_DELETE(pDisplacedAllocator, m_pInstance->Allocator());
+        }
     }
 }
 
@@ -83,7 +83,8 @@ void Buffer::CalcBarrierUsage(
         m_inputCacheMask |= Pal::CoherShader;
     }
 
-    if (usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT)
+    // The conditional rendering predicate is fetched by the command processor just like indirect arguments.
+    if (usage & (VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT))
     {
         m_inputCacheMask |= Pal::CoherIndirectArgs;
     }
@@ -406,7 +407,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer(
     if (buffer != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Buffer::ObjectFromHandle(buffer)->Destroy(pDevice, pAllocCB);
     }
@@ -144,7 +144,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyBufferView(
     if (bufferView != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         BufferView::ObjectFromHandle(bufferView)->Destroy(pDevice, pAllocCB);
     }
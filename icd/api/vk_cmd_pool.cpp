@@ -52,7 +52,8 @@ CmdPool::CmdPool(
     m_queueFamilyIndex(queueFamilyIndex),
     m_sharedCmdAllocator(sharedCmdAllocator),
     m_cmdBufferRegistry(32, pDevice->VkInstance()->Allocator()),
-    m_totalEventMgrCount(0)
+    m_totalEventMgrCount(0),
+    m_resetEpoch(0)
 {
     memcpy(m_pPalCmdAllocators, pPalCmdAllocators, sizeof(pPalCmdAllocators[0]) * pDevice->NumPalDevices());
 }
@@ -266,21 +267,31 @@ VkResult CmdPool::Reset(VkCommandPoolResetFlags flags)
     // VK_CMD_POOL_RESET_RELEASE_RESOURCES flag if present.
     VK_IGNORE(flags & VK_CMD_POOL_RESET_RELEASE_RESOURCES);
 
-    // We first have to reset all the command buffers that use this pool (PAL doesn't do this automatically).
-    for (auto it = m_cmdBufferRegistry.Begin(); (it.Get() != nullptr) && (result == VK_SUCCESS); it.Next())
+    if (m_pDevice->GetRuntimeSettings().lazyCmdPoolReset)
     {
-        // Per-spec we always have to do a command buffer reset that also releases the used resources.
-
-        result = it.Get()->key->Reset(VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT);
+        // Defer the reset of every command buffer to its next Begin() (or explicit reset) by starting a new epoch.
+        // Command buffers that are never re-recorded never pay for the reset.  They still own their PAL command
+        // chunks until their deferred reset returns them, so the per-pool CmdAllocator must not be reset here.
+        m_resetEpoch++;
     }
-
-    if (result == VK_SUCCESS)
+    else
     {
-        // After resetting the registered command buffers, reset the pool itself but only if we use per-pool
-        // CmdAllocator objects, not a single shared one.
-        if (m_sharedCmdAllocator == false)
+        // We first have to reset all the command buffers that use this pool (PAL doesn't do this automatically).
+        for (auto it = m_cmdBufferRegistry.Begin(); (it.Get() != nullptr) && (result == VK_SUCCESS); it.Next())
         {
-            result = PalCmdAllocatorReset();
+            // Per-spec we always have to do a command buffer reset that also releases the used resources.
+
+            result = it.Get()->key->Reset(VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            // After resetting the registered command buffers, reset the pool itself but only if we use per-pool
+            // CmdAllocator objects, not a single shared one.
+            if (m_sharedCmdAllocator == false)
+            {
+                result = PalCmdAllocatorReset();
+            }
         }
     }
 
@@ -362,7 +373,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool(
     if (commandPool != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         CmdPool::ObjectFromHandle(commandPool)->Destroy(pDevice, pAllocCB);
     }
@@ -28,6 +28,7 @@
 #include "include/vk_conv.h"
 #include "include/vk_device.h"
 #include "include/vk_descriptor_set.h"
+#include "include/vk_descriptor_update_template.h"
 #include "include/vk_event.h"
 #include "include/vk_formats.h"
 #include "include/vk_framebuffer.h"
@@ -53,6 +54,7 @@
 #include "palImage.h"
 #include "palQueryPool.h"
 #include "palSysMemory.h"
+#include "palDbgPrint.h"
 #include "palDevice.h"
 #include "palGpuUtil.h"
 #include "palFormatInfo.h"
@@ -170,12 +172,17 @@ CmdBuffer::CmdBuffer(
     m_palDeviceUsedMask(0),
     m_pStackAllocator(nullptr),
     m_pGpuEventMgr(nullptr),
+    m_pLastSubmitQueue(nullptr),
+    m_lastSubmitSerial(0),
+    m_timestampPoolCount(0),
     m_vbMgr(pDevice),
     m_is2ndLvl(false),
     m_isRecording(false),
+    m_poolResetEpoch(pCmdPool->GetResetEpoch()),
     m_pSqttState(nullptr),
     m_renderPassInstance(pDevice->VkInstance()->Allocator())
 {
+    memset(&m_deferredBarriers, 0, sizeof(m_deferredBarriers));
 
 #if VK_ENABLE_DEBUG_BARRIERS
     m_dbgBarrierPreCmdMask  = m_pDevice->GetRuntimeSettings().dbgBarrierPreCmdEnable;
@@ -793,6 +800,17 @@ void CmdBuffer::PalCmdSetIndirectUserDataWatermark(
 VkResult CmdBuffer::Begin(
     const VkCommandBufferBeginInfo* pBeginInfo)
 {
+    // Perform the reset deferred by a command pool reset that happened since this command buffer was last reset.
+    if (m_poolResetEpoch != m_pCmdPool->GetResetEpoch())
+    {
+        const VkResult resetResult = Reset(VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT);
+
+        if (resetResult != VK_SUCCESS)
+        {
+            return resetResult;
+        }
+    }
+
     VK_ASSERT(!m_isRecording);
 
     // Beginning a command buffer implicitly resets its state.
@@ -960,8 +978,21 @@ VkResult CmdBuffer::End(void)
 
     VK_ASSERT(m_isRecording);
 
+    // Conditional rendering blocks must not span command buffers.
+    VK_ASSERT(m_state.allGpuState.conditionalRendering.active == false);
+
     DbgBarrierPreCmd(DbgBarrierCmdBufEnd);
 
+    FlushDeferredBarriers();
+
+    if (m_deferredBarriers.apiCount > 0)
+    {
+        m_pDevice->RecordMergedBarriers(m_deferredBarriers.apiCount, m_deferredBarriers.palCount);
+
+        m_deferredBarriers.apiCount = 0;
+        m_deferredBarriers.palCount = 0;
+    }
+
     if (m_renderPassInstance.pAttachments != nullptr)
     {
         m_pDevice->VkInstance()->FreeMem(m_renderPassInstance.pAttachments);
@@ -1007,6 +1038,7 @@ void CmdBuffer::ResetState()
     m_stencilCombiner.Reset();
 
     memset(&m_state.allGpuState, 0, sizeof(AllGpuRenderState));
+    memset(&m_deferredBarriers, 0, sizeof(m_deferredBarriers));
 
     const uint32_t numPalDevices = m_pDevice->NumPalDevices();
     uint32_t deviceIdx = 0;
@@ -1034,6 +1066,11 @@ void CmdBuffer::ResetState()
         m_pGpuEventMgr->ResetCmdBuf(this);
     }
 
+    // A reset command buffer is not pending execution anymore
+    SetLastSubmit(nullptr, 0);
+
+    m_timestampPoolCount = 0;
+
     // Reset initial static values to "dynamic" values.  This will skip initial redundancy checking because the
     // prior values are unknown.
     m_state.allGpuState.staticTokens.inputAssemblyState   = DynamicRenderStateToken;
@@ -1100,6 +1137,9 @@ VkResult CmdBuffer::Reset(VkCommandBufferResetFlags flags)
 
     result = PalToVkResult(PalCmdBufferReset(nullptr, releaseResources));
 
+    // This also covers any pending pool reset
+    m_poolResetEpoch = m_pCmdPool->GetResetEpoch();
+
     return result;
 }
 // =====================================================================================================================
@@ -1258,12 +1298,20 @@ void CmdBuffer::ExecuteCommands(
 {
     DbgBarrierPreCmd(DbgBarrierExecuteCommands);
 
+    FlushDeferredBarriers();
+
     for (uint32_t i = 0; i < cmdBufferCount; i++)
     {
         CmdBuffer* pInteralCmdBuf = ApiCmdBuffer::ObjectFromHandle(pCmdBuffers[i]);
 
         Pal::ICmdBuffer* pPalNestedCmdBuffer = pInteralCmdBuf->PalCmdBuffer(DefaultDeviceIndex);
         PalCmdBuffer(DefaultDeviceIndex)->CmdExecuteNestedCmdBuffers(1, &pPalNestedCmdBuffer);
+
+        // Timestamps written by the secondary command buffer are written by the submissions of this one
+        for (uint32_t j = 0; j < pInteralCmdBuf->m_timestampPoolCount; ++j)
+        {
+            TrackTimestampPool(pInteralCmdBuf->m_pTimestampPools[j]);
+        }
     }
 
     DbgBarrierPostCmd(DbgBarrierExecuteCommands);
@@ -1369,6 +1417,17 @@ void CmdBuffer::BindDescriptorSets(
                 pDynamicOffsets += setLayoutInfo.dynDescCount;
             }
 
+            // If this descriptor set has any buffer descriptors placed inline in user data then write them into the
+            // shadow.
+            if (setLayoutInfo.inlDescDataRegCount > 0)
+            {
+                DescriptorSet::InlineDataFromHandle(
+                    pDescriptorSets[i],
+                    &(m_state.perGpuState[DefaultDeviceIndex].
+                        setBindingData[static_cast<uint32_t>(bindPoint)][setLayoutInfo.inlDescDataRegOffset]),
+                    setLayoutInfo.inlDescMask);
+            }
+
             // If this descriptor set needs a set pointer, then write it to the shadow.
             if (setLayoutInfo.setPtrRegOffset != PipelineLayout::InvalidReg)
             {
@@ -1429,6 +1488,213 @@ void CmdBuffer::BindDescriptorSets(
     DbgBarrierPostCmd(DbgBarrierBindSetsPushConstants);
 }
 
+// =====================================================================================================================
+// Allocates the memory of a push descriptor set from the command buffer's embedded data and initializes its immutable
+// sampler descriptors.  Returns the CPU address of the set or nullptr if the set layout has no descriptor memory.
+//
+// NOTE: Embedded data lives in the descriptor table VA range just like descriptor pool memory, so the same assumed
+// high 32 bits apply to the set pointer placed in user data.
+uint32_t* CmdBuffer::AllocPushDescriptorSet(
+    uint32_t                   deviceIdx,
+    const DescriptorSetLayout* pSetLayout,
+    Pal::gpusize*              pGpuAddress)
+{
+    const DescriptorSetLayout::CreateInfo& setLayoutInfo = pSetLayout->Info();
+
+    const uint32_t setDwSize      = setLayoutInfo.sta.dwSize + setLayoutInfo.fmask.dwSize;
+    const uint32_t setDwAlignment = m_pDevice->GetProperties().descriptorSizes.alignment / sizeof(uint32_t);
+
+    uint32_t* pSetCpuAddr = nullptr;
+
+    *pGpuAddress = 0;
+
+    if (setDwSize > 0)
+    {
+        pSetCpuAddr = PalCmdBuffer(deviceIdx)->CmdAllocateEmbeddedData(setDwSize, setDwAlignment, pGpuAddress);
+
+        if (setLayoutInfo.imm.numImmutableSamplers > 0)
+        {
+            DescriptorSet::WriteImmutableDescriptors(pSetLayout, pSetCpuAddr);
+        }
+    }
+
+    return pSetCpuAddr;
+}
+
+// =====================================================================================================================
+// Writes the set pointer and inline descriptors of a push descriptor set to the user data shadow of the given device.
+void CmdBuffer::SetPushDescriptorSetUserData(
+    Pal::PipelineBindPoint     bindPoint,
+    const PipelineLayout*      pLayout,
+    uint32_t                   set,
+    uint32_t                   deviceIdx,
+    Pal::gpusize               gpuAddress,
+    const uint32_t*            pInlineData)
+{
+    static_assert(PipelineLayout::SetPtrRegCount == 1, "Code below assumes one dword per set GPU VA");
+
+    const PipelineLayout::SetUserDataLayout& setLayoutInfo = pLayout->GetInfo().setUserData[set];
+
+    uint32_t* pSetBindingData = m_state.perGpuState[deviceIdx].setBindingData[static_cast<uint32_t>(bindPoint)];
+
+    // Push descriptor set layouts never contain dynamic descriptors.
+    VK_ASSERT(setLayoutInfo.dynDescDataRegCount == 0);
+
+    if (setLayoutInfo.inlDescDataRegCount > 0)
+    {
+        uint32_t* pUserData   = pSetBindingData + setLayoutInfo.inlDescDataRegOffset;
+        uint32_t  inlDescMask = setLayoutInfo.inlDescMask;
+        uint32_t  slot        = 0;
+
+        while (Util::BitMaskScanForward(&slot, inlDescMask))
+        {
+            memcpy(pUserData,
+                   pInlineData + (slot * PipelineLayout::InlineDescRegCount),
+                   PipelineLayout::InlineDescRegCount * sizeof(uint32_t));
+
+            pUserData   += PipelineLayout::InlineDescRegCount;
+            inlDescMask &= ~(1u << slot);
+        }
+    }
+
+    if (setLayoutInfo.setPtrRegOffset != PipelineLayout::InvalidReg)
+    {
+        // We have an assumed high 32 bits for the address thus only the lower 32 bits of the address have to be used
+        pSetBindingData[setLayoutInfo.setPtrRegOffset] = static_cast<uint32_t>(gpuAddress & 0xFFFFFFFFull);
+    }
+}
+
+// =====================================================================================================================
+// Programs the user data registers of a push descriptor set from the shadow written by SetPushDescriptorSetUserData.
+void CmdBuffer::CommitPushDescriptorSet(
+    Pal::PipelineBindPoint     bindPoint,
+    const PipelineLayout*      pLayout,
+    uint32_t                   set)
+{
+    PipelineBindState* pBindState = &m_state.allGpuState.pipelineState[static_cast<uint32_t>(bindPoint)];
+
+    const PipelineLayout::Info&              layoutInfo    = pLayout->GetInfo();
+    const PipelineLayout::SetUserDataLayout& setLayoutInfo = layoutInfo.setUserData[set];
+
+    const uint32_t rangeOffsetBegin = setLayoutInfo.firstRegOffset;
+    const uint32_t rangeRegCount    = setLayoutInfo.totalRegCount;
+
+    pBindState->boundSetCount = Util::Max(pBindState->boundSetCount, rangeOffsetBegin + rangeRegCount);
+
+    // Program the user data registers only if the current user data layout base matches that of the given layout (see
+    // BindDescriptorSets for details).
+    if ((rangeRegCount > 0) &&
+        (pBindState->userDataLayout.setBindingRegBase == layoutInfo.userDataLayout.setBindingRegBase))
+    {
+        utils::IterateMask deviceGroup(m_palDeviceMask);
+        while (deviceGroup.Iterate())
+        {
+            const uint32_t deviceIdx = deviceGroup.Index();
+
+            PalCmdBuffer(deviceIdx)->CmdSetUserData(
+                bindPoint,
+                pBindState->userDataLayout.setBindingRegBase + rangeOffsetBegin,
+                rangeRegCount,
+                &(m_state.perGpuState[deviceIdx].
+                    setBindingData[static_cast<uint32_t>(bindPoint)][rangeOffsetBegin]));
+        }
+    }
+}
+
+// =====================================================================================================================
+// Implements vkCmdPushDescriptorSetKHR.  Rather than going through a descriptor pool, the descriptors are written
+// straight into command buffer embedded data and the resulting set pointer is placed in user data.
+void CmdBuffer::PushDescriptorSetKHR(
+    VkPipelineBindPoint         pipelineBindPoint,
+    VkPipelineLayout            layout,
+    uint32_t                    set,
+    uint32_t                    descriptorWriteCount,
+    const VkWriteDescriptorSet* pDescriptorWrites)
+{
+    DbgBarrierPreCmd(DbgBarrierBindSetsPushConstants);
+
+    const Pal::PipelineBindPoint bindPoint = (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS) ?
+        Pal::PipelineBindPoint::Graphics :
+        Pal::PipelineBindPoint::Compute;
+
+    const PipelineLayout*      pLayout          = PipelineLayout::ObjectFromHandle(layout);
+    const DescriptorSetLayout* pSetLayout       = pLayout->GetInfo().pSetLayouts[set];
+    const Device::Properties&  deviceProperties = m_pDevice->GetProperties();
+
+    VK_ASSERT(set < pLayout->GetInfo().setCount);
+
+    utils::IterateMask deviceGroup(m_palDeviceMask);
+    while (deviceGroup.Iterate())
+    {
+        const uint32_t deviceIdx = deviceGroup.Index();
+
+        uint32_t     inlineData[MaxInlDescRegCount];
+        Pal::gpusize gpuAddress  = 0;
+        uint32_t*    pSetCpuAddr = AllocPushDescriptorSet(deviceIdx, pSetLayout, &gpuAddress);
+
+        for (uint32_t i = 0; i < descriptorWriteCount; ++i)
+        {
+            VK_ASSERT(pDescriptorWrites[i].sType == VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET);
+
+            DescriptorSet::WriteDescriptors(m_pDevice,
+                                            deviceIdx,
+                                            deviceProperties,
+                                            pSetLayout,
+                                            pSetCpuAddr,
+                                            inlineData,
+                                            nullptr,
+                                            pDescriptorWrites[i]);
+        }
+
+        SetPushDescriptorSetUserData(bindPoint, pLayout, set, deviceIdx, gpuAddress, inlineData);
+    }
+
+    CommitPushDescriptorSet(bindPoint, pLayout, set);
+
+    DbgBarrierPostCmd(DbgBarrierBindSetsPushConstants);
+}
+
+// =====================================================================================================================
+// Implements vkCmdPushDescriptorSetWithTemplateKHR.  Same as PushDescriptorSetKHR but the descriptor writes are
+// described by a push descriptor update template.
+void CmdBuffer::PushDescriptorSetWithTemplateKHR(
+    VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+    VkPipelineLayout              layout,
+    uint32_t                      set,
+    const void*                   pData)
+{
+    DbgBarrierPreCmd(DbgBarrierBindSetsPushConstants);
+
+    const DescriptorUpdateTemplate* pTemplate = DescriptorUpdateTemplate::ObjectFromHandle(descriptorUpdateTemplate);
+
+    const Pal::PipelineBindPoint bindPoint = (pTemplate->GetPipelineBindPoint() == VK_PIPELINE_BIND_POINT_GRAPHICS) ?
+        Pal::PipelineBindPoint::Graphics :
+        Pal::PipelineBindPoint::Compute;
+
+    const PipelineLayout*      pLayout    = PipelineLayout::ObjectFromHandle(layout);
+    const DescriptorSetLayout* pSetLayout = pLayout->GetInfo().pSetLayouts[set];
+
+    VK_ASSERT(set < pLayout->GetInfo().setCount);
+
+    utils::IterateMask deviceGroup(m_palDeviceMask);
+    while (deviceGroup.Iterate())
+    {
+        const uint32_t deviceIdx = deviceGroup.Index();
+
+        uint32_t     inlineData[MaxInlDescRegCount];
+        Pal::gpusize gpuAddress  = 0;
+        uint32_t*    pSetCpuAddr = AllocPushDescriptorSet(deviceIdx, pSetLayout, &gpuAddress);
+
+        pTemplate->PushUpdate(m_pDevice, deviceIdx, pSetLayout, pSetCpuAddr, inlineData, pData);
+
+        SetPushDescriptorSetUserData(bindPoint, pLayout, set, deviceIdx, gpuAddress, inlineData);
+    }
+
+    CommitPushDescriptorSet(bindPoint, pLayout, set);
+
+    DbgBarrierPostCmd(DbgBarrierBindSetsPushConstants);
+}
+
 // =====================================================================================================================
 void CmdBuffer::BindIndexBuffer(
     VkBuffer     buffer,
@@ -1476,11 +1742,17 @@ void CmdBuffer::Draw(
 {
     DbgBarrierPreCmd(DbgBarrierDrawNonIndexed);
 
+    FlushDeferredBarriers();
+
+    PalCmdBeginPredicated();
+
     PalCmdDraw(firstVertex,
         vertexCount,
         firstInstance,
         instanceCount);
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd(DbgBarrierDrawNonIndexed);
 }
 
@@ -1494,12 +1766,18 @@ void CmdBuffer::DrawIndexed(
 {
     DbgBarrierPreCmd(DbgBarrierDrawIndexed);
 
+    FlushDeferredBarriers();
+
+    PalCmdBeginPredicated();
+
     PalCmdDrawIndexed(firstIndex,
                       indexCount,
                       vertexOffset,
                       firstInstance,
                       instanceCount);
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd(DbgBarrierDrawIndexed);
 }
 
@@ -1515,8 +1793,12 @@ void CmdBuffer::DrawIndirect(
 {
     DbgBarrierPreCmd((indexed ? DbgBarrierDrawIndexed : DbgBarrierDrawNonIndexed) | DbgBarrierDrawIndirect);
 
+    FlushDeferredBarriers();
+
     Buffer* pBuffer = Buffer::ObjectFromHandle(buffer);
 
+    PalCmdBeginPredicated();
+
     if ((stride + offset) <= pBuffer->PalMemory(DefaultDeviceIndex)->Desc().size)
     {
         const Pal::gpusize paramOffset = pBuffer->MemOffset() + offset;
@@ -1555,6 +1837,8 @@ void CmdBuffer::DrawIndirect(
         }
     }
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd((indexed ? DbgBarrierDrawIndexed : DbgBarrierDrawNonIndexed) | DbgBarrierDrawIndirect);
 }
 
@@ -1566,8 +1850,14 @@ void CmdBuffer::Dispatch(
 {
     DbgBarrierPreCmd(DbgBarrierDispatch);
 
+    FlushDeferredBarriers();
+
+    PalCmdBeginPredicated();
+
     PalCmdDispatch(x, y, z);
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd(DbgBarrierDispatch);
 }
 
@@ -1582,8 +1872,14 @@ void CmdBuffer::DispatchOffset(
 {
     DbgBarrierPreCmd(DbgBarrierDispatch);
 
+    FlushDeferredBarriers();
+
+    PalCmdBeginPredicated();
+
     PalCmdDispatchOffset(base_x, base_y, base_z, dim_x, dim_y, dim_z);
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd(DbgBarrierDispatch);
 }
 
@@ -1594,10 +1890,16 @@ void CmdBuffer::DispatchIndirect(
 {
     DbgBarrierPreCmd(DbgBarrierDispatchIndirect);
 
+    FlushDeferredBarriers();
+
     Buffer* pBuffer = Buffer::ObjectFromHandle(buffer);
 
+    PalCmdBeginPredicated();
+
     PalCmdDispatchIndirect(pBuffer, offset);
 
+    PalCmdEndPredicated();
+
     DbgBarrierPostCmd(DbgBarrierDispatchIndirect);
 }
 
@@ -1610,6 +1912,8 @@ void CmdBuffer::CopyBuffer(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer);
 
+    FlushDeferredBarriers();
+
     VirtualStackFrame virtStackFrame(m_pStackAllocator);
 
     // Allocate space to store memory copy regions
@@ -1643,6 +1947,8 @@ void CmdBuffer::CopyImage(
 {
     DbgBarrierPreCmd(DbgBarrierCopyImage);
 
+    FlushDeferredBarriers();
+
     VirtualStackFrame virtStackFrame(m_pStackAllocator);
 
     Pal::ImageCopyRegion* pPalRegions =
@@ -1718,6 +2024,8 @@ void CmdBuffer::BlitImage(
 {
     DbgBarrierPreCmd(DbgBarrierCopyImage);
 
+    FlushDeferredBarriers();
+
     const Image* const pSrcImage    = Image::ObjectFromHandle(srcImage);
     const Image* const pDstImage    = Image::ObjectFromHandle(destImage);
 
@@ -1793,6 +2101,8 @@ void CmdBuffer::CopyBufferToImage(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer | DbgBarrierCopyImage);
 
+    FlushDeferredBarriers();
+
     VirtualStackFrame virtStackFrame(m_pStackAllocator);
 
     // Allocate space to store memory image copy regions
@@ -1841,6 +2151,8 @@ void CmdBuffer::CopyImageToBuffer(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer | DbgBarrierCopyImage);
 
+    FlushDeferredBarriers();
+
     VirtualStackFrame virtStackFrame(m_pStackAllocator);
 
     // Allocate space to store memory image copy regions
@@ -1904,6 +2216,8 @@ void CmdBuffer::UpdateBuffer(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer);
 
+    FlushDeferredBarriers();
+
     Buffer* pDestBuffer = Buffer::ObjectFromHandle(destBuffer);
 
     PalCmdUpdateBuffer(pDestBuffer, pDestBuffer->MemOffset() + destOffset, dataSize, pData);
@@ -1920,6 +2234,8 @@ void CmdBuffer::FillBuffer(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer);
 
+    FlushDeferredBarriers();
+
     Buffer* pDestBuffer = Buffer::ObjectFromHandle(destBuffer);
 
     if (fillSize == VK_WHOLE_SIZE)
@@ -2100,6 +2416,10 @@ void CmdBuffer::ClearAttachments(
     uint32_t                 rectCount,
     const VkClearRect*       pRects)
 {
+    FlushDeferredBarriers();
+
+    PalCmdBeginPredicated();
+
     if ((m_is2ndLvl == false) && (m_state.allGpuState.pFramebuffer != nullptr))
     {
         ClearImageAttachments(attachmentCount, pAttachments, rectCount, pRects);
@@ -2108,6 +2428,8 @@ void CmdBuffer::ClearAttachments(
     {
         ClearBoundAttachments(attachmentCount, pAttachments, rectCount, pRects);
     }
+
+    PalCmdEndPredicated();
 }
 
 // =====================================================================================================================
@@ -2234,6 +2556,8 @@ void CmdBuffer::PalCmdClearColorImage(
 {
     DbgBarrierPreCmd(DbgBarrierClearColor);
 
+    FlushDeferredBarriers();
+
     PreBltBindMsaaState(image);
 
     utils::IterateMask deviceGroup(m_palDeviceMask);
@@ -2273,6 +2597,8 @@ void CmdBuffer::PalCmdClearDepthStencil(
 {
     DbgBarrierPreCmd(DbgBarrierClearDepth);
 
+    FlushDeferredBarriers();
+
     PreBltBindMsaaState(image);
 
     utils::IterateMask deviceGroup(m_palDeviceMask);
@@ -2352,6 +2678,8 @@ void CmdBuffer::PalCmdResolveImage(
 {
     DbgBarrierPreCmd(DbgBarrierResolve);
 
+    FlushDeferredBarriers();
+
     PreBltBindMsaaState(srcImage);
 
     utils::IterateMask deviceGroup(m_palDeviceMask);
@@ -2602,6 +2930,8 @@ void CmdBuffer::SetEvent(
 {
     DbgBarrierPreCmd(DbgBarrierSetResetEvent);
 
+    FlushDeferredBarriers();
+
     PalCmdSetEvent(Event::ObjectFromHandle(event), VkToPalSrcPipePoint(stageMask));
 
     DbgBarrierPostCmd(DbgBarrierSetResetEvent);
@@ -2614,6 +2944,8 @@ void CmdBuffer::ResetEvent(
 {
     DbgBarrierPreCmd(DbgBarrierSetResetEvent);
 
+    FlushDeferredBarriers();
+
     Event* pEvent = Event::ObjectFromHandle(event);
 
     const Pal::HwPipePoint pipePoint = VkToPalSrcPipePoint(stageMask);
@@ -3097,6 +3429,8 @@ void CmdBuffer::WaitEvents(
 {
     DbgBarrierPreCmd(DbgBarrierPipelineBarrierWaitEvents);
 
+    FlushDeferredBarriers();
+
     VirtualStackFrame virtStackFrame(m_pStackAllocator);
 
     // Allocate space to store signaled event pointers (automatically rewound on unscope)
@@ -3151,32 +3485,141 @@ void CmdBuffer::PipelineBarrier(
 {
     DbgBarrierPreCmd(DbgBarrierPipelineBarrierWaitEvents);
 
-    VirtualStackFrame virtStackFrame(m_pStackAllocator);
+    // Barriers without image layout transitions are merged with adjacent ones and issued before the next GPU work.
+    if ((imageMemoryBarrierCount > 0) ||
+        (DeferBarriers(srcStageMask,
+                       destStageMask,
+                       memBarrierCount,
+                       pMemoryBarriers,
+                       bufferMemoryBarrierCount,
+                       pBufferMemoryBarriers) == false))
+    {
+        FlushDeferredBarriers();
+
+        VirtualStackFrame virtStackFrame(m_pStackAllocator);
+
+        Pal::BarrierInfo barrier = {};
+
+        // Tell PAL to wait at a specific point until the given set of pipeline events has been signaled (this version
+        // does not use GpuEvent objects).
+        barrier.flags.u32All = 0;
+        barrier.waitPoint = VkToPalWaitPipePoint(destStageMask);
+
+        // Collect signal pipe points.
+        Pal::HwPipePoint pipePoints[MaxHwPipePoints];
+
+        barrier.pipePointWaitCount = VkToPalSrcPipePoints(srcStageMask, pipePoints);
+        barrier.pPipePoints = pipePoints;
+        barrier.pSplitBarrierGpuEvent = nullptr;
+
+        ExecuteBarriers(virtStackFrame,
+                        memBarrierCount,
+                        pMemoryBarriers,
+                        bufferMemoryBarrierCount,
+                        pBufferMemoryBarriers,
+                        imageMemoryBarrierCount,
+                        pImageMemoryBarriers,
+                        &barrier);
+    }
+
+    DbgBarrierPostCmd(DbgBarrierPipelineBarrierWaitEvents);
+}
+
+// =====================================================================================================================
+// Merges a vkCmdPipelineBarrier() without image memory barriers into the pending deferred barrier.  Buffer barriers
+// are global cache operations in PAL, so the union of the stage and cache masks of consecutive barriers is equivalent
+// to issuing them one by one, as long as no GPU work is recorded in between.  Returns false if the barrier was not
+// deferred and must be executed immediately.
+bool CmdBuffer::DeferBarriers(
+    VkPipelineStageFlags         srcStageMask,
+    VkPipelineStageFlags         destStageMask,
+    uint32_t                     memBarrierCount,
+    const VkMemoryBarrier*       pMemoryBarriers,
+    uint32_t                     bufferMemoryBarrierCount,
+    const VkBufferMemoryBarrier* pBufferMemoryBarriers)
+{
+    const bool deferred = m_pDevice->GetRuntimeSettings().deferPipelineBarriers &&
+                          ((memBarrierCount + bufferMemoryBarrierCount) > 0);
+
+    if (deferred)
+    {
+        const uint32_t barrierOptions = m_pDevice->GetRuntimeSettings().resourceBarrierOptions;
+
+        Pal::BarrierTransition transition = {};
+
+        for (uint32_t i = 0; i < memBarrierCount; ++i)
+        {
+            VK_ASSERT(pMemoryBarriers[i].pNext == nullptr);
+
+            ConvertBarrierCacheFlags(pMemoryBarriers[i].srcAccessMask,
+                                     pMemoryBarriers[i].dstAccessMask,
+                                     0xFFFFFFFF,
+                                     0xFFFFFFFF,
+                                     barrierOptions,
+                                     &transition);
+
+            m_deferredBarriers.srcCacheMask |= transition.srcCacheMask;
+            m_deferredBarriers.dstCacheMask |= transition.dstCacheMask;
+        }
+
+        for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i)
+        {
+            VK_ASSERT(pBufferMemoryBarriers[i].pNext == nullptr);
+
+            const Buffer* pBuffer = Buffer::ObjectFromHandle(pBufferMemoryBarriers[i].buffer);
+
+            ConvertBarrierCacheFlags(pBufferMemoryBarriers[i].srcAccessMask,
+                                     pBufferMemoryBarriers[i].dstAccessMask,
+                                     pBuffer->GetSupportedInputCoherMask(),
+                                     pBuffer->GetSupportedOutputCoherMask(),
+                                     barrierOptions,
+                                     &transition);
+
+            m_deferredBarriers.srcCacheMask |= transition.srcCacheMask;
+            m_deferredBarriers.dstCacheMask |= transition.dstCacheMask;
+        }
+
+        m_deferredBarriers.srcStageMask |= srcStageMask;
+        m_deferredBarriers.dstStageMask |= destStageMask;
+        m_deferredBarriers.pendingCount++;
+        m_deferredBarriers.apiCount++;
+    }
+
+    return deferred;
+}
+
+// =====================================================================================================================
+// Issues the merged deferred barrier as a single PAL barrier with one global transition.
+void CmdBuffer::ExecuteDeferredBarriers()
+{
+    VK_ASSERT(m_deferredBarriers.pendingCount > 0);
 
     Pal::BarrierInfo barrier = {};
 
-    // Tell PAL to wait at a specific point until the given set of pipeline events has been signaled (this version
-    // does not use GpuEvent objects).
-    barrier.flags.u32All = 0;
-    barrier.waitPoint = VkToPalWaitPipePoint(destStageMask);
+    barrier.waitPoint = VkToPalWaitPipePoint(m_deferredBarriers.dstStageMask);
 
-    // Collect signal pipe points.
     Pal::HwPipePoint pipePoints[MaxHwPipePoints];
 
-    barrier.pipePointWaitCount = VkToPalSrcPipePoints(srcStageMask, pipePoints);
-    barrier.pPipePoints = pipePoints;
-    barrier.pSplitBarrierGpuEvent = nullptr;
+    barrier.pipePointWaitCount = VkToPalSrcPipePoints(m_deferredBarriers.srcStageMask, pipePoints);
+    barrier.pPipePoints        = pipePoints;
 
-    ExecuteBarriers(virtStackFrame,
-                    memBarrierCount,
-                    pMemoryBarriers,
-                    bufferMemoryBarrierCount,
-                    pBufferMemoryBarriers,
-                    imageMemoryBarrierCount,
-                    pImageMemoryBarriers,
-                    &barrier);
+    Pal::BarrierTransition transition = {};
 
-    DbgBarrierPostCmd(DbgBarrierPipelineBarrierWaitEvents);
+    transition.srcCacheMask     = m_deferredBarriers.srcCacheMask;
+    transition.dstCacheMask     = m_deferredBarriers.dstCacheMask;
+    transition.imageInfo.pImage = nullptr;
+
+    barrier.transitionCount = 1;
+    barrier.pTransitions    = &transition;
+
+    PalCmdBarrier(barrier);
+
+    m_deferredBarriers.pendingCount = 0;
+    m_deferredBarriers.srcStageMask = 0;
+    m_deferredBarriers.dstStageMask = 0;
+    m_deferredBarriers.srcCacheMask = 0;
+    m_deferredBarriers.dstCacheMask = 0;
+    m_deferredBarriers.palCount++;
 }
 
 // =====================================================================================================================
@@ -3187,6 +3630,8 @@ void CmdBuffer::BeginQuery(
 {
     DbgBarrierPreCmd(DbgBarrierQueryBeginEnd);
 
+    FlushDeferredBarriers();
+
     // NOTE: This function is illegal to call for TimestampQueryPools
     const PalQueryPool* pQueryPool = QueryPool::ObjectFromHandle(queryPool)->AsPalQueryPool();
 
@@ -3205,6 +3650,8 @@ void CmdBuffer::EndQuery(
 {
     DbgBarrierPreCmd(DbgBarrierQueryBeginEnd);
 
+    FlushDeferredBarriers();
+
     // NOTE: This function is illegal to call for TimestampQueryPools
     const PalQueryPool* pQueryPool = QueryPool::ObjectFromHandle(queryPool)->AsPalQueryPool();
 
@@ -3223,6 +3670,8 @@ void CmdBuffer::ResetQueryPool(
 {
     DbgBarrierPreCmd(DbgBarrierQueryReset);
 
+    FlushDeferredBarriers();
+
     const QueryPool* pBasePool = QueryPool::ObjectFromHandle(queryPool);
 
     if (pBasePool->GetQueryType() != VK_QUERY_TYPE_TIMESTAMP)
@@ -3421,6 +3870,8 @@ void CmdBuffer::CopyQueryPoolResults(
 {
     DbgBarrierPreCmd(DbgBarrierCopyBuffer | DbgBarrierCopyQueryPool);
 
+    FlushDeferredBarriers();
+
     const QueryPool* pBasePool = QueryPool::ObjectFromHandle(queryPool);
     const Buffer* pDestBuffer = Buffer::ObjectFromHandle(destBuffer);
 
@@ -3580,6 +4031,8 @@ void CmdBuffer::WriteTimestamp(
 {
     DbgBarrierPreCmd(DbgBarrierWriteTimestamp);
 
+    FlushDeferredBarriers();
+
     utils::IterateMask deviceGroup(m_palDeviceMask);
     while (deviceGroup.Iterate())
     {
@@ -3590,9 +4043,44 @@ void CmdBuffer::WriteTimestamp(
             pQueryPool->PalMemory(deviceIdx),
             pQueryPool->GetSlotOffset(query));
     }
+
+    TrackTimestampPool(pQueryPool);
+
     DbgBarrierPostCmd(DbgBarrierWriteTimestamp);
 }
 
+// =====================================================================================================================
+// Adds a timestamp query pool to the pools written by this command buffer, unless it is already tracked or the maximum
+// number of tracked pools has been reached.
+void CmdBuffer::TrackTimestampPool(
+    const TimestampQueryPool* pQueryPool)
+{
+    bool tracked = false;
+
+    for (uint32_t i = 0; (i < m_timestampPoolCount) && (tracked == false); ++i)
+    {
+        tracked = (m_pTimestampPools[i] == pQueryPool);
+    }
+
+    if ((tracked == false) && (m_timestampPoolCount < MaxTrackedTimestampPools))
+    {
+        m_pTimestampPools[m_timestampPoolCount++] = pQueryPool;
+    }
+}
+
+// =====================================================================================================================
+// Records a queue submission of this command buffer with the timestamp query pools it writes to, so that their results
+// can be waited for on the submission.
+void CmdBuffer::SetTimestampSubmit(
+    Queue*   pQueue,
+    uint64_t serial) const
+{
+    for (uint32_t i = 0; i < m_timestampPoolCount; ++i)
+    {
+        m_pTimestampPools[i]->SetLastWrite(pQueue, serial);
+    }
+}
+
 // =====================================================================================================================
 void CmdBuffer::SetSampleLocations(
     const VkSampleLocationsInfoEXT* pSampleLocationsInfo)
@@ -3608,6 +4096,72 @@ void CmdBuffer::SetSampleLocations(
     PalCmdSetMsaaQuadSamplePattern(sampleLocationsPerPixel, locations);
 }
 
+// =====================================================================================================================
+// Begins a conditional rendering block (vkCmdBeginConditionalRenderingEXT).  Until the block ends, the command
+// processor discards draws, dispatches and attachment clears based on the 32-bit predicate in the given buffer, so the
+// predicate never has to be read back by the CPU.  Predication is enabled around each of those commands only, leaving
+// copies, blits, barriers and query commands recorded inside the block unaffected.
+void CmdBuffer::BeginConditionalRendering(
+    const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
+{
+    VK_ASSERT(m_state.allGpuState.conditionalRendering.active == false);
+
+    m_state.allGpuState.conditionalRendering.pBuffer  = Buffer::ObjectFromHandle(pConditionalRenderingBegin->buffer);
+    m_state.allGpuState.conditionalRendering.offset   = pConditionalRenderingBegin->offset;
+    m_state.allGpuState.conditionalRendering.inverted =
+        ((pConditionalRenderingBegin->flags & VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT) != 0);
+    m_state.allGpuState.conditionalRendering.active   = true;
+}
+
+// =====================================================================================================================
+// Ends the current conditional rendering block (vkCmdEndConditionalRenderingEXT).
+void CmdBuffer::EndConditionalRendering()
+{
+    VK_ASSERT(m_state.allGpuState.conditionalRendering.active);
+
+    m_state.allGpuState.conditionalRendering.active = false;
+}
+
+// =====================================================================================================================
+// Programs PAL predication from the active conditional rendering state, or disables predication.
+void CmdBuffer::PalCmdSetPredication(
+    bool enable)
+{
+    const Buffer* pBuffer = m_state.allGpuState.conditionalRendering.pBuffer;
+
+    utils::IterateMask deviceGroup(m_palDeviceMask);
+    while (deviceGroup.Iterate())
+    {
+        const uint32_t deviceIdx = deviceGroup.Index();
+
+        if (enable)
+        {
+            // Commands execute when the predicate is non-zero, or when it is zero for an inverted block.
+            PalCmdBuffer(deviceIdx)->CmdSetPredication(
+                nullptr,
+                0,
+                pBuffer->PalMemory(deviceIdx),
+                pBuffer->MemOffset() + m_state.allGpuState.conditionalRendering.offset,
+                Pal::PredicateType::Boolean32,
+                (m_state.allGpuState.conditionalRendering.inverted == false),
+                false,
+                false);
+        }
+        else
+        {
+            PalCmdBuffer(deviceIdx)->CmdSetPredication(
+                nullptr,
+                0,
+                nullptr,
+                0,
+                Pal::PredicateType::Boolean32,
+                false,
+                false,
+                false);
+        }
+    }
+}
+
 // =====================================================================================================================
 // Programs the current GPU sample pattern to the one belonging to the given subpass in a current render pass instance
 void CmdBuffer::RPInitSamplePattern()
@@ -3635,6 +4189,8 @@ void CmdBuffer::BeginRenderPass(
 {
     DbgBarrierPreCmd(DbgBarrierBeginRenderPass);
 
+    FlushDeferredBarriers();
+
     m_state.allGpuState.pRenderPass  = RenderPass::ObjectFromHandle(pRenderPassBegin->renderPass);
     m_state.allGpuState.pFramebuffer = Framebuffer::ObjectFromHandle(pRenderPassBegin->framebuffer);
 
@@ -3907,6 +4463,8 @@ void CmdBuffer::NextSubPass(VkSubpassContents contents)
 {
     DbgBarrierPreCmd(DbgBarrierNextSubpass);
 
+    FlushDeferredBarriers();
+
     if (m_renderPassInstance.subpass != VK_SUBPASS_EXTERNAL)
     {
         // End the previous subpass
@@ -4500,6 +5058,8 @@ void CmdBuffer::EndRenderPass()
 {
     DbgBarrierPreCmd(DbgBarrierEndRenderPass);
 
+    FlushDeferredBarriers();
+
     if (m_renderPassInstance.subpass != VK_SUBPASS_EXTERNAL)
     {
         // Close the previous subpass
@@ -5042,6 +5602,38 @@ VKAPI_ATTR void VKAPI_CALL vkCmdBindDescriptorSets(
         pDynamicOffsets);
 }
 
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites)
+{
+    ApiCmdBuffer::ObjectFromHandle(commandBuffer)->PushDescriptorSetKHR(
+        pipelineBindPoint,
+        layout,
+        set,
+        descriptorWriteCount,
+        pDescriptorWrites);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetWithTemplateKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkDescriptorUpdateTemplateKHR               descriptorUpdateTemplate,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    const void*                                 pData)
+{
+    ApiCmdBuffer::ObjectFromHandle(commandBuffer)->PushDescriptorSetWithTemplateKHR(
+        descriptorUpdateTemplate,
+        layout,
+        set,
+        pData);
+}
+
 // =====================================================================================================================
 VKAPI_ATTR void VKAPI_CALL vkCmdBindIndexBuffer(
     VkCommandBuffer                             cmdBuffer,
@@ -5186,6 +5778,50 @@ VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountAMD(
         countOffset);
 }
 
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndirectCountKHR(
+    VkCommandBuffer                             cmdBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    constexpr bool Indexed       = false;
+    constexpr bool BufferedCount = true;
+
+    ApiCmdBuffer::ObjectFromHandle(cmdBuffer)->DrawIndirect<Indexed, BufferedCount>(
+        buffer,
+        offset,
+        maxDrawCount,
+        stride,
+        countBuffer,
+        countOffset);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdDrawIndexedIndirectCountKHR(
+    VkCommandBuffer                             cmdBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride)
+{
+    constexpr bool Indexed       = true;
+    constexpr bool BufferedCount = true;
+
+    ApiCmdBuffer::ObjectFromHandle(cmdBuffer)->DrawIndirect<Indexed, BufferedCount>(
+        buffer,
+        offset,
+        maxDrawCount,
+        stride,
+        countBuffer,
+        countOffset);
+}
+
 // =====================================================================================================================
 VKAPI_ATTR void VKAPI_CALL vkCmdDispatch(
     VkCommandBuffer                             cmdBuffer,
@@ -5735,6 +6371,21 @@ VKAPI_ATTR void VKAPI_CALL vkCmdSetSampleLocationsEXT(
 {
     ApiCmdBuffer::ObjectFromHandle(commandBuffer)->SetSampleLocations(pSampleLocationsInfo);
 }
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdBeginConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin)
+{
+    ApiCmdBuffer::ObjectFromHandle(commandBuffer)->BeginConditionalRendering(pConditionalRenderingBegin);
+}
+
+// =====================================================================================================================
+VKAPI_ATTR void VKAPI_CALL vkCmdEndConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer)
+{
+    ApiCmdBuffer::ObjectFromHandle(commandBuffer)->EndConditionalRendering();
+}
 } // namespace entry
 
 } // namespace vk
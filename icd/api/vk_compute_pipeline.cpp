@@ -53,7 +53,8 @@ VkResult ComputePipeline::ConvertComputePipelineInfo(
     void**                                  ppTempBuffer,
     void**                                  ppTempShaderBuffer,
     size_t*                                 pPipelineBinarySize,
-    const void**                            ppPipelineBinary)
+    const void**                            ppPipelineBinary,
+    PipelineCreationFeedback*               pFeedback)
 {
     union
     {
@@ -184,6 +185,9 @@ VkResult ComputePipeline::ConvertComputePipelineInfo(
 
                         pipelineBinarySize = pOutInfo->pipelineBinarySize;
                         pPipelineBinary    = pOutInfo->pPipelineBinary;
+
+                        pFeedback->pipeline                   = pipelineOut.pipelineFeedback;
+                        pFeedback->stages[ShaderStageCompute] = pipelineOut.stageFeedback;
                     }
                 }
                 else
@@ -241,9 +245,10 @@ ComputePipeline::ComputePipeline(
     Pal::IPipeline**                     pPalPipeline,
     const PipelineLayout*                pPipelineLayout,
     PipelineBinaryInfo*                  pPipelineBinary,
-    const ImmedInfo&                     immedInfo)
+    const ImmedInfo&                     immedInfo,
+    const PipelineCreationFeedback&      feedback)
     :
-    Pipeline(pDevice, pPalPipeline, pPipelineLayout, pPipelineBinary),
+    Pipeline(pDevice, pPalPipeline, pPipelineLayout, pPipelineBinary, feedback),
     m_info(immedInfo)
 {
     CreateStaticState();
@@ -295,6 +300,7 @@ VkResult ComputePipeline::Create(
     void*                          pTempShaderBuffer          = nullptr;
     size_t                         pipelineBinarySize         = 0;
     const void*                    pPipelineBinary            = nullptr;
+    PipelineCreationFeedback       feedback                   = {};
 
     const PipelineLayout* pLayout = PipelineLayout::ObjectFromHandle(pCreateInfo->layout);
 
@@ -308,7 +314,8 @@ VkResult ComputePipeline::Create(
         &pTempBuffer,
         &pTempShaderBuffer,
         &pipelineBinarySize,
-        &pPipelineBinary);
+        &pPipelineBinary,
+        &feedback);
 
     if (result != VK_SUCCESS)
     {
@@ -397,7 +404,9 @@ VkResult ComputePipeline::Create(
     if (result == VK_SUCCESS)
     {
         // On success, wrap it up in a Vulkan object and return.
-        VK_PLACEMENT_NEW(pSystemMem) ComputePipeline(pDevice, pPalPipeline, pLayout, pBinary, immedInfo);
+        VK_PLACEMENT_NEW(pSystemMem) ComputePipeline(pDevice, pPalPipeline, pLayout, pBinary, immedInfo, feedback);
+
+        WriteCreationFeedback(pCreateInfo->pNext, 1, &pCreateInfo->stage, feedback);
 
         *pPipeline = ComputePipeline::HandleFromVoidPointer(pSystemMem);
     }
@@ -201,10 +201,12 @@ VkResult DescriptorPool::Destroy(
 }
 
 // =====================================================================================================================
-// Allocate descriptor sets from a descriptor set region.
+// Allocate descriptor sets from a descriptor set region.  pVariableDescriptorCounts is optional and gives the actual
+// number of descriptors in the variable-sized binding of each set.
 VkResult DescriptorPool::AllocDescriptorSets(
     uint32_t                        count,
     const VkDescriptorSetLayout*    pSetLayouts,
+    const uint32_t*                 pVariableDescriptorCounts,
     VkDescriptorSet*                pDescriptorSets)
 {
     VkResult result = VK_SUCCESS;
@@ -218,10 +220,13 @@ VkResult DescriptorPool::AllocDescriptorSets(
             // Try to allocate GPU memory for the descriptor set
             const DescriptorSetLayout* pLayout = DescriptorSetLayout::ObjectFromHandle(pSetLayouts[allocCount]);
 
+            const uint32_t variableDescriptorCount =
+                (pVariableDescriptorCounts != nullptr) ? pVariableDescriptorCounts[allocCount] : 0;
+
             Pal::gpusize setGpuMemOffset;
             void* pSetAllocHandle;
 
-            if (m_gpuMemHeap.AllocSetGpuMem(pLayout, &setGpuMemOffset, &pSetAllocHandle))
+            if (m_gpuMemHeap.AllocSetGpuMem(pLayout, variableDescriptorCount, &setGpuMemOffset, &pSetAllocHandle))
             {
                 // Allocation succeeded: Mark this
                 // Reallocate this descriptor set to use the allocated GPU range and layout
@@ -498,11 +503,12 @@ void DescriptorGpuMemHeap::SanityCheckDynamicAllocBlockList()
 // handle that can be used to free that memory for non-one-shot allocations.
 bool DescriptorGpuMemHeap::AllocSetGpuMem(
     const DescriptorSetLayout*  pLayout,
+    uint32_t                    variableDescriptorCount,
     Pal::gpusize*               pSetGpuMemOffset,
     void**                      pSetAllocHandle)
 {
     // Figure out the byte size and alignment
-    const uint32_t byteSize  = (pLayout->Info().sta.dwSize + pLayout->Info().fmask.dwSize) * sizeof(uint32_t);
+    const uint32_t byteSize  = pLayout->GetSetDwSize(variableDescriptorCount) * sizeof(uint32_t);
     const uint32_t alignment = m_gpuMemAddrAlignment;
 
     if (byteSize == 0)
@@ -1027,7 +1033,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorPool(
     if (descriptorPool != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         DescriptorPool::ObjectFromHandle(descriptorPool)->Destroy(pDevice, pAllocCB);
     }
@@ -1038,9 +1044,31 @@ VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets(
     const VkDescriptorSetAllocateInfo*          pAllocateInfo,
     VkDescriptorSet*                            pDescriptorSets)
 {
+    const uint32_t* pVariableDescriptorCounts = nullptr;
+
+    for (const VkStructHeader* pHeader = static_cast<const VkStructHeader*>(pAllocateInfo->pNext);
+         pHeader != nullptr;
+         pHeader = pHeader->pNext)
+    {
+        if (static_cast<uint32_t>(pHeader->sType) ==
+            static_cast<uint32_t>(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT))
+        {
+            const auto* pVariableCountInfo =
+                reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT*>(pHeader);
+
+            if (pVariableCountInfo->descriptorSetCount > 0)
+            {
+                VK_ASSERT(pVariableCountInfo->descriptorSetCount == pAllocateInfo->descriptorSetCount);
+
+                pVariableDescriptorCounts = pVariableCountInfo->pDescriptorCounts;
+            }
+        }
+    }
+
     return DescriptorPool::ObjectFromHandle(pAllocateInfo->descriptorPool)->AllocDescriptorSets(
         pAllocateInfo->descriptorSetCount,
         pAllocateInfo->pSetLayouts,
+        pVariableDescriptorCounts,
         pDescriptorSets);
 }
 
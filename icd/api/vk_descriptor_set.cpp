@@ -39,6 +39,13 @@
 #include "vk_conv.h"
 #include "vk_framebuffer.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define VK_DESCRIPTOR_STREAMING_STORES 1
+#else
+#define VK_DESCRIPTOR_STREAMING_STORES 0
+#endif
+
 namespace vk
 {
 
@@ -128,45 +135,59 @@ void DescriptorSet::Reassign(
 // Initialize immutable descriptor data in the descriptor set.
 void DescriptorSet::InitImmutableDescriptors(uint32_t numPalDevices)
 {
-    const size_t imageDescDwSize = m_pLayout->VkDevice()->GetProperties().descriptorSizes.imageView / sizeof(uint32_t);
-    const size_t samplerDescSize = m_pLayout->VkDevice()->GetProperties().descriptorSizes.sampler;
+    if (m_pLayout->Info().imm.numImmutableSamplers > 0)
+    {
+        for (uint32_t deviceIdx = 0; deviceIdx < numPalDevices; deviceIdx++)
+        {
+            WriteImmutableDescriptors(m_pLayout, m_pCpuAddress[deviceIdx]);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Copies the immutable sampler descriptors of the given layout to the CPU copy of a descriptor set.  This is used both
+// by descriptor sets allocated from a pool and by push descriptor sets streamed into command buffer memory.
+void DescriptorSet::WriteImmutableDescriptors(
+    const DescriptorSetLayout* pLayout,
+    uint32_t*                  pSetCpuAddr)
+{
+    const size_t imageDescDwSize = pLayout->VkDevice()->GetProperties().descriptorSizes.imageView / sizeof(uint32_t);
+    const size_t samplerDescSize = pLayout->VkDevice()->GetProperties().descriptorSizes.sampler;
 
-    uint32_t immutableSamplersLeft = m_pLayout->Info().imm.numImmutableSamplers;
+    uint32_t immutableSamplersLeft = pLayout->Info().imm.numImmutableSamplers;
     uint32_t binding = 0;
 
-    uint32_t* pSrcData  = m_pLayout->Info().imm.pImmutableSamplerData;
+    uint32_t* pSrcData  = pLayout->Info().imm.pImmutableSamplerData;
 
     while (immutableSamplersLeft > 0)
     {
-        const DescriptorSetLayout::BindingInfo& bindingInfo = m_pLayout->Info().bindings[binding];
+        const DescriptorSetLayout::BindingInfo& bindingInfo = pLayout->Info().bindings[binding];
         uint32_t desCount = bindingInfo.info.descriptorCount;
 
         if (bindingInfo.imm.dwSize > 0)
         {
-            for (uint32_t deviceIdx = 0; deviceIdx < numPalDevices; deviceIdx++)
+            if (bindingInfo.info.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER)
             {
-                if (bindingInfo.info.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER)
-                {
-                    // If it's a pure immutable sampler descriptor binding then we can copy all descriptors in one shot.
-                    memcpy(m_pCpuAddress[deviceIdx] + bindingInfo.sta.dwOffset,
-                           pSrcData  + bindingInfo.imm.dwOffset,
-                           bindingInfo.imm.dwSize * sizeof(uint32_t));
-                }
-                else
+                // If it's a pure immutable sampler descriptor binding then we can copy all descriptors in one shot.
+                memcpy(pSetCpuAddr + bindingInfo.sta.dwOffset,
+                       pSrcData  + bindingInfo.imm.dwOffset,
+                       bindingInfo.imm.dwSize * sizeof(uint32_t));
+            }
+            else
+            {
+                // Otherwise, if it's a combined image sampler descriptor with immutable sampler then we have to
+                // copy each element individually because the source and destination strides don't match.
+                VK_ASSERT(bindingInfo.info.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+                for (uint32_t i = 0; i < desCount; ++i)
                 {
-                    // Otherwise, if it's a combined image sampler descriptor with immutable sampler then we have to
-                    // copy each element individually because the source and destination strides don't match.
-                    VK_ASSERT(bindingInfo.info.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
-
-                    for (uint32_t i = 0; i < desCount; ++i)
-                    {
-                        memcpy(m_pCpuAddress[deviceIdx] + bindingInfo.sta.dwOffset +
-                                                                (i * bindingInfo.sta.dwArrayStride) + imageDescDwSize,
-                               pSrcData + bindingInfo.imm.dwOffset + (i * bindingInfo.imm.dwArrayStride),
-                               samplerDescSize);
-                    }
+                    memcpy(pSetCpuAddr + bindingInfo.sta.dwOffset + (i * bindingInfo.sta.dwArrayStride) +
+                                                                                    imageDescDwSize,
+                           pSrcData + bindingInfo.imm.dwOffset + (i * bindingInfo.imm.dwArrayStride),
+                           samplerDescSize);
                 }
             }
+
             // Update the remaining number of immutable samplers to copy.
             immutableSamplersLeft -= desCount;
         }
@@ -175,6 +196,110 @@ void DescriptorSet::InitImmutableDescriptors(uint32_t numPalDevices)
     }
 }
 
+// =====================================================================================================================
+// Copies dwCount dwords of descriptor data to descriptor memory.  Descriptor pools live in persistently mapped,
+// typically write-combined memory, so whole 16-byte chunks are written with non-temporal stores once the destination
+// is aligned.  This keeps the write-combine buffers filling completely instead of being flushed by partial writes and
+// avoids polluting the CPU caches with data the CPU never reads back.
+static void CopyToDescriptorMemory(
+    uint32_t*       pDestAddr,
+    const uint32_t* pSrcAddr,
+    uint32_t        dwCount)
+{
+#if VK_DESCRIPTOR_STREAMING_STORES
+    constexpr uint32_t ChunkDwSize = sizeof(__m128i) / sizeof(uint32_t);
+
+    // Write the head one dword at a time until the destination reaches chunk alignment.
+    while ((dwCount > 0) && (Util::IsPow2Aligned(reinterpret_cast<uintptr_t>(pDestAddr), sizeof(__m128i)) == false))
+    {
+        *pDestAddr++ = *pSrcAddr++;
+        dwCount--;
+    }
+
+    for (; dwCount >= ChunkDwSize; dwCount -= ChunkDwSize, pDestAddr += ChunkDwSize, pSrcAddr += ChunkDwSize)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(pDestAddr),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcAddr)));
+    }
+
+    if (dwCount > 0)
+    {
+        memcpy(pDestAddr, pSrcAddr, dwCount * sizeof(uint32_t));
+    }
+
+    // Non-temporal stores are weakly ordered; make them globally visible before the set can be submitted.
+    _mm_sfence();
+#else
+    memcpy(pDestAddr, pSrcAddr, dwCount * sizeof(uint32_t));
+#endif
+}
+
+// =====================================================================================================================
+// Gathers the descriptors of consecutive array elements in a cacheable staging buffer and streams them to descriptor
+// memory in large contiguous runs.  Elements whose descriptor does not cover the whole array stride (e.g. the image
+// part of a combined image-sampler with an immutable sampler) are written in place instead, so that the rest of the
+// stride is never overwritten.
+class DescriptorStreamWriter
+{
+public:
+    DescriptorStreamWriter(
+        uint32_t* pDestAddr,
+        uint32_t  dwStride,
+        size_t    descSize)
+        :
+        m_pDestAddr(pDestAddr),
+        m_dwStride(dwStride),
+        m_stagedDwCount(0),
+        m_direct((descSize != (dwStride * sizeof(uint32_t))) || (dwStride > StagingDwSize))
+    {
+    }
+
+    // Returns where the descriptor of the next array element is to be written.
+    VK_INLINE uint32_t* NextElement()
+    {
+        uint32_t* pElement;
+
+        if (m_direct)
+        {
+            pElement     = m_pDestAddr;
+            m_pDestAddr += m_dwStride;
+        }
+        else
+        {
+            if ((m_stagedDwCount + m_dwStride) > StagingDwSize)
+            {
+                Flush();
+            }
+
+            pElement         = &m_staging[m_stagedDwCount];
+            m_stagedDwCount += m_dwStride;
+        }
+
+        return pElement;
+    }
+
+    // Writes out any staged descriptors.  Must be called once the last element has been written.
+    VK_INLINE void Flush()
+    {
+        if (m_stagedDwCount > 0)
+        {
+            CopyToDescriptorMemory(m_pDestAddr, m_staging, m_stagedDwCount);
+
+            m_pDestAddr    += m_stagedDwCount;
+            m_stagedDwCount = 0;
+        }
+    }
+
+private:
+    static constexpr uint32_t StagingDwSize = 128;
+
+    alignas(16) uint32_t m_staging[StagingDwSize];
+    uint32_t*            m_pDestAddr;
+    const uint32_t       m_dwStride;
+    uint32_t             m_stagedDwCount;
+    const bool           m_direct;
+};
+
 // =====================================================================================================================
 // Write sampler descriptors
 VK_INLINE void DescriptorSet::WriteSamplerDescriptors(
@@ -190,14 +315,18 @@ VK_INLINE void DescriptorSet::WriteSamplerDescriptors(
                                                                                     sizeof(VkDescriptorImageInfo);
     const size_t                 samplerDescSize = deviceProperties.descriptorSizes.sampler;
 
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    DescriptorStreamWriter writer(pDestAddr, dwStride, samplerDescSize);
+
+    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem)
     {
         const void* pSamplerDesc = Sampler::ObjectFromHandle(pImageInfo->sampler)->Descriptor();
 
-        memcpy(pDestAddr, pSamplerDesc, samplerDescSize);
+        memcpy(writer.NextElement(), pSamplerDesc, samplerDescSize);
 
         pImageInfo = static_cast<const VkDescriptorImageInfo*>(Util::VoidPtrInc(pImageInfo, imageInfoStride));
     }
+
+    writer.Flush();
 }
 
 // =====================================================================================================================
@@ -217,17 +346,22 @@ VK_INLINE void DescriptorSet::WriteImageSamplerDescriptors(
     const size_t                 imageDescSize   = deviceProperties.descriptorSizes.imageView;
     const size_t                 samplerDescSize = deviceProperties.descriptorSizes.sampler;
 
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    DescriptorStreamWriter writer(pDestAddr, dwStride, imageDescSize + samplerDescSize);
+
+    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem)
     {
         const void* pImageDesc      = ImageView::ObjectFromHandle(pImageInfo->imageView)->
                                           Descriptor(pImageInfo->imageLayout, deviceIdx, imageDescSize);
         const void* pSamplerDesc    = Sampler::ObjectFromHandle(pImageInfo->sampler)->Descriptor();
+        uint32_t*   pElementAddr    = writer.NextElement();
 
-        memcpy(pDestAddr, pImageDesc, imageDescSize);
-        memcpy(pDestAddr + (imageDescSize / sizeof(uint32_t)), pSamplerDesc, samplerDescSize);
+        memcpy(pElementAddr, pImageDesc, imageDescSize);
+        memcpy(pElementAddr + (imageDescSize / sizeof(uint32_t)), pSamplerDesc, samplerDescSize);
 
         pImageInfo = static_cast<const VkDescriptorImageInfo*>(Util::VoidPtrInc(pImageInfo, imageInfoStride));
     }
+
+    writer.Flush();
 }
 
 // =====================================================================================================================
@@ -247,15 +381,21 @@ VK_INLINE void DescriptorSet::WriteImageDescriptors(
                                                                                   : sizeof(VkDescriptorImageInfo);
     const size_t                 imageDescSize   = deviceProperties.descriptorSizes.imageView;
 
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    // NOTE: With immutable samplers the stride of combined image-sampler bindings is larger than the image descriptor,
+    // in which case the writer stores each image in place and leaves the immutable sampler data untouched.
+    DescriptorStreamWriter writer(pDestAddr, dwStride, imageDescSize);
+
+    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem)
     {
         const void* pImageDesc = ImageView::ObjectFromHandle(pImageInfo->imageView)->
                                         Descriptor(pImageInfo->imageLayout, deviceIdx, imageDescSize);
 
-        memcpy(pDestAddr, pImageDesc, imageDescSize);
+        memcpy(writer.NextElement(), pImageDesc, imageDescSize);
 
         pImageInfo = static_cast<const VkDescriptorImageInfo*>(Util::VoidPtrInc(pImageInfo, imageInfoStride));
     }
+
+    writer.Flush();
 }
 
 // =====================================================================================================================
@@ -275,12 +415,16 @@ VK_INLINE void DescriptorSet::WriteFmaskDescriptors(
     const size_t                 imageDescSize   = pDevice->GetProperties().descriptorSizes.imageView;
     VK_ASSERT((pDevice->GetProperties().descriptorSizes.fmaskView / sizeof(uint32_t)) == dwStride);
 
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    DescriptorStreamWriter writer(pDestAddr, dwStride, dwStride * sizeof(uint32_t));
+
+    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem)
     {
         const ImageView* const pImageView = ImageView::ObjectFromHandle(pImageInfo->imageView);
         const void*            pImageDesc = pImageView->Descriptor(pImageInfo->imageLayout, deviceIdx, 0);
 
-        VK_ASSERT(FmaskBasedMsaaReadEnabled() == true);
+        uint32_t*              pElementAddr = writer.NextElement();
+
+        VK_ASSERT(pDevice->GetRuntimeSettings().enableFmaskBasedMsaaRead);
 
         if (pImageView->NeedsFmaskViewSrds())
         {
@@ -288,16 +432,18 @@ VK_INLINE void DescriptorSet::WriteFmaskDescriptors(
             // Image descriptors including shader read and write descriptors.
             const void* pSrcFmaskAddr = Util::VoidPtrInc(pImageDesc, imageDescSize * 2);
 
-            memcpy(pDestAddr, pSrcFmaskAddr, dwStride * sizeof(uint32_t));
+            memcpy(pElementAddr, pSrcFmaskAddr, dwStride * sizeof(uint32_t));
         }
         else
         {
             // If no FMASK descriptor, need clear the memory to 0.
-            memset(pDestAddr, 0, dwStride * sizeof(uint32_t));
+            memset(pElementAddr, 0, dwStride * sizeof(uint32_t));
         }
 
         pImageInfo = static_cast<const VkDescriptorImageInfo*>(Util::VoidPtrInc(pImageInfo, imageInfoStride));
     }
+
+    writer.Flush();
 }
 
 // =====================================================================================================================
@@ -317,14 +463,18 @@ VK_INLINE void DescriptorSet::WriteBufferDescriptors(
                                                                           : sizeof(VkBufferView);
     const size_t        bufferDescSize   = deviceProperties.descriptorSizes.bufferView;
 
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    DescriptorStreamWriter writer(pDestAddr, dwStride, bufferDescSize);
+
+    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem)
     {
         const void* pBufferDesc = BufferView::ObjectFromHandle(*pBufferView)->Descriptor(type, deviceIdx);
 
-        memcpy(pDestAddr, pBufferDesc, bufferDescSize);
+        memcpy(writer.NextElement(), pBufferDesc, bufferDescSize);
 
         pBufferView = static_cast<const VkBufferView*>(Util::VoidPtrInc(pBufferView, bufferViewStride));
     }
+
+    writer.Flush();
 }
 
 // =====================================================================================================================
@@ -362,33 +512,68 @@ VK_INLINE void DescriptorSet::WriteBufferInfoDescriptors(
 
     Pal::IDevice* pPalDevice = pDevice->PalDevice(deviceIdx);
 
-    // Build the SRD
-    for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
+    if ((pDevice->GetEnabledFeatures().robustBufferAccess == false) &&
+        ((type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)        ||
+         (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)))
     {
-        info.gpuAddr = Buffer::ObjectFromHandle(pBufferInfo->buffer)->GpuVirtAddr(deviceIdx) + pBufferInfo->offset;
-
-        if ((pDevice->GetEnabledFeatures().robustBufferAccess == false) &&
-            ((type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)        ||
-             (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)))
+        // Without robust buffer access only the base address of dynamic descriptors is stored, which needs no SRD.
+        for (uint32_t arrayElem = 0; arrayElem < count; ++arrayElem, pDestAddr += dwStride)
         {
-            pDestAddr[0] = Util::LowPart(info.gpuAddr);
-            pDestAddr[1] = Util::HighPart(info.gpuAddr);
+            const Pal::gpusize gpuAddr = Buffer::ObjectFromHandle(pBufferInfo->buffer)->GpuVirtAddr(deviceIdx) +
+                                         pBufferInfo->offset;
+
+            pDestAddr[0] = Util::LowPart(gpuAddr);
+            pDestAddr[1] = Util::HighPart(gpuAddr);
+
+            pBufferInfo = static_cast<const VkDescriptorBufferInfo*>(Util::VoidPtrInc(pBufferInfo, bufferInfoStride));
         }
-        else
+    }
+    else
+    {
+        // Gather the view infos of up to MaxBatchSize elements and build all of their SRDs with a single call into
+        // PAL instead of making one call per descriptor.
+        constexpr uint32_t MaxBatchSize = 32;
+        constexpr uint32_t SrdDwSize    = 4;
+
+        VK_ASSERT(pDevice->GetProperties().descriptorSizes.bufferView == (SrdDwSize * sizeof(uint32_t)));
+
+        Pal::BufferViewInfo  viewInfos[MaxBatchSize];
+        alignas(16) uint32_t srds[MaxBatchSize * SrdDwSize];
+
+        for (uint32_t batchStart = 0; batchStart < count; batchStart += MaxBatchSize)
         {
-            if (pBufferInfo->range == VK_WHOLE_SIZE)
+            const uint32_t batchSize = Util::Min(count - batchStart, MaxBatchSize);
+
+            for (uint32_t i = 0; i < batchSize; ++i)
             {
-                info.range = reinterpret_cast<Buffer*>(pBufferInfo->buffer)->GetSize() - pBufferInfo->offset;
+                const Buffer* pBuffer = Buffer::ObjectFromHandle(pBufferInfo->buffer);
+
+                viewInfos[i]         = info;
+                viewInfos[i].gpuAddr = pBuffer->GpuVirtAddr(deviceIdx) + pBufferInfo->offset;
+                viewInfos[i].range   = (pBufferInfo->range == VK_WHOLE_SIZE) ?
+                                       (pBuffer->GetSize() - pBufferInfo->offset) : pBufferInfo->range;
+
+                pBufferInfo = static_cast<const VkDescriptorBufferInfo*>(
+                    Util::VoidPtrInc(pBufferInfo, bufferInfoStride));
+            }
+
+            pPalDevice->CreateUntypedBufferViewSrds(batchSize, viewInfos, srds);
+
+            if (dwStride == SrdDwSize)
+            {
+                // The SRDs are tightly packed in the set as well so the whole batch can be written in one go.
+                CopyToDescriptorMemory(pDestAddr, srds, batchSize * SrdDwSize);
             }
             else
             {
-                info.range = pBufferInfo->range;
+                for (uint32_t i = 0; i < batchSize; ++i)
+                {
+                    memcpy(pDestAddr + (i * dwStride), &srds[i * SrdDwSize], SrdDwSize * sizeof(uint32_t));
+                }
             }
 
-            pPalDevice->CreateUntypedBufferViewSrds(1, &info, pDestAddr);
+            pDestAddr += batchSize * dwStride;
         }
-
-        pBufferInfo = static_cast<const VkDescriptorBufferInfo*>(Util::VoidPtrInc(pBufferInfo, bufferInfoStride));
     }
 }
 
@@ -412,81 +597,71 @@ void DescriptorSet::WriteDescriptorSets(
         VK_ASSERT(params.sType == VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET);
         VK_ASSERT(params.pNext == nullptr);
 
-        DescriptorSet* pDestSet  = DescriptorSet::ObjectFromHandle(params.dstSet);
-        const DescriptorSetLayout::BindingInfo& destBinding = pDestSet->Layout()->Binding(params.dstBinding);
-        uint32_t* pDestAddr = pDestSet->CpuAddress(deviceIdx) + destBinding.sta.dwOffset
-                            + (params.dstArrayElement * destBinding.sta.dwArrayStride);
-
-        uint32_t* pDestFmaskAddr = pDestSet->CpuAddress(deviceIdx) + pDestSet->Layout()->Info().sta.dwSize
-                                 + destBinding.fmask.dwOffset + (params.dstArrayElement * destBinding.fmask.dwArrayStride);
+        DescriptorSet* pDestSet = DescriptorSet::ObjectFromHandle(params.dstSet);
 
-        // Determine whether the binding has immutable sampler descriptors.
-        bool hasImmutableSampler = (destBinding.imm.dwSize != 0);
+        // The client memory copy of inline descriptors is shared by all devices so only keep the first one.
+        WriteDescriptors(pDevice,
+                         deviceIdx,
+                         deviceProperties,
+                         pDestSet->Layout(),
+                         pDestSet->CpuAddress(deviceIdx),
+                         (deviceIdx == DefaultDeviceIndex) ? pDestSet->InlineDescriptorData() : nullptr,
+                         pDestSet->DynamicDescriptorData(),
+                         params,
+                         descriptorStrideInBytes);
+    }
+}
 
-        switch (params.descriptorType)
-        {
-        case VK_DESCRIPTOR_TYPE_SAMPLER:
-            if (hasImmutableSampler)
-            {
-                VK_ASSERT(!"Immutable samplers cannot be updated");
-            }
-            else
-            {
-                pDestSet->WriteSamplerDescriptors(
-                    deviceProperties,
-                    params.pImageInfo,
-                    pDestAddr,
-                    params.descriptorCount,
-                    destBinding.sta.dwArrayStride,
-                    descriptorStrideInBytes);
-            }
-            break;
+// =====================================================================================================================
+// Applies a single descriptor write to the CPU copy of a descriptor set with the given layout.  pSetCpuAddr points to
+// the start of the set's static section (followed by its fmask section).  pInlineData and pDynamicData receive the
+// client memory copies of inline and dynamic buffer descriptors; pInlineData may be null if no copy is required.
+void DescriptorSet::WriteDescriptors(
+    const Device*                pDevice,
+    uint32_t                     deviceIdx,
+    const Device::Properties&    deviceProperties,
+    const DescriptorSetLayout*   pLayout,
+    uint32_t*                    pSetCpuAddr,
+    uint32_t*                    pInlineData,
+    uint32_t*                    pDynamicData,
+    const VkWriteDescriptorSet&  params,
+    size_t                       descriptorStrideInBytes)
+{
+    const DescriptorSetLayout::BindingInfo& destBinding = pLayout->Binding(params.dstBinding);
+    uint32_t* pDestAddr = pSetCpuAddr + destBinding.sta.dwOffset
+                        + (params.dstArrayElement * destBinding.sta.dwArrayStride);
 
-        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-            if (hasImmutableSampler)
-            {
-                // If the sampler part of the combined image sampler is immutable then we should only update the image
-                // descriptors, but have to make sure to still use the appropriate stride.
-                pDestSet->WriteImageDescriptors(
-                    params.descriptorType,
-                    deviceProperties,
-                    params.pImageInfo,
-                    deviceIdx,
-                    pDestAddr,
-                    params.descriptorCount,
-                    destBinding.sta.dwArrayStride,
-                    descriptorStrideInBytes);
-            }
-            else
-            {
-                pDestSet->WriteImageSamplerDescriptors(
-                    deviceProperties,
-                    params.pImageInfo,
-                    deviceIdx,
-                    pDestAddr,
-                    params.descriptorCount,
-                    destBinding.sta.dwArrayStride,
-                    descriptorStrideInBytes);
-            }
+    uint32_t* pDestFmaskAddr = pSetCpuAddr + pLayout->Info().sta.dwSize
+                             + destBinding.fmask.dwOffset + (params.dstArrayElement * destBinding.fmask.dwArrayStride);
 
-            if (pDestSet->FmaskBasedMsaaReadEnabled() && (destBinding.fmask.dwSize > 0))
-            {
-                pDestSet->WriteFmaskDescriptors(
-                    pDevice,
-                    params.pImageInfo,
-                    deviceIdx,
-                    pDestFmaskAddr,
-                    params.descriptorCount,
-                    destBinding.fmask.dwArrayStride,
-                    descriptorStrideInBytes);
-            }
+    // Determine whether the binding has immutable sampler descriptors.
+    bool hasImmutableSampler = (destBinding.imm.dwSize != 0);
 
-            break;
+    switch (params.descriptorType)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        if (hasImmutableSampler)
+        {
+            VK_ASSERT(!"Immutable samplers cannot be updated");
+        }
+        else
+        {
+            WriteSamplerDescriptors(
+                deviceProperties,
+                params.pImageInfo,
+                pDestAddr,
+                params.descriptorCount,
+                destBinding.sta.dwArrayStride,
+                descriptorStrideInBytes);
+        }
+        break;
 
-        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-            pDestSet->WriteImageDescriptors(
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        if (hasImmutableSampler)
+        {
+            // If the sampler part of the combined image sampler is immutable then we should only update the image
+            // descriptors, but have to make sure to still use the appropriate stride.
+            WriteImageDescriptors(
                 params.descriptorType,
                 deviceProperties,
                 params.pImageInfo,
@@ -495,72 +670,129 @@ void DescriptorSet::WriteDescriptorSets(
                 params.descriptorCount,
                 destBinding.sta.dwArrayStride,
                 descriptorStrideInBytes);
-
-            if (pDestSet->FmaskBasedMsaaReadEnabled() && (destBinding.fmask.dwSize > 0))
-            {
-                pDestSet->WriteFmaskDescriptors(
-                    pDevice,
-                    params.pImageInfo,
-                    deviceIdx,
-                    pDestFmaskAddr,
-                    params.descriptorCount,
-                    destBinding.fmask.dwArrayStride,
-                    descriptorStrideInBytes);
-            }
-            break;
-
-        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-            pDestSet->WriteBufferDescriptors(
+        }
+        else
+        {
+            WriteImageSamplerDescriptors(
                 deviceProperties,
-                params.descriptorType,
-                params.pTexelBufferView,
+                params.pImageInfo,
                 deviceIdx,
                 pDestAddr,
                 params.descriptorCount,
                 destBinding.sta.dwArrayStride,
                 descriptorStrideInBytes);
+        }
 
-            break;
+        if (destBinding.fmask.dwSize > 0)
+        {
+            WriteFmaskDescriptors(
+                pDevice,
+                params.pImageInfo,
+                deviceIdx,
+                pDestFmaskAddr,
+                params.descriptorCount,
+                destBinding.fmask.dwArrayStride,
+                descriptorStrideInBytes);
+        }
 
-        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-            pDestSet->WriteBufferInfoDescriptors(
+        break;
+
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        WriteImageDescriptors(
+            params.descriptorType,
+            deviceProperties,
+            params.pImageInfo,
+            deviceIdx,
+            pDestAddr,
+            params.descriptorCount,
+            destBinding.sta.dwArrayStride,
+            descriptorStrideInBytes);
+
+        if (destBinding.fmask.dwSize > 0)
+        {
+            WriteFmaskDescriptors(
                 pDevice,
-                params.descriptorType,
-                params.pBufferInfo,
+                params.pImageInfo,
                 deviceIdx,
-                pDestAddr,
+                pDestFmaskAddr,
                 params.descriptorCount,
-                destBinding.sta.dwArrayStride,
+                destBinding.fmask.dwArrayStride,
                 descriptorStrideInBytes);
+        }
+        break;
 
-            break;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        WriteBufferDescriptors(
+            deviceProperties,
+            params.descriptorType,
+            params.pTexelBufferView,
+            deviceIdx,
+            pDestAddr,
+            params.descriptorCount,
+            destBinding.sta.dwArrayStride,
+            descriptorStrideInBytes);
 
-        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-            // We need to treat dynamic buffer descriptors specially as we store the base buffer SRDs in
-            // client memory.
-            // NOTE: Nuke this once we have proper support for dynamic descriptors in SC.
-            pDestAddr = pDestSet->DynamicDescriptorData() + destBinding.dyn.dwOffset
-                      + params.dstArrayElement * destBinding.dyn.dwArrayStride;
+        break;
+
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        WriteBufferInfoDescriptors(
+            pDevice,
+            params.descriptorType,
+            params.pBufferInfo,
+            deviceIdx,
+            pDestAddr,
+            params.descriptorCount,
+            destBinding.sta.dwArrayStride,
+            descriptorStrideInBytes);
+
+        // If the binding may be placed inline in user data then also keep a copy of the SRD in client memory so
+        // that it can be supplied directly in user data registers at bind time.
+        if ((destBinding.inl.dwSize > 0) && (pInlineData != nullptr))
+        {
+            VK_ASSERT((params.dstArrayElement == 0) && (params.descriptorCount == 1));
 
-            pDestSet->WriteBufferInfoDescriptors(
+            WriteBufferInfoDescriptors(
                 pDevice,
                 params.descriptorType,
                 params.pBufferInfo,
                 deviceIdx,
-                pDestAddr,
-                params.descriptorCount,
-                destBinding.dyn.dwArrayStride,
+                pInlineData + destBinding.inl.dwOffset,
+                1,
+                destBinding.inl.dwArrayStride,
                 descriptorStrideInBytes);
+        }
 
-            break;
+        break;
 
-        default:
-            VK_ASSERT(!"Unexpected descriptor type");
-            break;
-        }
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        // We need to treat dynamic buffer descriptors specially as we store the base buffer SRDs in
+        // client memory.
+        // NOTE: Nuke this once we have proper support for dynamic descriptors in SC.
+        VK_ASSERT(pDynamicData != nullptr);
+
+        pDestAddr = pDynamicData + destBinding.dyn.dwOffset
+                  + params.dstArrayElement * destBinding.dyn.dwArrayStride;
+
+        WriteBufferInfoDescriptors(
+            pDevice,
+            params.descriptorType,
+            params.pBufferInfo,
+            deviceIdx,
+            pDestAddr,
+            params.descriptorCount,
+            destBinding.dyn.dwArrayStride,
+            descriptorStrideInBytes);
+
+        break;
+
+    default:
+        VK_ASSERT(!"Unexpected descriptor type");
+        break;
     }
 }
 
@@ -644,8 +876,8 @@ void DescriptorSet::CopyDescriptorSets(
             }
             else
             {
-                // Just to a straight memcpy covering the entire range.
-                memcpy(pDestAddr, pSrcAddr, srcBinding.sta.dwArrayStride * sizeof(uint32_t) * count);
+                // Just stream a straight copy covering the entire range.
+                CopyToDescriptorMemory(pDestAddr, pSrcAddr, srcBinding.sta.dwArrayStride * count);
             }
 
             if (pSrcSet->FmaskBasedMsaaReadEnabled() && srcBinding.fmask.dwSize > 0)
@@ -659,7 +891,17 @@ void DescriptorSet::CopyDescriptorSets(
                 VK_ASSERT(srcBinding.fmask.dwArrayStride == destBinding.fmask.dwArrayStride);
 
                 // Copy fmask descriptors covering the entire range
-                memcpy(pDestFmaskAddr, pSrcFmaskAddr, srcBinding.fmask.dwArrayStride * sizeof(uint32_t) * count);
+                CopyToDescriptorMemory(pDestFmaskAddr, pSrcFmaskAddr, srcBinding.fmask.dwArrayStride * count);
+            }
+
+            if (destBinding.inl.dwSize > 0)
+            {
+                // Copy the client memory copy of descriptors that may be placed inline in user data.
+                VK_ASSERT(srcBinding.inl.dwSize == destBinding.inl.dwSize);
+
+                memcpy(pDestSet->InlineDescriptorData() + destBinding.inl.dwOffset,
+                       pSrcSet->InlineDescriptorData() + srcBinding.inl.dwOffset,
+                       destBinding.inl.dwSize * sizeof(uint32_t));
             }
         }
     }
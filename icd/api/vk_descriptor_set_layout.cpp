@@ -162,6 +162,28 @@ uint32_t DescriptorSetLayout::GetDescDynamicSectionDwSize(const Device* pDevice,
     return size;
 }
 
+// =====================================================================================================================
+// Returns the dword size required in the inline section for a particular binding.  Only bindings of a single uniform
+// or storage buffer descriptor are eligible to be placed inline in user data.
+uint32_t DescriptorSetLayout::GetDescInlineSectionDwSize(
+    const Device*                       pDevice,
+    const VkDescriptorSetLayoutBinding* pBindingInfo)
+{
+    uint32_t size = 0;
+
+    if (pDevice->GetRuntimeSettings().enableDescriptorPromotion &&
+        (pBindingInfo->descriptorCount == 1) &&
+        ((pBindingInfo->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) ||
+         (pBindingInfo->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)))
+    {
+        size = pDevice->GetProperties().descriptorSizes.bufferView;
+    }
+
+    VK_ASSERT(Util::IsPow2Aligned(size, sizeof(uint32_t)));
+
+    return size / sizeof(uint32_t);
+}
+
 // =====================================================================================================================
 // Returns the dword size required in the immutable section for a particular type of descriptor.
 uint32_t DescriptorSetLayout::GetDescImmutableSectionDwSize(const Device* pDevice, VkDescriptorType type)
@@ -310,6 +332,29 @@ VkResult DescriptorSetLayout::ConvertCreateInfo(
     pOut->fmask.dwSize              = 0;
     pOut->fmask.numPalRsrcMapNodes  = 0;
 
+    pOut->inl.dwSize                = 0;
+    pOut->inl.numPalRsrcMapNodes    = 0;
+
+    pOut->flags                     = pIn->flags;
+    pOut->varDescBinding            = pOut->count;
+
+    // The binding flags are indexed in the same order as the bindings of the core structure, which may come before
+    // them in the chain, so look them up first.
+    const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* pBindingFlags = nullptr;
+
+    for (pInfo = pIn; pHeader != nullptr; pHeader = pHeader->pNext)
+    {
+        if (static_cast<uint32_t>(pHeader->sType) ==
+            static_cast<uint32_t>(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT))
+        {
+            pBindingFlags = reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT*>(pHeader);
+        }
+    }
+
+    // Inline descriptors are copied into user data when the set is bound, so later updates would not be visible to
+    // the GPU.  Keep all descriptors of update-after-bind layouts in descriptor set memory instead.
+    const bool allowInline = ((pIn->flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT) == 0);
+
     for (pInfo = pIn; pHeader != nullptr; pHeader = pHeader->pNext)
     {
         switch (pHeader->sType)
@@ -325,6 +370,23 @@ VkResult DescriptorSetLayout::ConvertCreateInfo(
                 {
                     const VkDescriptorSetLayoutBinding & currentBinding = pInfo->pBindings[inIndex];
                     pOut->bindings[currentBinding.binding].info = currentBinding;
+
+                    if ((pBindingFlags != nullptr) && (pBindingFlags->bindingCount > 0))
+                    {
+                        VK_ASSERT(pBindingFlags->bindingCount == pInfo->bindingCount);
+
+                        const VkDescriptorBindingFlagsEXT flags = pBindingFlags->pBindingFlags[inIndex];
+
+                        pOut->bindings[currentBinding.binding].flags = flags;
+
+                        if ((flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT) != 0)
+                        {
+                            // Only the binding with the largest binding number may have a variable size.
+                            VK_ASSERT(currentBinding.binding == (pOut->count - 1));
+
+                            pOut->varDescBinding = currentBinding.binding;
+                        }
+                    }
                 }
 
                 // Now iterate over our output array to convert the binding info.  Any gaps in
@@ -374,12 +436,32 @@ VkResult DescriptorSetLayout::ConvertCreateInfo(
                             true);
                     }
 
+                    // Construct the information specific to the inline section of the descriptor set layout as long as
+                    // there is room left for another inline descriptor.
+                    const uint32_t inlDwSize = GetDescInlineSectionDwSize(pDevice, &pBinding->info);
+
+                    if (allowInline && (pOut->inl.numPalRsrcMapNodes < MaxInlineDescriptors))
+                    {
+                        ConvertBindingInfo(
+                            &pBinding->info,
+                            inlDwSize,
+                            1,
+                            &pOut->inl,
+                            &pBinding->inl,
+                            false);
+                    }
+
                     if ((pBinding->info.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) ||
                         (pBinding->info.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC))
                     {
                         pOut->numDynamicDescriptors += pBinding->info.descriptorCount;
                     }
                 }
+
+                // Push descriptor set layouts are streamed into command buffer memory at push time and never have
+                // dynamic descriptors.
+                VK_ASSERT(((pInfo->flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR) == 0) ||
+                          (pOut->numDynamicDescriptors == 0));
             }
             break;
 
@@ -394,6 +476,32 @@ VkResult DescriptorSetLayout::ConvertCreateInfo(
     return VK_SUCCESS;
 }
 
+// =====================================================================================================================
+// Returns the size in dwords of the GPU memory of a descriptor set allocated with this layout, given the actual number
+// of descriptors in its variable-sized binding (ignored if the layout has none).
+uint32_t DescriptorSetLayout::GetSetDwSize(
+    uint32_t variableDescriptorCount
+    ) const
+{
+    uint32_t dwSize = m_info.sta.dwSize + m_info.fmask.dwSize;
+
+    // The variable-sized binding is the last one of the static section, so its unused tail can be trimmed unless the
+    // fmask section is placed after it or immutable samplers are copied into the whole binding.
+    if ((m_info.varDescBinding < m_info.count) && (m_info.fmask.dwSize == 0))
+    {
+        const BindingInfo& binding = m_info.bindings[m_info.varDescBinding];
+
+        VK_ASSERT(variableDescriptorCount <= binding.info.descriptorCount);
+
+        if (binding.imm.dwSize == 0)
+        {
+            dwSize -= (binding.info.descriptorCount - variableDescriptorCount) * binding.sta.dwArrayStride;
+        }
+    }
+
+    return dwSize;
+}
+
 // =====================================================================================================================
 // Creates a descriptor set layout object.
 VkResult DescriptorSetLayout::Create(
@@ -493,7 +601,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorSetLayout(
     if (descriptorSetLayout != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         DescriptorSetLayout::ObjectFromHandle(descriptorSetLayout)->Destroy(pDevice, pAllocCB);
     }
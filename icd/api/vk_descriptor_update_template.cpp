@@ -60,16 +60,19 @@ VkResult DescriptorUpdateTemplate::Create(
 
     if (result == VK_SUCCESS)
     {
-        // It's safe to ignore pCreateInfo.pipelineBindPoint, pCreateInfo.pipelineLayout, and pCreateInfo.set because
-        // we don't support VK_KHR_push_descriptors.
-        VK_ASSERT(pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR);
+        // The pipeline layout and set number of push descriptor templates are ignored because the same information
+        // is also supplied to vkCmdPushDescriptorSetWithTemplateKHR.
+        VK_ASSERT((pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR) ||
+                  (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR));
 
         VkDescriptorUpdateTemplateEntryKHR* pEntries = static_cast<VkDescriptorUpdateTemplateEntryKHR*>(
                                                             Util::VoidPtrInc(pSysMem, apiSize));
 
         memcpy(pEntries, pCreateInfo->pDescriptorUpdateEntries, entriesSize);
 
-        VK_PLACEMENT_NEW(pSysMem) DescriptorUpdateTemplate(pEntries, pCreateInfo->descriptorUpdateEntryCount);
+        VK_PLACEMENT_NEW(pSysMem) DescriptorUpdateTemplate(pEntries,
+                                                           pCreateInfo->descriptorUpdateEntryCount,
+                                                           pCreateInfo->pipelineBindPoint);
 
         *pDescriptorUpdateTemplate = DescriptorUpdateTemplate::HandleFromVoidPointer(pSysMem);
     }
@@ -80,10 +83,12 @@ VkResult DescriptorUpdateTemplate::Create(
 // =====================================================================================================================
 DescriptorUpdateTemplate::DescriptorUpdateTemplate(
     const VkDescriptorUpdateTemplateEntryKHR* pEntries,
-    uint32_t                                  numEntries)
+    uint32_t                                  numEntries,
+    VkPipelineBindPoint                       pipelineBindPoint)
     :
     m_pEntries(pEntries),
-    m_numEntries(numEntries)
+    m_numEntries(numEntries),
+    m_pipelineBindPoint(pipelineBindPoint)
 {
 }
 
@@ -104,6 +109,32 @@ VkResult DescriptorUpdateTemplate::Destroy(
     return VK_SUCCESS;
 }
 
+// =====================================================================================================================
+// Builds the descriptor write structure for the given template entry to share the write code path with
+// vkUpdateDescriptorSets.
+void DescriptorUpdateTemplate::GetDescriptorWrite(
+    uint32_t              entryIdx,
+    VkDescriptorSet       descriptorSet,
+    const void*           pData,
+    VkWriteDescriptorSet* pDescriptorWrite
+    ) const
+{
+    const VkDescriptorUpdateTemplateEntryKHR& entry           = m_pEntries[entryIdx];
+    const void*                               pDescriptorInfo = Util::VoidPtrInc(pData, entry.offset);
+
+    pDescriptorWrite->sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    pDescriptorWrite->pNext            = nullptr;
+    pDescriptorWrite->dstSet           = descriptorSet;
+    pDescriptorWrite->dstBinding       = entry.dstBinding;
+    pDescriptorWrite->dstArrayElement  = entry.dstArrayElement;
+    pDescriptorWrite->descriptorCount  = entry.descriptorCount;
+    pDescriptorWrite->descriptorType   = entry.descriptorType;
+    // Decide which descriptor info is relevant later using descriptorType.
+    pDescriptorWrite->pImageInfo       = static_cast<const VkDescriptorImageInfo*>(pDescriptorInfo);
+    pDescriptorWrite->pBufferInfo      = static_cast<const VkDescriptorBufferInfo*>(pDescriptorInfo);
+    pDescriptorWrite->pTexelBufferView = static_cast<const VkBufferView*>(pDescriptorInfo);
+}
+
 // =====================================================================================================================
 void DescriptorUpdateTemplate::Update(
     Device*         pDevice,
@@ -113,25 +144,11 @@ void DescriptorUpdateTemplate::Update(
 {
     const Device::Properties& deviceProperties = pDevice->GetProperties();
 
-    // Use descriptor write structure as params to share write code path with vkUpdateDescriptorSets.
     VkWriteDescriptorSet descriptorWrite;
 
-    descriptorWrite.sType  = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.pNext  = nullptr;
-    descriptorWrite.dstSet = descriptorSet;
-
     for (uint32_t i = 0; i < m_numEntries; ++i)
     {
-        const void* pDescriptorInfo = Util::VoidPtrInc(pData, m_pEntries[i].offset);
-
-        descriptorWrite.dstBinding       = m_pEntries[i].dstBinding;
-        descriptorWrite.dstArrayElement  = m_pEntries[i].dstArrayElement;
-        descriptorWrite.descriptorCount  = m_pEntries[i].descriptorCount;
-        descriptorWrite.descriptorType   = m_pEntries[i].descriptorType;
-        // Decide which descriptor info is relevant later using descriptorType.
-        descriptorWrite.pImageInfo       = static_cast<const VkDescriptorImageInfo*>(pDescriptorInfo);
-        descriptorWrite.pBufferInfo      = static_cast<const VkDescriptorBufferInfo*>(pDescriptorInfo);
-        descriptorWrite.pTexelBufferView = static_cast<const VkBufferView*>(pDescriptorInfo);
+        GetDescriptorWrite(i, descriptorSet, pData, &descriptorWrite);
 
         DescriptorSet::WriteDescriptorSets(pDevice,
                                            deviceIdx,
@@ -142,6 +159,37 @@ void DescriptorUpdateTemplate::Update(
     }
 }
 
+// =====================================================================================================================
+// Writes the descriptors described by this template to the CPU copy of a push descriptor set with the given layout.
+void DescriptorUpdateTemplate::PushUpdate(
+    const Device*              pDevice,
+    uint32_t                   deviceIdx,
+    const DescriptorSetLayout* pLayout,
+    uint32_t*                  pSetCpuAddr,
+    uint32_t*                  pInlineData,
+    const void*                pData
+    ) const
+{
+    const Device::Properties& deviceProperties = pDevice->GetProperties();
+
+    VkWriteDescriptorSet descriptorWrite;
+
+    for (uint32_t i = 0; i < m_numEntries; ++i)
+    {
+        GetDescriptorWrite(i, VK_NULL_HANDLE, pData, &descriptorWrite);
+
+        DescriptorSet::WriteDescriptors(pDevice,
+                                        deviceIdx,
+                                        deviceProperties,
+                                        pLayout,
+                                        pSetCpuAddr,
+                                        pInlineData,
+                                        nullptr,
+                                        descriptorWrite,
+                                        m_pEntries[i].stride);
+    }
+}
+
 namespace entry
 {
 
@@ -154,7 +202,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorUpdateTemplateKHR(
     if (descriptorUpdateTemplate != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         DescriptorUpdateTemplate::ObjectFromHandle(descriptorUpdateTemplate)->Destroy(pDevice, pAllocCB);
     }
@@ -63,6 +63,8 @@
 
 #include "sqtt/sqtt_mgr.h"
 
+#include "timing/timing_mgr.h"
+
 #if ICD_GPUOPEN_DEVMODE_BUILD
 #include "devmode/devmode_mgr.h"
 #endif
@@ -179,10 +181,19 @@ Device::Device(
     m_shaderOptimizer(this, pPhysicalDevices[DefaultDeviceIndex]),
 #endif
     m_renderStateCache(this),
+    m_renderPassExecuteCache(this),
+    m_slabAllocator(pPhysicalDevices[DefaultDeviceIndex]->VkInstance()->GetAllocCallbacks()),
+    m_pAllocCallbacks(pPhysicalDevices[DefaultDeviceIndex]->VkInstance()->GetAllocCallbacks()),
     m_pStackAllocator(nullptr),
     m_enabledExtensions(enabledExtensions),
     m_pSqttMgr(nullptr),
-    m_pipelineCacheCount(0)
+    m_pApiTimingMgr(nullptr),
+    m_timelineProgress(0),
+    m_pipelineCacheCount(0),
+    m_eventRecycleBarrierCount(0),
+    m_eventRecycleBarrierAvoidedCount(0),
+    m_mergedBarrierApiCount(0),
+    m_mergedBarrierPalCount(0)
 {
     memcpy(m_pPhysicalDevices, pPhysicalDevices, sizeof(pPhysicalDevices[DefaultDeviceIndex]) * palDeviceCount);
     memcpy(m_pPalDevices, pPalDevices, sizeof(pPalDevices[0]) * palDeviceCount);
@@ -275,6 +286,7 @@ VkResult Device::Create(
     PhysicalDevice* pPhysicalDevices[MaxPalDevices] = { pPhysicalDevice              };
     Pal::IDevice*   pPalDevices[MaxPalDevices]      = { pPhysicalDevice->PalDevice() };
     Instance*       pInstance                       = pPhysicalDevice->VkInstance();
+    bool            timelineSemaphores              = false;
 
     for (pDeviceCreateInfo = pCreateInfo; pHeader != nullptr; pHeader = pHeader->pNext)
     {
@@ -302,7 +314,16 @@ VkResult Device::Create(
             }
             break;
         }
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR:
+        {
+            const auto* pFeatures = reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeaturesKHR*>(pHeader);
+
+            timelineSemaphores = (pFeatures->timelineSemaphore == VK_TRUE);
+            break;
+        }
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GPA_FEATURES_AMD:
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
         {
             // Nothing to be done here
             break;
@@ -312,6 +333,13 @@ VkResult Device::Create(
         }
     }
 
+    // Timeline semaphore signal points only exist on the default device, so queue operations on the other devices of a
+    // group could not wait on or signal them.
+    if (timelineSemaphores && (numDevices > 1))
+    {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
     uint32_t totalQueues = 0;
 
     for (pDeviceCreateInfo = pCreateInfo; pHeader != nullptr; pHeader = pHeader->pNext)
@@ -501,6 +529,13 @@ VkResult Device::Create(
                         pQueues[queueFamilyIndex][queueIndex] = &pDeviceAndQueues->queue[initializedQueues];
 
                         initializedQueues++;
+
+                        palResult = (*pQueues[queueFamilyIndex][queueIndex])->Init();
+
+                        if (palResult != Pal::Result::Success)
+                        {
+                            goto queue_fail;
+                        }
                     }
                 }
 queue_fail:
@@ -564,6 +599,24 @@ VkResult Device::Initialize(
         result = m_renderStateCache.Init();
     }
 
+    // Initialize the render pass execute info cache
+    if (result == VK_SUCCESS)
+    {
+        result = m_renderPassExecuteCache.Init();
+    }
+
+    // API objects are placed in slabs only when the application relies on the driver's default allocator.  A
+    // failure to reserve the arena is not fatal; objects then simply keep using the instance callbacks.
+    if ((result == VK_SUCCESS) &&
+        m_settings.enableApiObjectSlabAllocator &&
+        (VkInstance()->GetAllocCallbacks()->pfnAllocation == allocator::g_DefaultAllocCallback.pfnAllocation))
+    {
+        if (m_slabAllocator.Init(static_cast<size_t>(m_settings.apiObjectSlabArenaSizeMb) * 1024 * 1024) == VK_SUCCESS)
+        {
+            m_pAllocCallbacks = m_slabAllocator.GetCallbacks();
+        }
+    }
+
     if (result == VK_SUCCESS)
     {
         if (m_settings.useSharedCmdAllocator)
@@ -703,6 +756,22 @@ VkResult Device::Initialize(
         }
     }
 
+    if ((result == VK_SUCCESS) && VkInstance()->IsApiTimingSupportEnabled())
+    {
+        void* pTimingStorage = VkInstance()->AllocMem(sizeof(ApiTimingMgr), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+
+        if (pTimingStorage != nullptr)
+        {
+            m_pApiTimingMgr = VK_PLACEMENT_NEW(pTimingStorage) ApiTimingMgr(this);
+
+            result = PalToVkResult(m_pApiTimingMgr->Init());
+        }
+        else
+        {
+            result = VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+
     if (result == VK_SUCCESS)
     {
         result = PalToVkResult(m_memoryMutex.Init());
@@ -713,6 +782,16 @@ VkResult Device::Initialize(
         result = PalToVkResult(m_timerQueueMutex.Init());
     }
 
+    if (result == VK_SUCCESS)
+    {
+        result = PalToVkResult(m_timelineMutex.Init());
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = PalToVkResult(m_timelineCondition.Init());
+    }
+
 #if ICD_GPUOPEN_DEVMODE_BUILD
     if ((result == VK_SUCCESS) && (VkInstance()->GetDevModeMgr() != nullptr))
     {
@@ -917,6 +996,13 @@ VkResult Device::Destroy(const VkAllocationCallbacks* pAllocator)
         VkInstance()->FreeMem(m_pSqttMgr);
     }
 
+    if (m_pApiTimingMgr != nullptr)
+    {
+        Util::Destructor(m_pApiTimingMgr);
+
+        VkInstance()->FreeMem(m_pApiTimingMgr);
+    }
+
     for (uint32_t i = 0; i < Queue::MaxQueueFamilies; ++i)
     {
         for (uint32_t j = 0; (j < Queue::MaxQueuesPerFamily) && (m_pQueues[i][j] != nullptr); ++j)
@@ -963,6 +1049,17 @@ VkResult Device::Destroy(const VkAllocationCallbacks* pAllocator)
 
     m_renderStateCache.Destroy();
 
+    m_renderPassExecuteCache.Destroy();
+
+    if (m_slabAllocator.IsInitialized())
+    {
+#if PAL_ENABLE_PRINTS_ASSERTS
+        m_slabAllocator.LogStats();
+#endif
+
+        m_slabAllocator.Destroy();
+    }
+
     Util::Destructor(this);
 
     VkInstance()->FreeMem(ApiDevice::FromObject(this));
@@ -1171,6 +1268,79 @@ VkResult Device::WaitIdle(void)
     return VK_SUCCESS;
 }
 
+// =====================================================================================================================
+// Returns the number of queues created with the device.
+uint32_t Device::GetQueueCount() const
+{
+    uint32_t queueCount = 0;
+
+    for (uint32_t i = 0; i < Queue::MaxQueueFamilies; ++i)
+    {
+        for (uint32_t j = 0; (j < Queue::MaxQueuesPerFamily) && (m_pQueues[i][j] != nullptr); ++j)
+        {
+            ++queueCount;
+        }
+    }
+
+    return queueCount;
+}
+
+// =====================================================================================================================
+// Gives every queue of the device a chance to release the operations it holds back on timeline semaphore waits, after
+// a new timeline semaphore signal was submitted.
+void Device::ReleaseTimelineWaits()
+{
+    for (uint32_t i = 0; i < Queue::MaxQueueFamilies; ++i)
+    {
+        for (uint32_t j = 0; (j < Queue::MaxQueuesPerFamily) && (m_pQueues[i][j] != nullptr); ++j)
+        {
+            (*m_pQueues[i][j])->RequestDeferredFlush();
+        }
+    }
+
+    NotifyTimelineProgress();
+}
+
+// =====================================================================================================================
+// Returns the current timeline progress count.  A host wait samples it before examining the state it waits on, and
+// then passes it to WaitForTimelineProgress() so that no progress made in between is missed.
+uint64_t Device::GetTimelineProgress()
+{
+    Util::MutexAuto lock(&m_timelineMutex);
+
+    return m_timelineProgress;
+}
+
+// =====================================================================================================================
+// Wakes up the host waits blocked in WaitForTimelineProgress().  Called whenever a timeline semaphore signal is
+// submitted or a queue operation held back on a timeline semaphore wait is released.
+void Device::NotifyTimelineProgress()
+{
+    Util::MutexAuto lock(&m_timelineMutex);
+
+    ++m_timelineProgress;
+
+    m_timelineCondition.WakeAll();
+}
+
+// =====================================================================================================================
+// Blocks until the timeline progress count differs from the given one or the timeout (in nanoseconds) expires.  The
+// caller re-examines whatever it waits on afterwards, as the wait may also end spuriously.
+void Device::WaitForTimelineProgress(
+    uint64_t progress,
+    uint64_t timeout)
+{
+    // Round up to whole milliseconds so that a short remaining timeout does not turn into a busy loop
+    const uint64_t timeoutMs = (timeout / 1000000) + (((timeout % 1000000) != 0) ? 1 : 0);
+
+    Util::MutexAuto lock(&m_timelineMutex);
+
+    if ((m_timelineProgress == progress) && (timeout > 0))
+    {
+        m_timelineCondition.Wait(&m_timelineMutex, static_cast<uint32_t>(Util::Min<uint64_t>(timeoutMs, UINT32_MAX)));
+    }
+}
+
 // =====================================================================================================================
 // Creates a new GPU memory object
 VkResult Device::AllocMemory(
@@ -1240,10 +1410,12 @@ Pal::gpusize Device::GetVirtualAllocAlignment() const
 }
 
 // =====================================================================================================================
-VkResult Device::WaitForFences(
+// Waits on the PAL fences of the given fences, skipping those whose queue submission is still held back on a timeline
+// semaphore wait and has not reached PAL yet.
+Pal::Result Device::WaitForSubmittedFences(
     uint32_t       fenceCount,
     const VkFence* pFences,
-    VkBool32       waitAll,
+    bool           waitAll,
     uint64_t       timeout)
 {
     Pal::Result palResult = Pal::Result::Success;
@@ -1252,12 +1424,22 @@ VkResult Device::WaitForFences(
 
     if (IsMultiGpu() == false)  // TODO: SWDEV-120909 - Remove looping and branching where necessary
     {
+        uint32_t palFenceCount = 0;
+
         for (uint32_t i = 0; i < fenceCount; ++i)
         {
-            ppPalFences[i] = Fence::ObjectFromHandle(pFences[i])->PalFence();
+            const Fence* pFence = Fence::ObjectFromHandle(pFences[i]);
+
+            if (pFence->IsSubmissionDeferred() == false)
+            {
+                ppPalFences[palFenceCount++] = pFence->PalFence();
+            }
         }
 
-        palResult = PalDevice()->WaitForFences(fenceCount, ppPalFences, waitAll != VK_FALSE, timeout);
+        if (palFenceCount > 0)
+        {
+            palResult = PalDevice()->WaitForFences(palFenceCount, ppPalFences, waitAll, timeout);
+        }
     }
     else
     {
@@ -1276,7 +1458,8 @@ VkResult Device::WaitForFences(
                 // for these cases.
                 const bool forceWait = (pFence->GetActiveDeviceMask() == 0) && (deviceIdx == DefaultDeviceIndex);
 
-                if (forceWait || ((currentDeviceMask & pFence->GetActiveDeviceMask()) != 0))
+                if ((pFence->IsSubmissionDeferred() == false) &&
+                    (forceWait || ((currentDeviceMask & pFence->GetActiveDeviceMask()) != 0)))
                 {
                     ppPalFences[perDeviceFenceCount++] = pFence->PalFence(deviceIdx);
                 }
@@ -1286,11 +1469,87 @@ VkResult Device::WaitForFences(
             {
                 palResult = PalDevice(deviceIdx)->WaitForFences(perDeviceFenceCount,
                                                                 ppPalFences,
-                                                                waitAll != VK_FALSE,
+                                                                waitAll,
                                                                 timeout);
             }
         }
     }
+
+    return palResult;
+}
+
+// =====================================================================================================================
+VkResult Device::WaitForFences(
+    uint32_t       fenceCount,
+    const VkFence* pFences,
+    VkBool32       waitAll,
+    uint64_t       timeout)
+{
+    // A wait for any of several fences waits on the ones that reached PAL in slices of this length (in nanoseconds),
+    // so that fences whose submission is released in the meantime are waited on as well.
+    constexpr uint64_t WaitAnySliceTime = 1000000;
+
+    const int64_t startTime = Util::GetPerfCpuTime();
+
+    Pal::Result palResult = Pal::Result::Success;
+
+    for (bool waiting = true; waiting;)
+    {
+        // Sampled before the fences are examined so that a submission released after that ends the wait below
+        const uint64_t progress  = GetTimelineProgress();
+        const uint64_t remaining = GetRemainingTimeNs(startTime, timeout);
+
+        // Fences whose queue submission is held back on a timeline semaphore wait have not reached PAL yet.  Their
+        // submissions are released by other threads signaling the timeline semaphores.
+        uint32_t deferredCount = 0;
+
+        for (uint32_t i = 0; i < fenceCount; ++i)
+        {
+            const Fence* pFence = Fence::ObjectFromHandle(pFences[i]);
+
+            if (pFence->IsSubmissionDeferred())
+            {
+                ++deferredCount;
+            }
+            else if (pFence->GetSubmissionResult() != VK_SUCCESS)
+            {
+                // The submission failed after it was released, so the fence is never going to signal
+                return pFence->GetSubmissionResult();
+            }
+        }
+
+        const bool waitSubmission = (waitAll != VK_FALSE) ? (deferredCount > 0) : (deferredCount == fenceCount);
+
+        if (waitSubmission && (remaining > 0))
+        {
+            WaitForTimelineProgress(progress, remaining);
+        }
+        else if (waitSubmission)
+        {
+            palResult = Pal::Result::Timeout;
+            waiting   = false;
+        }
+        else if ((deferredCount > 0) && (remaining > WaitAnySliceTime))
+        {
+            palResult = WaitForSubmittedFences(fenceCount, pFences, false, WaitAnySliceTime);
+            waiting   = (palResult == Pal::Result::Timeout);
+        }
+        else
+        {
+            palResult = WaitForSubmittedFences(fenceCount, pFences, (waitAll != VK_FALSE), remaining);
+            waiting   = false;
+        }
+    }
+
+    // If all fences are known to be signaled, the queue submissions they were submitted with have been retired.
+    if ((palResult == Pal::Result::Success) && ((waitAll != VK_FALSE) || (fenceCount == 1)))
+    {
+        for (uint32_t i = 0; i < fenceCount; ++i)
+        {
+            Fence::ObjectFromHandle(pFences[i])->RetireQueueSubmissions();
+        }
+    }
+
     return PalToVkResult(palResult);
 }
 
@@ -1304,10 +1563,11 @@ VkResult Device::ResetFences(
 
     Pal::Result palResult = Pal::Result::Success;
 
-    // Clear the wait masks for each fence
+    // Clear the wait masks and the errors of held back submissions for each fence
     for (uint32_t i = 0; i < fenceCount; ++i)
     {
         Fence::ObjectFromHandle(pFences[i])->ClearActiveDeviceMask();
+        Fence::ObjectFromHandle(pFences[i])->SetSubmissionResult(VK_SUCCESS);
     }
 
     for (uint32_t deviceIdx = 0;
@@ -2114,7 +2374,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence(
     VkFence*                                    pFence)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateFence(pCreateInfo, pAllocCB, pFence);
 }
@@ -2160,7 +2420,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore(
     VkSemaphore*                                pSemaphore)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateSemaphore(pCreateInfo, pAllocCB, pSemaphore);
 }
@@ -2173,7 +2433,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(
     if (device != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         pDevice->Destroy(pAllocCB);
     }
@@ -2194,7 +2454,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateEvent(
     VkEvent*                                    pEvent)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateEvent(pCreateInfo, pAllocCB, pEvent);
 }
@@ -2207,7 +2467,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool(
     VkQueryPool*                                pQueryPool)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateQueryPool(pCreateInfo, pAllocCB, pQueryPool);
 }
@@ -2220,7 +2480,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorSetLayout(
     VkDescriptorSetLayout*                      pSetLayout)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateDescriptorSetLayout(pCreateInfo, pAllocCB, pSetLayout);
 }
@@ -2233,7 +2493,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineLayout(
     VkPipelineLayout*                           pPipelineLayout)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreatePipelineLayout(pCreateInfo, pAllocCB, pPipelineLayout);
 }
@@ -2246,7 +2506,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorPool(
     VkDescriptorPool*                           pDescriptorPool)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateDescriptorPool(pCreateInfo->flags,
                                          pCreateInfo->maxSets,
@@ -2263,7 +2523,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer(
     VkFramebuffer*                              pFramebuffer)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateFramebuffer(pCreateInfo, pAllocCB, pFramebuffer);
 }
@@ -2276,7 +2536,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass(
     VkRenderPass*                               pRenderPass)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateRenderPass(pCreateInfo, pAllocCB, pRenderPass);
 }
@@ -2289,7 +2549,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(
     VkBuffer*                                   pBuffer)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateBuffer(pCreateInfo, pAllocCB, pBuffer);
 }
@@ -2302,7 +2562,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateBufferView(
     VkBufferView*                               pView)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateBufferView(pCreateInfo, pAllocCB, pView);
 }
@@ -2315,7 +2575,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage(
     VkImage*                                    pImage)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateImage(pCreateInfo, pAllocCB, pImage);
 }
@@ -2328,7 +2588,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView(
     VkImageView*                                pView)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateImageView(pCreateInfo, pAllocCB, pView);
 }
@@ -2341,7 +2601,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateShaderModule(
     VkShaderModule*                             pShaderModule)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateShaderModule(pCreateInfo, pAllocCB, pShaderModule);
 }
@@ -2354,7 +2614,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineCache(
     VkPipelineCache*                            pPipelineCache)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreatePipelineCache(pCreateInfo, pAllocCB, pPipelineCache);
 }
@@ -2369,7 +2629,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines(
     VkPipeline*                                 pPipelines)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateGraphicsPipelines(
         pipelineCache,
@@ -2389,7 +2649,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateComputePipelines(
     VkPipeline*                                 pPipelines)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateComputePipelines(
         pipelineCache,
@@ -2407,7 +2667,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler(
     VkSampler*                                  pSampler)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateSampler(pCreateInfo, pAllocCB, pSampler);
 }
@@ -2420,7 +2680,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR(
     VkSwapchainKHR*                              pSwapchain)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateSwapchain(pCreateInfo, pAllocCB, pSwapchain);
 }
@@ -2453,7 +2713,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool(
     VkCommandPool*                              pCommandPool)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateCommandPool(pCreateInfo, pAllocCB, pCommandPool);
 }
@@ -2466,7 +2726,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(
     VkDeviceMemory*                             pMemory)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->AllocMemory(pAllocateInfo, pAllocCB, pMemory);
 }
@@ -2507,7 +2767,7 @@ VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorUpdateTemplateKHR(
     VkDescriptorUpdateTemplateKHR*                  pDescriptorUpdateTemplate)
 {
     Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
     return pDevice->CreateDescriptorUpdateTemplate(pCreateInfo, pAllocCB, pDescriptorUpdateTemplate);
 }
@@ -397,6 +397,19 @@ const DispatchTableEntry g_StandardDispatchTable[] =
     PRIMARY_DISPATCH_ENTRY( vkDestroyDescriptorUpdateTemplateKHR            ),
     PRIMARY_DISPATCH_ENTRY( vkUpdateDescriptorSetWithTemplateKHR            ),
 
+    PRIMARY_DISPATCH_ENTRY( vkCmdPushDescriptorSetKHR                       ),
+    PRIMARY_DISPATCH_ENTRY( vkCmdPushDescriptorSetWithTemplateKHR           ),
+
+    PRIMARY_DISPATCH_ENTRY( vkGetSemaphoreCounterValueKHR                   ),
+    PRIMARY_DISPATCH_ENTRY( vkWaitSemaphoresKHR                             ),
+    PRIMARY_DISPATCH_ENTRY( vkSignalSemaphoreKHR                            ),
+
+    PRIMARY_DISPATCH_ENTRY( vkCmdDrawIndirectCountKHR                       ),
+    PRIMARY_DISPATCH_ENTRY( vkCmdDrawIndexedIndirectCountKHR                ),
+
+    PRIMARY_DISPATCH_ENTRY( vkCmdBeginConditionalRenderingEXT               ),
+    PRIMARY_DISPATCH_ENTRY( vkCmdEndConditionalRenderingEXT                 ),
+
     PRIMARY_DISPATCH_ENTRY( vkAcquireNextImage2KHX                          ),
     PRIMARY_DISPATCH_ENTRY( vkCmdDispatchBaseKHX                            ),
     PRIMARY_DISPATCH_ENTRY( vkCmdSetDeviceMaskKHX                           ),
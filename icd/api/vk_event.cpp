@@ -209,7 +209,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyEvent(
     if (event != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Event::ObjectFromHandle(event)->Destroy(pDevice, pAllocCB);
     }
@@ -34,6 +34,7 @@
 #include "include/vk_device.h"
 #include "include/vk_instance.h"
 #include "include/vk_object.h"
+#include "include/vk_queue.h"
 
 #include "palFence.h"
 
@@ -155,6 +156,16 @@ VkResult Fence::Destroy(
 // Retrieve the status of a fence object
 VkResult Fence::GetStatus(void)
 {
+    if (IsSubmissionDeferred())
+    {
+        return VK_NOT_READY;
+    }
+
+    if (m_submissionResult != VK_SUCCESS)
+    {
+        return m_submissionResult;
+    }
+
     Pal::Result palResult = Pal::Result::Success;
 
     for (uint32_t deviceIdx = 0; (deviceIdx < m_groupedFenceCount) && (palResult == Pal::Result::Success); deviceIdx++)
@@ -173,6 +184,8 @@ VkResult Fence::GetStatus(void)
 
     if (palResult == Pal::Result::Success)
     {
+        RetireQueueSubmissions();
+
         result = VK_SUCCESS;
     }
     else if ((palResult == Pal::Result::ErrorUnavailable) ||
@@ -189,6 +202,17 @@ VkResult Fence::GetStatus(void)
     return result;
 }
 
+// =====================================================================================================================
+// Called once this fence is known to be signaled: all queue submissions up to and including the one this fence was
+// submitted with have completed.
+void Fence::RetireQueueSubmissions() const
+{
+    if (m_pSubmitQueue != nullptr)
+    {
+        m_pSubmitQueue->RetireSubmissions(m_submitSerial);
+    }
+}
+
 // =====================================================================================================================
 
 namespace entry
@@ -209,7 +233,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyFence(
     if (fence != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Fence::ObjectFromHandle(fence)->Destroy(pDevice, pAllocCB);
     }
@@ -207,7 +207,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyFramebuffer(
     if (framebuffer != VK_NULL_HANDLE)
     {
         const Device*                pDevice = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Framebuffer::ObjectFromHandle(framebuffer)->Destroy(pDevice, pAllocCB);
     }
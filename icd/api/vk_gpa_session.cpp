@@ -47,7 +47,7 @@ VkResult GpaSession::Create(
 {
     VkResult result = VK_SUCCESS;
 
-    pAllocator = (pAllocator != nullptr) ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+    pAllocator = (pAllocator != nullptr) ? pAllocator : pDevice->GetAllocCallbacks();
 
     void* pStorage = pDevice->AllocApiObject(sizeof(GpaSession), pAllocator);
 
@@ -115,7 +115,7 @@ VkResult GpaSession::Init()
 void GpaSession::Destroy(
     const VkAllocationCallbacks* pAllocator)
 {
-    pAllocator = (pAllocator != nullptr) ? pAllocator : m_pDevice->VkInstance()->GetAllocCallbacks();
+    pAllocator = (pAllocator != nullptr) ? pAllocator : m_pDevice->GetAllocCallbacks();
 
     Util::Destructor(this);
 
@@ -167,6 +167,8 @@ VkResult GpaSession::CmdBegin(CmdBuffer* pCmdBuf)
 // =====================================================================================================================
 VkResult GpaSession::CmdEnd(CmdBuffer* pCmdBuf)
 {
+    pCmdBuf->FlushDeferredBarriers();
+
     Pal::Result palResult = m_session.End(pCmdBuf->PalCmdBuffer());
 
     VkResult result = PalToVkResult(palResult);
@@ -267,6 +269,8 @@ VkResult GpaSession::CmdBeginSample(
 
     if (result == VK_SUCCESS)
     {
+        pCmdbuf->FlushDeferredBarriers();
+
         uint32_t sampleID = m_session.BeginSample(pCmdbuf->PalCmdBuffer(), sampleConfig);
 
         *pSampleID = sampleID;
@@ -285,6 +289,8 @@ void GpaSession::CmdEndSample(
     CmdBuffer* pCmdbuf,
     uint32_t   sampleID)
 {
+    pCmdbuf->FlushDeferredBarriers();
+
     m_session.EndSample(pCmdbuf->PalCmdBuffer(), sampleID);
 }
 
@@ -292,6 +298,8 @@ void GpaSession::CmdEndSample(
 void GpaSession::CmdCopyResults(
     CmdBuffer* pCmdBuf)
 {
+    pCmdBuf->FlushDeferredBarriers();
+
     m_session.CopyResults(pCmdBuf->PalCmdBuffer());
 }
 
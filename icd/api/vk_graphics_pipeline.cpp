@@ -191,7 +191,8 @@ VkResult GraphicsPipeline::BuildPatchedShaders(
     void**                              ppTempBuffer,
     void**                              ppTempShaderBuffer,
     size_t*                             pPipelineBinarySize,
-    const void**                        ppPipelineBinary)
+    const void**                        ppPipelineBinary,
+    PipelineCreationFeedback*           pFeedback)
 {
     const RuntimeSettings& settings = pDevice->GetRuntimeSettings();
 
@@ -867,6 +868,13 @@ VkResult GraphicsPipeline::BuildPatchedShaders(
 
                     *ppPipelineBinary    = pInfo->pipeline.pPipelineBinary;
                     *pPipelineBinarySize = pInfo->pipeline.pipelineBinarySize;
+
+                    // LLPC reports graphics stage feedback in the same order as our graphics shader stages
+                    pFeedback->pipeline = piplineOut.pipelineFeedback;
+                    for (uint32_t stage = 0; stage < ShaderGfxStageCount; ++stage)
+                    {
+                        pFeedback->stages[stage] = piplineOut.stageFeedback[stage];
+                    }
                 }
             }
         }
@@ -904,14 +912,15 @@ VkResult GraphicsPipeline::Create(
     VkPipeline*                             pPipeline)
 {
     // Parse the create info and build patched AMDIL shaders
-    CreateInfo createInfo       = {};
-    ImmedInfo immedInfo         = {};
-    VbBindingInfo vbInfo        = {};
-    void* pTempBuffer           = nullptr;
-    void* pTempShaderBuffer     = nullptr;
-    size_t pipelineBinarySize   = 0;
-    const void* pPipelineBinary = nullptr;
-    Pal::Result palResult       = Pal::Result::Success;
+    CreateInfo createInfo             = {};
+    ImmedInfo immedInfo               = {};
+    VbBindingInfo vbInfo              = {};
+    void* pTempBuffer                 = nullptr;
+    void* pTempShaderBuffer           = nullptr;
+    size_t pipelineBinarySize         = 0;
+    const void* pPipelineBinary       = nullptr;
+    PipelineCreationFeedback feedback = {};
+    Pal::Result palResult             = Pal::Result::Success;
 
     VkResult result = BuildPatchedShaders(
         pDevice,
@@ -923,7 +932,8 @@ VkResult GraphicsPipeline::Create(
         &pTempBuffer,
         &pTempShaderBuffer,
         &pipelineBinarySize,
-        &pPipelineBinary);
+        &pPipelineBinary,
+        &feedback);
 
     // See which graphics shader stage is setting a wave limit
     if (result == VK_SUCCESS)
@@ -1131,7 +1141,10 @@ VkResult GraphicsPipeline::Create(
             pPalColorBlend,
             pPalDepthStencil,
             createInfo.sampleCoverage,
-            pBinaryInfo);
+            pBinaryInfo,
+            feedback);
+
+        WriteCreationFeedback(pCreateInfo->pNext, pCreateInfo->stageCount, pCreateInfo->pStages, feedback);
 
         *pPipeline = GraphicsPipeline::HandleFromVoidPointer(pSystemMem);
     }
@@ -1195,9 +1208,10 @@ GraphicsPipeline::GraphicsPipeline(
     Pal::IColorBlendState**                pPalColorBlend,
     Pal::IDepthStencilState**              pPalDepthStencil,
     uint32_t                               coverageSamples,
-    PipelineBinaryInfo*                    pBinary)
+    PipelineBinaryInfo*                    pBinary,
+    const PipelineCreationFeedback&        feedback)
     :
-    Pipeline(pDevice, pPalPipeline, pLayout, pBinary),
+    Pipeline(pDevice, pPalPipeline, pLayout, pBinary, feedback),
     m_info(immedInfo),
     m_vbInfo(vbInfo),
     m_coverageSamples(coverageSamples)
@@ -1606,7 +1606,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyImage(
     if (image != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Image::ObjectFromHandle(image)->Destroy(pDevice, pAllocCB);
     }
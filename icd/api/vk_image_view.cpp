@@ -530,7 +530,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyImageView(
     if (imageView != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         ImageView::ObjectFromHandle(imageView)->Destroy(pDevice, pAllocCB);
     }
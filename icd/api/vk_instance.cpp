@@ -43,6 +43,8 @@
 #include "sqtt/sqtt_layer.h"
 #include "sqtt/sqtt_mgr.h"
 
+#include "timing/timing_layer.h"
+
 #if ICD_GPUOPEN_DEVMODE_BUILD
 #include "devmode/devmode_mgr.h"
 #endif
@@ -366,6 +368,18 @@ VkResult Instance::Init(
         }
     }
 
+    // Install the API timing layer if any physical device requests it.
+    if (status == VK_SUCCESS)
+    {
+        for (uint32_t deviceIdx = 0; deviceIdx < deviceCount; ++deviceIdx)
+        {
+            if (ApiPhysicalDevice::ObjectFromHandle(devices[deviceIdx])->GetRuntimeSettings().enableApiTimingLayer)
+            {
+                EnableApiTimingSupport();
+            }
+        }
+    }
+
     // Install PAL developer callback if the SQTT layer is enabled.  This is required to trap internal barriers
     // and dispatches performed by PAL so that they can be correctly annotated to RGP.
     if ((status == VK_SUCCESS) && IsTracingSupportEnabled())
@@ -670,6 +684,19 @@ void Instance::EnableTracingSupport()
     m_flags.sqttSupport = 1;
 }
 
+// =====================================================================================================================
+// This function notifies the instance that it should return versions of Vulkan entry points that record their CPU
+// time for the API timing layer.
+//
+// IMPORTANT: Like EnableTracingSupport(), this function must be called before the loader/application queries this
+// ICD's per-instance dispatch table.
+void Instance::EnableApiTimingSupport()
+{
+    VK_DEBUG_BUILD_ONLY_ASSERT(m_dispatchTableQueryCount == 0);
+
+    m_flags.apiTimingSupport = 1;
+}
+
 // =====================================================================================================================
 // Returns this instance's dispatch table stack.  This stack describes the function pointer implementations of all
 // Vulkan entry points, both device and instance, that utilize either this instance, its physical devices, and devices
@@ -688,6 +715,12 @@ uint32_t Instance::GetDispatchTables(
 
     uint32_t count = 0;
 
+    // Install the API timing layer if needed.  It goes first so that the time spent in other layers is included.
+    if (IsApiTimingSupportEnabled())
+    {
+        pTables[count++] = vk::entry::timing::g_ApiTimingDispatchTable;
+    }
+
     // Install SQTT marker annotation layer if needed
     if (IsTracingSupportEnabled())
     {
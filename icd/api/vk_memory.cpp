@@ -371,6 +371,9 @@ VkResult Memory::Create(
         // notify the memory object that it is counted so that the destructor can decrease the counter accordingly
         pMemory->SetAllocationCounted();
 
+        // Account for the allocation in the per-heap usage reported through VK_EXT_memory_budget
+        pMemory->UpdateHeapUsage(true);
+
         *pMemoryHandle = Memory::HandleFromObject(pMemory);
     }
 
@@ -473,6 +476,7 @@ Memory::Memory(
     m_mirroredAllocationMask(0),
     m_multiInstance(pPeerMemory != nullptr),
     m_allocationCounted(false),
+    m_heapUsageTracked(false),
     m_pExternalPalImage(pExternalImage)
 {
     memcpy(m_pPalMemory, pPalMemory, sizeof(m_pPalMemory));
@@ -491,6 +495,7 @@ Memory::Memory(
     m_mirroredAllocationMask(0),
     m_multiInstance(pPeerMemory != nullptr),
     m_allocationCounted(false),
+    m_heapUsageTracked(false),
     m_pExternalPalImage(nullptr)
 {
     // PAL info is not available for memory objects allocated for presentable images
@@ -516,6 +521,12 @@ VkResult Memory::Free(
         m_pExternalPalImage = nullptr;
     }
 
+    // Must happen while the PAL memory objects are still alive
+    if (m_heapUsageTracked)
+    {
+        UpdateHeapUsage(false);
+    }
+
     // Iterate memory objects in reverse order, to ensure that any mirrored memory is destroyed before the parent
     for (int32_t i = m_pDevice->NumPalDevices()-1; i >= 0 ; --i)
     {
@@ -546,6 +557,35 @@ VkResult Memory::Free(
     return VK_SUCCESS;
 }
 
+// =====================================================================================================================
+// Adds or removes the size of each PAL memory object owned by this allocation to or from the per-heap usage of the
+// physical device it was allocated on.  Mirrored allocations are views of another device's memory and are skipped.
+void Memory::UpdateHeapUsage(
+    bool allocated)
+{
+    for (uint32_t deviceIdx = 0; deviceIdx < m_pDevice->NumPalDevices(); ++deviceIdx)
+    {
+        const Pal::IGpuMemory* pGpuMemory = m_pPalMemory[deviceIdx];
+
+        if ((pGpuMemory != nullptr) && (IsMirroredAllocation(deviceIdx) == false))
+        {
+            const Pal::GpuMemoryDesc& desc            = pGpuMemory->Desc();
+            PhysicalDevice*           pPhysicalDevice = m_pDevice->VkPhysicalDevice(deviceIdx);
+
+            if (allocated)
+            {
+                pPhysicalDevice->AddMemoryUsage(desc.preferredHeap, desc.size);
+            }
+            else
+            {
+                pPhysicalDevice->RemoveMemoryUsage(desc.preferredHeap, desc.size);
+            }
+        }
+    }
+
+    m_heapUsageTracked = allocated;
+}
+
 // =====================================================================================================================
 Pal::Result Memory::Init()
 {
@@ -811,7 +851,7 @@ VKAPI_ATTR void VKAPI_CALL vkFreeMemory(
     if (memory != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Memory::ObjectFromHandle(memory)->Free(pDevice, pAllocCB);
     }
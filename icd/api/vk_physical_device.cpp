@@ -53,6 +53,7 @@
 
 #include "palDevice.h"
 #include "palCmdBuffer.h"
+#include "palDbgPrint.h"
 #include "palLib.h"
 #include "palMath.h"
 #include "palMsaaState.h"
@@ -258,6 +259,8 @@ PhysicalDevice::PhysicalDevice(
     memset(&m_queueFamilies, 0, sizeof(m_queueFamilies));
     memset(&m_memoryProperties, 0, sizeof(m_memoryProperties));
     memset(&m_gpaProps, 0, sizeof(m_gpaProps));
+    memset(const_cast<uint64_t*>(m_memoryUsage), 0, sizeof(m_memoryUsage));
+    memset(m_memoryUsagePeak, 0, sizeof(m_memoryUsagePeak));
     for (uint32_t i = 0; i< VK_MEMORY_TYPE_NUM; i++)
     {
         m_memoryPalHeapToVkIndex[i] = VK_MEMORY_TYPE_NUM; // invalid index
@@ -2376,10 +2379,17 @@ DeviceExtensions::Supported PhysicalDevice::GetAvailableExtensions(
 
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_SHADER_STENCIL_EXPORT));
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_SHADER_VIEWPORT_INDEX_LAYER));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_DESCRIPTOR_INDEXING));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_PIPELINE_CREATION_FEEDBACK));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_CONDITIONAL_RENDERING));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(EXT_MEMORY_BUDGET));
 
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_BIND_MEMORY2));
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_DEDICATED_ALLOCATION));
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_DESCRIPTOR_UPDATE_TEMPLATE));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_PUSH_DESCRIPTOR));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_TIMELINE_SEMAPHORE));
+    availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_DRAW_INDIRECT_COUNT));
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_EXTERNAL_MEMORY));
     availableExtensions.AddExtension(VK_DEVICE_EXTENSION(KHR_EXTERNAL_MEMORY_FD));
 
@@ -2788,6 +2798,59 @@ void PhysicalDevice::GetFeatures2(
 
                 break;
             }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:
+            {
+                VkPhysicalDeviceDescriptorIndexingFeaturesEXT* pIndexingFeatures =
+                    reinterpret_cast<VkPhysicalDeviceDescriptorIndexingFeaturesEXT*>(pHeader);
+
+                // Descriptor arrays are indexed in the shader, so dynamic indexing works for every descriptor type.
+                // Non-uniform indices of image and texel buffer descriptors are scalarized by the compiler with a
+                // waterfall loop.  Buffer descriptor loads are not, so non-uniform UBO/SSBO indexing is unsupported.
+                pIndexingFeatures->shaderInputAttachmentArrayDynamicIndexing          = VK_TRUE;
+                pIndexingFeatures->shaderUniformTexelBufferArrayDynamicIndexing       = VK_TRUE;
+                pIndexingFeatures->shaderStorageTexelBufferArrayDynamicIndexing       = VK_TRUE;
+                pIndexingFeatures->shaderUniformBufferArrayNonUniformIndexing         = VK_FALSE;
+                pIndexingFeatures->shaderSampledImageArrayNonUniformIndexing          = VK_TRUE;
+                pIndexingFeatures->shaderStorageBufferArrayNonUniformIndexing         = VK_FALSE;
+                pIndexingFeatures->shaderStorageImageArrayNonUniformIndexing          = VK_TRUE;
+                pIndexingFeatures->shaderInputAttachmentArrayNonUniformIndexing       = VK_TRUE;
+                pIndexingFeatures->shaderUniformTexelBufferArrayNonUniformIndexing    = VK_TRUE;
+                pIndexingFeatures->shaderStorageTexelBufferArrayNonUniformIndexing    = VK_TRUE;
+
+                // Descriptor set memory is persistently mapped and only read by the GPU at execution time, so updates
+                // after bind are safe for every descriptor type that is not copied into user data at bind time.
+                pIndexingFeatures->descriptorBindingUniformBufferUpdateAfterBind      = VK_TRUE;
+                pIndexingFeatures->descriptorBindingSampledImageUpdateAfterBind       = VK_TRUE;
+                pIndexingFeatures->descriptorBindingStorageImageUpdateAfterBind       = VK_TRUE;
+                pIndexingFeatures->descriptorBindingStorageBufferUpdateAfterBind      = VK_TRUE;
+                pIndexingFeatures->descriptorBindingUniformTexelBufferUpdateAfterBind = VK_TRUE;
+                pIndexingFeatures->descriptorBindingStorageTexelBufferUpdateAfterBind = VK_TRUE;
+                pIndexingFeatures->descriptorBindingUpdateUnusedWhilePending          = VK_TRUE;
+                pIndexingFeatures->descriptorBindingPartiallyBound                    = VK_TRUE;
+                pIndexingFeatures->descriptorBindingVariableDescriptorCount           = VK_TRUE;
+                pIndexingFeatures->runtimeDescriptorArray                             = VK_TRUE;
+
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR:
+            {
+                VkPhysicalDeviceTimelineSemaphoreFeaturesKHR* pTimelineFeatures =
+                    reinterpret_cast<VkPhysicalDeviceTimelineSemaphoreFeaturesKHR*>(pHeader);
+
+                pTimelineFeatures->timelineSemaphore = VK_TRUE;
+
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            {
+                VkPhysicalDeviceConditionalRenderingFeaturesEXT* pConditionalRenderingFeatures =
+                    reinterpret_cast<VkPhysicalDeviceConditionalRenderingFeaturesEXT*>(pHeader);
+
+                pConditionalRenderingFeatures->conditionalRendering          = VK_TRUE;
+                pConditionalRenderingFeatures->inheritedConditionalRendering = VK_FALSE;
+
+                break;
+            }
 
             default:
             {
@@ -2909,6 +2972,9 @@ void PhysicalDevice::GetDeviceProperties2(
         VkPhysicalDeviceIDPropertiesKHR*                pIDProperties;
         VkPhysicalDeviceSampleLocationsPropertiesEXT*   pSampleLocationsPropertiesEXT;
         VkPhysicalDeviceGpaPropertiesAMD*               pGpaProperties;
+        VkPhysicalDevicePushDescriptorPropertiesKHR*    pPushDescriptorProperties;
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT* pDescriptorIndexingProperties;
+        VkPhysicalDeviceTimelineSemaphorePropertiesKHR*  pTimelineSemaphoreProperties;
     };
 
     for (pProp = pProperties; pHeader != nullptr; pHeader = pHeader->pNext)
@@ -2947,6 +3013,62 @@ void PhysicalDevice::GetDeviceProperties2(
             GetDeviceGpaProperties(pGpaProperties);
             break;
         }
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+        {
+            pPushDescriptorProperties->maxPushDescriptors = MaxPushDescriptors;
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT:
+        {
+            // Non-uniform indexing is implemented with a waterfall loop rather than natively in hardware.
+            pDescriptorIndexingProperties->maxUpdateAfterBindDescriptorsInAllPools            = UINT32_MAX;
+            pDescriptorIndexingProperties->shaderUniformBufferArrayNonUniformIndexingNative   = VK_FALSE;
+            pDescriptorIndexingProperties->shaderSampledImageArrayNonUniformIndexingNative    = VK_FALSE;
+            pDescriptorIndexingProperties->shaderStorageBufferArrayNonUniformIndexingNative   = VK_FALSE;
+            pDescriptorIndexingProperties->shaderStorageImageArrayNonUniformIndexingNative    = VK_FALSE;
+            pDescriptorIndexingProperties->shaderInputAttachmentArrayNonUniformIndexingNative = VK_FALSE;
+            pDescriptorIndexingProperties->robustBufferAccessUpdateAfterBind                  = VK_TRUE;
+            pDescriptorIndexingProperties->quadDivergentImplicitLod                           = VK_FALSE;
+
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindSamplers         =
+                m_limits.maxPerStageDescriptorSamplers;
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindUniformBuffers   =
+                m_limits.maxPerStageDescriptorUniformBuffers;
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindStorageBuffers   =
+                m_limits.maxPerStageDescriptorStorageBuffers;
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindSampledImages    =
+                m_limits.maxPerStageDescriptorSampledImages;
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindStorageImages    =
+                m_limits.maxPerStageDescriptorStorageImages;
+            pDescriptorIndexingProperties->maxPerStageDescriptorUpdateAfterBindInputAttachments =
+                m_limits.maxPerStageDescriptorInputAttachments;
+            pDescriptorIndexingProperties->maxPerStageUpdateAfterBindResources                  =
+                m_limits.maxPerStageResources;
+
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindSamplers              =
+                m_limits.maxDescriptorSetSamplers;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindUniformBuffers        =
+                m_limits.maxDescriptorSetUniformBuffers;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindUniformBuffersDynamic =
+                m_limits.maxDescriptorSetUniformBuffersDynamic;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindStorageBuffers        =
+                m_limits.maxDescriptorSetStorageBuffers;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic =
+                m_limits.maxDescriptorSetStorageBuffersDynamic;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindSampledImages         =
+                m_limits.maxDescriptorSetSampledImages;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindStorageImages         =
+                m_limits.maxDescriptorSetStorageImages;
+            pDescriptorIndexingProperties->maxDescriptorSetUpdateAfterBindInputAttachments      =
+                m_limits.maxDescriptorSetInputAttachments;
+            break;
+        }
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES_KHR:
+        {
+            // Timeline payloads are tracked on the host, so any difference between pending values is supported.
+            pTimelineSemaphoreProperties->maxTimelineSemaphoreValueDifference = UINT64_MAX;
+            break;
+        }
 
         default:
             break;
@@ -2967,8 +3089,94 @@ void PhysicalDevice::GetFormatProperties2(
 void PhysicalDevice::GetMemoryProperties2(
     VkPhysicalDeviceMemoryProperties2KHR*       pMemoryProperties)
 {
-    VK_ASSERT(pMemoryProperties->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR);
-    pMemoryProperties->memoryProperties = GetMemoryProperties();
+    VkStructHeaderNonConst* pHeader = reinterpret_cast<VkStructHeaderNonConst*>(pMemoryProperties);
+
+    while (pHeader)
+    {
+        switch (static_cast<uint32_t>(pHeader->sType))
+        {
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR:
+            {
+                VK_ASSERT(static_cast<void*>(pHeader) == static_cast<void*>(pMemoryProperties));
+
+                pMemoryProperties->memoryProperties = GetMemoryProperties();
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
+            {
+                VkPhysicalDeviceMemoryBudgetPropertiesEXT* pBudget =
+                    reinterpret_cast<VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(pHeader);
+
+                GetMemoryBudget(pBudget);
+                break;
+            }
+            default:
+                // Skip any unknown extension structures
+                break;
+        }
+
+        pHeader = reinterpret_cast<VkStructHeaderNonConst*>(pHeader->pNext);
+    }
+}
+
+// =====================================================================================================================
+// Fills in the per-heap usage and budget reported through VK_EXT_memory_budget.  Several PAL heaps may back the same
+// Vulkan heap (e.g. both GART heaps, or the invisible heap on small-BAR configurations), so their usage is summed.
+void PhysicalDevice::GetMemoryBudget(
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT*  pBudget) const
+{
+    memset(pBudget->heapBudget, 0, sizeof(pBudget->heapBudget));
+    memset(pBudget->heapUsage,  0, sizeof(pBudget->heapUsage));
+
+    for (uint32_t palHeap = 0; palHeap < Pal::GpuHeapCount; ++palHeap)
+    {
+        uint32_t typeIndex = 0;
+
+        if (GetVkTypeIndexFromPalHeap(static_cast<Pal::GpuHeap>(palHeap), &typeIndex))
+        {
+            const uint32_t heapIndex = m_memoryProperties.memoryTypes[typeIndex].heapIndex;
+
+            pBudget->heapUsage[heapIndex] += GetMemoryUsage(static_cast<Pal::GpuHeap>(palHeap));
+        }
+    }
+
+    // PAL does not expose an OS-level budget, so report the full heap size as the budget.  The usage may exceed it
+    // when the OS has oversubscribed the heap, in which case the budget is clamped to the usage as the spec requires.
+    for (uint32_t heapIndex = 0; heapIndex < m_memoryProperties.memoryHeapCount; ++heapIndex)
+    {
+        pBudget->heapBudget[heapIndex] = Util::Max(m_memoryProperties.memoryHeaps[heapIndex].size,
+                                                   pBudget->heapUsage[heapIndex]);
+    }
+}
+
+// =====================================================================================================================
+// Accounts for an allocation of the given size from the given PAL heap.  This is called from multiple threads, so the
+// running total is kept with atomics rather than a lock.
+void PhysicalDevice::AddMemoryUsage(
+    Pal::GpuHeap heap,
+    Pal::gpusize size)
+{
+    VK_ASSERT(heap < Pal::GpuHeapCount);
+
+    const uint64_t usage = Util::AtomicAdd64(&m_memoryUsage[heap], size);
+
+    // The high-water mark is only reported for diagnostics, so racy updates that occasionally lose a sample are fine.
+    if (usage > m_memoryUsagePeak[heap])
+    {
+        m_memoryUsagePeak[heap] = usage;
+    }
+}
+
+// =====================================================================================================================
+// Accounts for the release of an allocation previously passed to AddMemoryUsage().
+void PhysicalDevice::RemoveMemoryUsage(
+    Pal::GpuHeap heap,
+    Pal::gpusize size)
+{
+    VK_ASSERT(heap < Pal::GpuHeapCount);
+    VK_ASSERT(m_memoryUsage[heap] >= size);
+
+    Util::AtomicAdd64(&m_memoryUsage[heap], 0 - static_cast<uint64_t>(size));
 }
 
 // =====================================================================================================================
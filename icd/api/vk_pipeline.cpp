@@ -46,19 +46,86 @@ namespace vk
 
 // =====================================================================================================================
 Pipeline::Pipeline(
-    Device* const         pDevice,
-    Pal::IPipeline**      pPalPipeline,
-    const PipelineLayout* pLayout,
-    PipelineBinaryInfo*     pBinary)
+    Device* const                   pDevice,
+    Pal::IPipeline**                pPalPipeline,
+    const PipelineLayout*           pLayout,
+    PipelineBinaryInfo*             pBinary,
+    const PipelineCreationFeedback& feedback)
     :
     m_pDevice(pDevice),
     m_pLayout(pLayout),
-    m_pBinary(pBinary)
+    m_pBinary(pBinary),
+    m_feedback(feedback)
 {
     memset(m_pPalPipeline, 0, sizeof(m_pPalPipeline));
     memcpy(m_pPalPipeline, pPalPipeline, sizeof(pPalPipeline[0]) * pDevice->NumPalDevices());
 }
 
+// =====================================================================================================================
+// Converts a compiler build feedback record to the VK_EXT_pipeline_creation_feedback representation.
+static void ConvertCreationFeedback(
+    const Llpc::PipelineBuildFeedback& buildFeedback,
+    VkPipelineCreationFeedbackEXT*     pFeedback)
+{
+    pFeedback->flags    = 0;
+    pFeedback->duration = 0;
+
+    if (buildFeedback.valid)
+    {
+        pFeedback->flags   |= VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT;
+        pFeedback->duration = buildFeedback.durationUs * 1000;
+
+        if (buildFeedback.cacheHit)
+        {
+            pFeedback->flags |= VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes the pipeline creation feedback into a VkPipelineCreationFeedbackCreateInfoEXT structure chained to the
+// pipeline create info, if the application provided one.  Per-stage feedback is returned in the order of the pStages
+// array.
+void Pipeline::WriteCreationFeedback(
+    const void*                             pNext,
+    uint32_t                                stageCount,
+    const VkPipelineShaderStageCreateInfo*  pStages,
+    const PipelineCreationFeedback&         feedback)
+{
+    union
+    {
+        const VkStructHeader*                          pHeader;
+        const VkPipelineCreationFeedbackCreateInfoEXT* pFeedbackInfo;
+    };
+
+    for (pHeader = static_cast<const VkStructHeader*>(pNext); pHeader != nullptr; pHeader = pHeader->pNext)
+    {
+        if (pHeader->sType == VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT)
+        {
+            VK_ASSERT(pFeedbackInfo->pPipelineCreationFeedback != nullptr);
+
+            ConvertCreationFeedback(feedback.pipeline, pFeedbackInfo->pPipelineCreationFeedback);
+
+            VK_ASSERT(pFeedbackInfo->pipelineStageCreationFeedbackCount == stageCount);
+
+            for (uint32_t i = 0; i < Util::Min(stageCount, pFeedbackInfo->pipelineStageCreationFeedbackCount); ++i)
+            {
+                const ShaderStage stage = ShaderFlagBitToStage(pStages[i].stage);
+
+                if (stage < ShaderStageCount)
+                {
+                    ConvertCreationFeedback(feedback.stages[stage], &pFeedbackInfo->pPipelineStageCreationFeedbacks[i]);
+                }
+                else
+                {
+                    pFeedbackInfo->pPipelineStageCreationFeedbacks[i].flags    = 0;
+                    pFeedbackInfo->pPipelineStageCreationFeedbacks[i].duration = 0;
+                }
+            }
+        }
+    }
+}
+
 // =====================================================================================================================
 Pipeline::~Pipeline()
 {
@@ -183,6 +250,33 @@ static void ConvertShaderInfoStatistics(
     }
 }
 
+// =====================================================================================================================
+// Fills the shader statistics which are not reported by PAL with those recorded by LLPC in the pipeline binary.
+static void ConvertLlpcShaderStatistics(
+    const Llpc::ShaderStats&   llpcStats,
+    VkShaderStatisticsInfoAMD* pStats)
+{
+    if (pStats->resourceUsage.numUsedVgprs == 0)
+    {
+        pStats->resourceUsage.numUsedVgprs = llpcStats.numUsedVgprs;
+    }
+
+    if (pStats->resourceUsage.numUsedSgprs == 0)
+    {
+        pStats->resourceUsage.numUsedSgprs = llpcStats.numUsedSgprs;
+    }
+
+    if (pStats->resourceUsage.ldsUsageSizeInBytes == 0)
+    {
+        pStats->resourceUsage.ldsUsageSizeInBytes = llpcStats.ldsSizeInBytes;
+    }
+
+    if (pStats->resourceUsage.scratchMemUsageInBytes == 0)
+    {
+        pStats->resourceUsage.scratchMemUsageInBytes = llpcStats.scratchSizeInBytes;
+    }
+}
+
 namespace entry
 {
 
@@ -195,7 +289,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline(
     if (pipeline != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Pipeline::ObjectFromHandle(pipeline)->Destroy(pDevice, pAllocCB);
     }
@@ -239,6 +333,26 @@ VKAPI_ATTR VkResult VKAPI_CALL vkGetShaderInfoAMD(
 
                     ConvertShaderInfoStatistics(palStats, pStats);
 
+                    // Supplement the statistics with those recorded by LLPC in the pipeline binary, if any.
+                    const PipelineBinaryInfo* pBinary = pPipeline->GetBinary();
+
+                    if (pBinary != nullptr)
+                    {
+                        Llpc::BinaryData pipelineBin = {};
+                        pipelineBin.codeSize = pBinary->binaryByteSize;
+                        pipelineBin.pCode    = pBinary->pBinary;
+
+                        Llpc::ShaderStats llpcStats = {};
+                        const Llpc::ShaderStage llpcStage =
+                            static_cast<Llpc::ShaderStage>(ShaderFlagBitToStage(shaderStage));
+
+                        if (Llpc::ICompiler::GetShaderStats(&pipelineBin, llpcStage, &llpcStats) ==
+                            Llpc::Result::Success)
+                        {
+                            ConvertLlpcShaderStatistics(llpcStats, pStats);
+                        }
+                    }
+
                     Pal::DeviceProperties info;
 
                     ApiDevice::ObjectFromHandle(device)->VkPhysicalDevice()->PalDevice()->GetProperties(&info);
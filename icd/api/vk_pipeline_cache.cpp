@@ -410,7 +410,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineCache(
     if (pipelineCache != VK_NULL_HANDLE)
     {
         const Device*                pDevice = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         PipelineCache::ObjectFromHandle(pipelineCache)->Destroy(pDevice, pAllocCB);
     }
@@ -63,7 +63,8 @@ VkResult PipelineLayout::ConvertCreateInfo(
     // We currently allocate user data registers for various resources in the following fashion:
     // First user data registers will hold the descriptor set bindings in increasing order by set index.
     // For each descriptor set binding we first store the dynamic descriptor data (if there's dynamic section data)
-    // followed by the set pointer (if there's static section data).
+    // followed by the buffer descriptors placed inline in user data (if descriptor promotion is enabled) and the set
+    // pointer (if there's static section data).
     // Push constants follow the descriptor set binding data.
     // Finally, the vertex buffer table pointer is in the last user data register when applicable.
     // This allocation allows the descriptor set bindings to easily persist across pipeline switches.
@@ -117,6 +118,15 @@ VkResult PipelineLayout::ConvertCreateInfo(
     // Total number of dynamic descriptors across all descriptor sets
     uint32_t totalDynDescCount = 0;
 
+    // Number of user data registers left for buffer descriptors placed inline in user data
+    uint32_t inlDescRegBudget = 0;
+
+    if (pDevice->GetRuntimeSettings().enableDescriptorPromotion)
+    {
+        inlDescRegBudget = Util::Min(pDevice->GetRuntimeSettings().descriptorPromotionMaxUserData,
+                                     MaxInlineDescriptors * InlineDescRegCount);
+    }
+
     // Populate user data layouts for each descriptor set that is active
     pInfo->userDataLayout.setBindingRegBase = pInfo->userDataRegCount;
 
@@ -134,6 +144,9 @@ VkResult PipelineLayout::ConvertCreateInfo(
         pSetUserData->dynDescDataRegOffset = 0;
         pSetUserData->dynDescDataRegCount  = 0;
         pSetUserData->dynDescCount         = setLayoutInfo.numDynamicDescriptors;
+        pSetUserData->inlDescDataRegOffset = 0;
+        pSetUserData->inlDescDataRegCount  = 0;
+        pSetUserData->inlDescMask          = 0;
         pSetUserData->firstRegOffset       = pInfo->userDataRegCount - pInfo->userDataLayout.setBindingRegBase;
         pSetUserData->totalRegCount        = 0;
 
@@ -160,6 +173,33 @@ VkResult PipelineLayout::ConvertCreateInfo(
 
             totalDynDescCount += setLayoutInfo.numDynamicDescriptors;
 
+            // Reserve user data register space for the buffer descriptors placed inline in user data.  Sets are
+            // handled in increasing order so that the placement of a set only depends on the sets preceding it.
+            pSetUserData->inlDescDataRegOffset = pSetUserData->firstRegOffset + pSetUserData->totalRegCount;
+
+            for (uint32_t bindingIndex = 0;
+                 (bindingIndex < setLayoutInfo.count) && (setLayoutInfo.inl.dwSize > 0);
+                 ++bindingIndex)
+            {
+                const auto& binding = pInfo->pSetLayouts[i]->Binding(bindingIndex);
+
+                if ((binding.inl.dwSize > 0) &&
+                    (binding.inl.dwSize <= inlDescRegBudget) &&
+                    IsInlineDescriptorRequested(pDevice, i, binding.info.binding))
+                {
+                    VK_ASSERT(binding.inl.dwSize == InlineDescRegCount);
+
+                    pSetUserData->inlDescMask         |= (1u << (binding.inl.dwOffset / binding.inl.dwArrayStride));
+                    pSetUserData->inlDescDataRegCount += binding.inl.dwSize;
+                    inlDescRegBudget                  -= binding.inl.dwSize;
+
+                    // Each inline descriptor needs its own user data node entry
+                    pPipelineInfo->numUserDataNodes++;
+                }
+            }
+
+            pSetUserData->totalRegCount += pSetUserData->inlDescDataRegCount;
+
             if (setLayoutInfo.sta.numPalRsrcMapNodes > 0)
             {
                 // If the set has a static portion reserve an extra user data node entry for the set pointer
@@ -204,6 +244,51 @@ VkResult PipelineLayout::ConvertCreateInfo(
     return result;
 }
 
+// =====================================================================================================================
+// Checks whether the specified binding is requested to be placed inline in user data.  The request list is a semicolon
+// separated list of set:binding pairs given by DescriptorPromotionBindings, where an empty list requests all eligible
+// bindings.
+bool PipelineLayout::IsInlineDescriptorRequested(
+    const Device* pDevice,
+    uint32_t      setIndex,
+    uint32_t      binding)
+{
+    const char* pList = pDevice->GetRuntimeSettings().descriptorPromotionBindings;
+
+    bool requested = (pList[0] == '\0');
+
+    while ((requested == false) && (*pList != '\0'))
+    {
+        char* pEnd = nullptr;
+
+        const uint32_t listSet = static_cast<uint32_t>(strtoul(pList, &pEnd, 10));
+
+        if ((pEnd != pList) && (*pEnd == ':'))
+        {
+            pList = pEnd + 1;
+
+            const uint32_t listBinding = static_cast<uint32_t>(strtoul(pList, &pEnd, 10));
+
+            requested = (pEnd != pList) && (listSet == setIndex) && (listBinding == binding);
+        }
+
+        // Skip to the next pair
+        pList = pEnd;
+
+        while ((*pList != '\0') && (*pList != ';'))
+        {
+            ++pList;
+        }
+
+        if (*pList == ';')
+        {
+            ++pList;
+        }
+    }
+
+    return requested;
+}
+
 // =====================================================================================================================
 // Creates a pipeline layout object.
 VkResult PipelineLayout::Create(
@@ -319,12 +404,34 @@ VkResult PipelineLayout::BuildLlpcSetMapping(
     *pDynNodeCount = 0;
     *pDescriptorRangeCount = 0;
 
+    const SetUserDataLayout& setUserData = m_info.setUserData[setIndex];
+
+    // User data register of the next buffer descriptor placed inline in user data
+    uint32_t inlDescRegOffset = m_info.userDataLayout.setBindingRegBase + setUserData.inlDescDataRegOffset;
+
     for (uint32_t bindingIndex = 0; bindingIndex < pLayout->Info().count; ++bindingIndex)
     {
         auto binding = pLayout->Binding(bindingIndex);
 
+        const bool isInline = (binding.inl.dwSize > 0) &&
+            Util::TestAnyFlagSet(setUserData.inlDescMask, 1u << (binding.inl.dwOffset / binding.inl.dwArrayStride));
+
+        // If the binding is placed inline in user data then add a user data node for it instead of a static section
+        // node.
+        if (isInline)
+        {
+            auto pNode = &pDynNodes[*pDynNodeCount];
+            pNode->type                = Llpc::ResourceMappingNodeType::DescriptorBuffer;
+            pNode->offsetInDwords      = inlDescRegOffset;
+            pNode->sizeInDwords        = binding.inl.dwSize;
+            pNode->srdRange.binding    = binding.info.binding;
+            pNode->srdRange.set        = setIndex;
+            (*pDynNodeCount)++;
+
+            inlDescRegOffset += binding.inl.dwSize;
+        }
         // If the binding has a static section then add a static section node for it.
-        if (binding.sta.dwSize > 0)
+        else if (binding.sta.dwSize > 0)
         {
             auto pNode = &pStaNodes[*pStaNodeCount];
 
@@ -601,7 +708,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout(
     if (pipelineLayout != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         PipelineLayout::ObjectFromHandle(pipelineLayout)->Destroy(pDevice, pAllocCB);
     }
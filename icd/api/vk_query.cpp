@@ -35,8 +35,10 @@
 #include "include/vk_instance.h"
 #include "include/vk_object.h"
 #include "include/vk_query.h"
+#include "include/vk_queue.h"
 
 #include "palQueryPool.h"
+#include "palSysUtil.h"
 
 namespace vk
 {
@@ -256,11 +258,14 @@ VkResult TimestampQueryPool::Create(
 
     entryCount = pCreateInfo->queryCount;
 
-    // Allocate system memory
-    size_t apiSize   = sizeof(TimestampQueryPool);
-    size_t viewSize  = pDevice->GetProperties().descriptorSizes.bufferView;
-    size_t totalSize = apiSize + (viewSize * pDevice->NumPalDevices());
-    void*  pMemory   = nullptr;
+    // Allocate system memory.  The buffer views are followed by the slots tracking the last submission on each queue
+    // that wrote timestamps to the pool.
+    size_t   apiSize     = sizeof(TimestampQueryPool);
+    size_t   viewSize    = pDevice->GetProperties().descriptorSizes.bufferView;
+    size_t   writeOffset = Util::Pow2Align(apiSize + (viewSize * pDevice->NumPalDevices()), VK_DEFAULT_MEM_ALIGN);
+    uint32_t writeCount  = pDevice->GetQueueCount();
+    size_t   totalSize   = writeOffset + (writeCount * sizeof(TimestampWrite));
+    void*    pMemory     = nullptr;
 
     if (result == VK_SUCCESS)
     {
@@ -337,17 +342,33 @@ VkResult TimestampQueryPool::Create(
             memset(pViewMem, 0, pDevice->GetProperties().descriptorSizes.bufferView);
         }
 
+        TimestampWrite* pWrites = static_cast<TimestampWrite*>(Util::VoidPtrInc(pMemory, writeOffset));
+
+        memset(pWrites, 0, writeCount * sizeof(TimestampWrite));
+
         // Construct the final pool object
         TimestampQueryPool* pObject = VK_PLACEMENT_NEW(pMemory) TimestampQueryPool(
             pDevice,
             pCreateInfo->queryType,
             entryCount,
             internalMemory,
-            pStorageViews);
+            pStorageViews,
+            pWrites,
+            writeCount);
 
-        *ppQueryPool = pObject;
+        result = PalToVkResult(pObject->m_writeLock.Init());
+
+        if (result == VK_SUCCESS)
+        {
+            *ppQueryPool = pObject;
+        }
+        else
+        {
+            Util::Destructor(pObject);
+        }
     }
-    else
+
+    if (result != VK_SUCCESS)
     {
         pDevice->MemMgr()->FreeGpuMem(&internalMemory);
 
@@ -375,6 +396,115 @@ VkResult TimestampQueryPool::Destroy(
     return VK_SUCCESS;
 }
 
+// =====================================================================================================================
+// Records a queue submission that writes timestamps to the pool, replacing any earlier one on the same queue.  The
+// queue tracks the completion of the submission with a submit fence.
+void TimestampQueryPool::SetLastWrite(
+    Queue*              pQueue,
+    uint64_t            submitSerial) const
+{
+    Util::MutexAuto lock(&m_writeLock);
+
+    TimestampWrite* pSlot = nullptr;
+
+    for (uint32_t i = 0; (i < m_writeCount) && ((pSlot == nullptr) || (pSlot->pQueue != pQueue)); ++i)
+    {
+        TimestampWrite* pWrite = &m_pWrites[i];
+
+        if ((pWrite->pQueue == pQueue) || ((pWrite->pQueue == nullptr) && (pSlot == nullptr)))
+        {
+            pSlot = pWrite;
+        }
+    }
+
+    VK_ASSERT(pSlot != nullptr);
+
+    pSlot->pQueue       = pQueue;
+    pSlot->submitSerial = submitSerial;
+}
+
+// =====================================================================================================================
+// Returns a submission that wrote timestamps to the pool and is not known to be complete yet, if any.  Write slots of
+// completed submissions are cleared.
+bool TimestampQueryPool::FindPendingWrite(
+    Queue**             ppQueue,
+    uint64_t*           pSubmitSerial)
+{
+    Util::MutexAuto lock(&m_writeLock);
+
+    bool found = false;
+
+    for (uint32_t i = 0; (i < m_writeCount) && (found == false); ++i)
+    {
+        TimestampWrite* pWrite = &m_pWrites[i];
+
+        if (pWrite->pQueue != nullptr)
+        {
+            if (pWrite->pQueue->IsSubmissionComplete(pWrite->submitSerial))
+            {
+                pWrite->pQueue = nullptr;
+            }
+            else
+            {
+                *ppQueue       = pWrite->pQueue;
+                *pSubmitSerial = pWrite->submitSerial;
+                found          = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Waits until every timestamp in the given range has been written by the GPU.  The thread blocks on the fences of the
+// queue submissions that wrote to the pool, which also reports a lost device.  Slots that are still not written after
+// those have completed belong to work that has not been submitted yet (or to a command buffer writing to too many
+// pools to track them all), so those are polled: for a short while first, then sleeping between polls.
+VkResult TimestampQueryPool::WaitForTimestamps(
+    volatile const uint64_t* pTimestamps,
+    uint32_t                 count)
+{
+    constexpr uint32_t SpinPollCount = 1024;
+
+    VkResult result    = VK_SUCCESS;
+    uint32_t pollCount = 0;
+
+    for (uint32_t slot = 0; (slot < count) && (result == VK_SUCCESS); ++slot)
+    {
+        while ((pTimestamps[slot] == 0) && (result == VK_SUCCESS))
+        {
+            Queue*   pQueue       = nullptr;
+            uint64_t submitSerial = 0;
+
+            Pal::Result palResult = Pal::Result::ErrorFenceNeverSubmitted;
+
+            if (FindPendingWrite(&pQueue, &submitSerial))
+            {
+                palResult = pQueue->WaitForSubmission(submitSerial, UINT64_MAX);
+            }
+
+            if (palResult == Pal::Result::ErrorFenceNeverSubmitted)
+            {
+                if (pollCount < SpinPollCount)
+                {
+                    ++pollCount;
+                }
+                else
+                {
+                    Util::SleepMs(1);
+                }
+            }
+            else if (palResult != Pal::Result::Success)
+            {
+                result = VK_ERROR_DEVICE_LOST;
+            }
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Get the results of a range of query slots (Timestamp query pools)
 VkResult TimestampQueryPool::GetResults(
@@ -409,64 +539,70 @@ VkResult TimestampQueryPool::GetResults(
         // just in case, since it's harmless to do.
         queryCount = static_cast<uint32_t>(Util::Min(static_cast<size_t>(queryCount), dataSize / querySlotSize));
 
-        // Write results of each query slot
-        for (uint32_t dstSlot = 0; dstSlot < queryCount; ++dstSlot)
+        volatile const uint64_t* pTimestamps = pSrcData + startQuery;
+
+        if ((flags & VK_QUERY_RESULT_WAIT_BIT) != 0)
         {
-            const uint32_t srcSlot = dstSlot + startQuery;
+            result = WaitForTimestamps(pTimestamps, queryCount);
+        }
 
-            // Pointer to this slot's timestamp counter value
-            volatile const uint64_t* pTimestamp = pSrcData + srcSlot;
+        // Nothing is written if the device was lost while waiting
+        if ((result == VK_SUCCESS) &&
+            ((flags & VK_QUERY_RESULT_WAIT_BIT) != 0) &&
+            ((flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) == 0) &&
+            ((flags & VK_QUERY_RESULT_64_BIT) != 0) &&
+            (stride == sizeof(uint64_t)))
+        {
+            // Every slot is available and the results are tightly packed 64-bit values, which is exactly the layout
+            // of the timestamp memory, so copy them in bulk.
+            memcpy(pData, const_cast<const uint64_t*>(pTimestamps), queryCount * sizeof(uint64_t));
+        }
+        else if (result == VK_SUCCESS)
+        {
+            // Write results of each query slot
+            for (uint32_t dstSlot = 0; dstSlot < queryCount; ++dstSlot)
+            {
+                // Test if the timestamp query is available
+                const uint64_t value = pTimestamps[dstSlot];
+                const bool     ready = (value != 0);
 
-            // Test if the timestamp query is available
-            uint64_t value = *pTimestamp;
-            bool ready     = (value != 0);
+                // Get a pointer to the start of this slot's data
+                void* pSlotData = Util::VoidPtrInc(pData, static_cast<size_t>(dstSlot * stride));
 
-            // Wait until the timestamp query has become available
-            if ((flags & VK_QUERY_RESULT_WAIT_BIT) != 0)
-            {
-                while (!ready)
+                // Write the timestamp value + availability (only write the value if the timestamp was ready,
+                // and only write availability if it was requested)
+                if ((flags & VK_QUERY_RESULT_64_BIT) != 0)
                 {
-                    value = *pTimestamp;
-                    ready = (value != 0);
-                }
-            }
+                    uint64_t* pSlot = reinterpret_cast<uint64_t*>(pSlotData);
 
-            // Get a pointer to the start of this slot's data
-            void* pSlotData = Util::VoidPtrInc(pData, static_cast<size_t>(dstSlot * stride));
-
-            // Write the timestamp value + availability (only write the value if the timestamp was ready,
-            // and only write availability if it was requested)
-            if ((flags & VK_QUERY_RESULT_64_BIT) != 0)
-            {
-                uint64_t* pSlot = reinterpret_cast<uint64_t*>(pSlotData);
+                    if (ready)
+                    {
+                        pSlot[0] = value;
+                    }
 
-                if (ready)
-                {
-                    pSlot[0] = value;
+                    if ((flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) != 0)
+                    {
+                        pSlot[1] = static_cast<uint64_t>(ready);
+                    }
                 }
-
-                if ((flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) != 0)
+                else
                 {
-                    pSlot[1] = static_cast<uint64_t>(ready);
-                }
-            }
-            else
-            {
-                uint32_t* pSlot = reinterpret_cast<uint32_t*>(pSlotData);
+                    uint32_t* pSlot = reinterpret_cast<uint32_t*>(pSlotData);
 
-                if (ready)
-                {
-                    pSlot[0] = static_cast<uint32_t>(value); // Note: 32-bit results are allowed to wrap
-                }
+                    if (ready)
+                    {
+                        pSlot[0] = static_cast<uint32_t>(value); // Note: 32-bit results are allowed to wrap
+                    }
 
-                if ((flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) != 0)
-                {
-                    pSlot[1] = static_cast<uint32_t>(ready);
+                    if ((flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) != 0)
+                    {
+                        pSlot[1] = static_cast<uint32_t>(ready);
+                    }
                 }
-            }
 
-            // Track whether all requested queries were ready
-            allReady &= ready;
+                // Track whether all requested queries were ready
+                allReady &= ready;
+            }
         }
 
         // If at least one query was not available, we need to return VK_NOT_READY
@@ -512,7 +648,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyQueryPool(
     if (queryPool != VK_NULL_HANDLE)
     {
         Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         QueryPool::ObjectFromHandle(queryPool)->Destroy(pDevice, pAllocCB);
     }
@@ -52,6 +52,326 @@
 namespace vk
 {
 
+// =====================================================================================================================
+// Lays out the deep copy of the infos of a deferred queue operation.  It is run once without a destination to measure
+// the copy, and then again to write it.
+class DeferredOpWriter
+{
+public:
+    explicit DeferredOpWriter(void* pBase)
+        :
+        m_pBase(pBase),
+        m_size(0)
+    {
+    }
+
+    // Copies an array, returning null when measuring or when there is nothing to copy
+    template <typename T>
+    T* Copy(
+        const T* pSrc,
+        uint32_t count)
+    {
+        T* pDst = nullptr;
+
+        if ((pSrc != nullptr) && (count > 0))
+        {
+            m_size = Util::Pow2Align(m_size, alignof(T));
+
+            if (m_pBase != nullptr)
+            {
+                pDst = static_cast<T*>(Util::VoidPtrInc(m_pBase, m_size));
+
+                memcpy(pDst, pSrc, sizeof(T) * count);
+            }
+
+            m_size += sizeof(T) * count;
+        }
+
+        return pDst;
+    }
+
+    size_t Size() const
+        { return m_size; }
+
+private:
+    void*  m_pBase;
+    size_t m_size;
+};
+
+// =====================================================================================================================
+// Copies the extension structures of a queue operation info that the queue consumes, dropping all others.
+static const void* CopyExtensionChain(
+    DeferredOpWriter* pWriter,
+    const void*       pNext)
+{
+    const void*             pHead = nullptr;
+    VkStructHeaderNonConst* pTail = nullptr;
+
+    for (const VkStructHeader* pHeader = static_cast<const VkStructHeader*>(pNext);
+         pHeader != nullptr;
+         pHeader = pHeader->pNext)
+    {
+        void* pCopy = nullptr;
+
+        switch (static_cast<int32_t>(pHeader->sType))
+        {
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHX:
+        {
+            const auto* pSrc = reinterpret_cast<const VkDeviceGroupSubmitInfoKHX*>(pHeader);
+            auto*       pDst = pWriter->Copy(pSrc, 1);
+
+            const uint32_t* pWaitIndices   = pWriter->Copy(pSrc->pWaitSemaphoreDeviceIndices, pSrc->waitSemaphoreCount);
+            const uint32_t* pDeviceMasks   = pWriter->Copy(pSrc->pCommandBufferDeviceMasks, pSrc->commandBufferCount);
+            const uint32_t* pSignalIndices = pWriter->Copy(pSrc->pSignalSemaphoreDeviceIndices,
+                                                           pSrc->signalSemaphoreCount);
+
+            if (pDst != nullptr)
+            {
+                pDst->pWaitSemaphoreDeviceIndices   = pWaitIndices;
+                pDst->pCommandBufferDeviceMasks     = pDeviceMasks;
+                pDst->pSignalSemaphoreDeviceIndices = pSignalIndices;
+            }
+
+            pCopy = pDst;
+            break;
+        }
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR:
+        {
+            const auto* pSrc = reinterpret_cast<const VkTimelineSemaphoreSubmitInfoKHR*>(pHeader);
+            auto*       pDst = pWriter->Copy(pSrc, 1);
+
+            const uint64_t* pWaitValues   = pWriter->Copy(pSrc->pWaitSemaphoreValues, pSrc->waitSemaphoreValueCount);
+            const uint64_t* pSignalValues = pWriter->Copy(pSrc->pSignalSemaphoreValues,
+                                                          pSrc->signalSemaphoreValueCount);
+
+            if (pDst != nullptr)
+            {
+                pDst->pWaitSemaphoreValues   = pWaitValues;
+                pDst->pSignalSemaphoreValues = pSignalValues;
+            }
+
+            pCopy = pDst;
+            break;
+        }
+        default:
+            // Skip any unknown extension structures
+            break;
+        }
+
+        if (pCopy != nullptr)
+        {
+            VkStructHeaderNonConst* pCopyHeader = static_cast<VkStructHeaderNonConst*>(pCopy);
+
+            pCopyHeader->pNext = nullptr;
+
+            if (pTail == nullptr)
+            {
+                pHead = pCopyHeader;
+            }
+            else
+            {
+                pTail->pNext = reinterpret_cast<VkStructHeader*>(pCopyHeader);
+            }
+
+            pTail = pCopyHeader;
+        }
+    }
+
+    return pHead;
+}
+
+// =====================================================================================================================
+// Deep-copies an array of command buffer batches.
+static const VkSubmitInfo* CopySubmitInfos(
+    DeferredOpWriter*   pWriter,
+    uint32_t            submitCount,
+    const VkSubmitInfo* pSubmits)
+{
+    VkSubmitInfo* pDst = pWriter->Copy(pSubmits, submitCount);
+
+    for (uint32_t i = 0; i < submitCount; ++i)
+    {
+        const VkSubmitInfo& src = pSubmits[i];
+
+        const VkSemaphore*          pWaits      = pWriter->Copy(src.pWaitSemaphores, src.waitSemaphoreCount);
+        const VkPipelineStageFlags* pWaitStages = pWriter->Copy(src.pWaitDstStageMask, src.waitSemaphoreCount);
+        const VkCommandBuffer*      pCmdBuffers = pWriter->Copy(src.pCommandBuffers, src.commandBufferCount);
+        const VkSemaphore*          pSignals    = pWriter->Copy(src.pSignalSemaphores, src.signalSemaphoreCount);
+        const void*                 pNext       = CopyExtensionChain(pWriter, src.pNext);
+
+        if (pDst != nullptr)
+        {
+            pDst[i].pNext             = pNext;
+            pDst[i].pWaitSemaphores   = pWaits;
+            pDst[i].pWaitDstStageMask = pWaitStages;
+            pDst[i].pCommandBuffers   = pCmdBuffers;
+            pDst[i].pSignalSemaphores = pSignals;
+        }
+    }
+
+    return pDst;
+}
+
+// =====================================================================================================================
+// Deep-copies the memory binds of an array of sparse resource bind infos.
+template <typename BindInfoType>
+static const BindInfoType* CopySparseBinds(
+    DeferredOpWriter*   pWriter,
+    uint32_t            count,
+    const BindInfoType* pBindInfos)
+{
+    BindInfoType* pDst = pWriter->Copy(pBindInfos, count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const auto* pBinds = pWriter->Copy(pBindInfos[i].pBinds, pBindInfos[i].bindCount);
+
+        if (pDst != nullptr)
+        {
+            pDst[i].pBinds = pBinds;
+        }
+    }
+
+    return pDst;
+}
+
+// =====================================================================================================================
+// Deep-copies an array of sparse binding batches.
+static const VkBindSparseInfo* CopyBindSparseInfos(
+    DeferredOpWriter*       pWriter,
+    uint32_t                bindInfoCount,
+    const VkBindSparseInfo* pBindInfos)
+{
+    VkBindSparseInfo* pDst = pWriter->Copy(pBindInfos, bindInfoCount);
+
+    for (uint32_t i = 0; i < bindInfoCount; ++i)
+    {
+        const VkBindSparseInfo& src = pBindInfos[i];
+
+        const VkSemaphore* pWaits = pWriter->Copy(src.pWaitSemaphores, src.waitSemaphoreCount);
+
+        const VkSparseBufferMemoryBindInfo* pBufferBinds =
+            CopySparseBinds(pWriter, src.bufferBindCount, src.pBufferBinds);
+        const VkSparseImageOpaqueMemoryBindInfo* pImageOpaqueBinds =
+            CopySparseBinds(pWriter, src.imageOpaqueBindCount, src.pImageOpaqueBinds);
+        const VkSparseImageMemoryBindInfo* pImageBinds =
+            CopySparseBinds(pWriter, src.imageBindCount, src.pImageBinds);
+
+        const VkSemaphore* pSignals = pWriter->Copy(src.pSignalSemaphores, src.signalSemaphoreCount);
+        const void*        pNext    = CopyExtensionChain(pWriter, src.pNext);
+
+        if (pDst != nullptr)
+        {
+            pDst[i].pNext             = pNext;
+            pDst[i].pWaitSemaphores   = pWaits;
+            pDst[i].pBufferBinds      = pBufferBinds;
+            pDst[i].pImageOpaqueBinds = pImageOpaqueBinds;
+            pDst[i].pImageBinds       = pImageBinds;
+            pDst[i].pSignalSemaphores = pSignals;
+        }
+    }
+
+    return pDst;
+}
+
+// =====================================================================================================================
+// Returns the timeline semaphore values of a queue operation info, if any.
+static const VkTimelineSemaphoreSubmitInfoKHR* FindTimelineSubmitInfo(
+    const void* pNext)
+{
+    const VkTimelineSemaphoreSubmitInfoKHR* pTimelineInfo = nullptr;
+
+    for (const VkStructHeader* pHeader = static_cast<const VkStructHeader*>(pNext);
+         pHeader != nullptr;
+         pHeader = pHeader->pNext)
+    {
+        if (static_cast<int32_t>(pHeader->sType) == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR)
+        {
+            pTimelineInfo = reinterpret_cast<const VkTimelineSemaphoreSubmitInfoKHR*>(pHeader);
+        }
+    }
+
+    return pTimelineInfo;
+}
+
+// =====================================================================================================================
+// Returns true if any of the given semaphores is a timeline semaphore.
+static bool HasTimelineSemaphore(
+    uint32_t           semaphoreCount,
+    const VkSemaphore* pSemaphores)
+{
+    bool found = false;
+
+    for (uint32_t i = 0; (i < semaphoreCount) && (found == false); ++i)
+    {
+        found = Semaphore::ObjectFromHandle(pSemaphores[i])->IsTimeline();
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Returns true if any of the given command buffers writes to a timestamp query pool.
+static bool WritesTimestamps(
+    uint32_t               cmdBufferCount,
+    const VkCommandBuffer* pCmdBuffers)
+{
+    bool found = false;
+
+    for (uint32_t i = 0; (i < cmdBufferCount) && (found == false); ++i)
+    {
+        found = ApiCmdBuffer::ObjectFromHandle(pCmdBuffers[i])->WritesTimestamps();
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Returns true if a batch of a queue operation waits on a timeline semaphore value that neither the host, another
+// submission, nor an earlier batch of the same operation has signaled yet.  Such a batch can't be sent to PAL: the
+// PAL semaphore it has to wait on doesn't exist until the signal is submitted.
+template <typename InfoType>
+static bool HasUnsignaledTimelineWait(
+    uint32_t        infoCount,
+    const InfoType* pInfos)
+{
+    bool unsignaled = false;
+
+    for (uint32_t i = 0; (i < infoCount) && (unsignaled == false); ++i)
+    {
+        const VkTimelineSemaphoreSubmitInfoKHR* pTimelineInfo = FindTimelineSubmitInfo(pInfos[i].pNext);
+
+        for (uint32_t j = 0; (pTimelineInfo != nullptr) && (j < pInfos[i].waitSemaphoreCount) && (unsignaled == false);
+             ++j)
+        {
+            Semaphore*     pSemaphore = Semaphore::ObjectFromHandle(pInfos[i].pWaitSemaphores[j]);
+            const uint64_t value      = pTimelineInfo->pWaitSemaphoreValues[j];
+
+            if (pSemaphore->IsTimeline() && (pSemaphore->HasTimelineSignal(value) == false))
+            {
+                unsignaled = true;
+
+                // Batches are submitted in order, so a signal by an earlier batch satisfies the wait as well
+                for (uint32_t k = 0; (k < i) && unsignaled; ++k)
+                {
+                    const VkTimelineSemaphoreSubmitInfoKHR* pPrevInfo = FindTimelineSubmitInfo(pInfos[k].pNext);
+
+                    for (uint32_t l = 0; (pPrevInfo != nullptr) && (l < pInfos[k].signalSemaphoreCount); ++l)
+                    {
+                        if ((pInfos[k].pSignalSemaphores[l] == pInfos[i].pWaitSemaphores[j]) &&
+                            (pPrevInfo->pSignalSemaphoreValues[l] >= value))
+                        {
+                            unsignaled = false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return unsignaled;
+}
+
 // =====================================================================================================================
 Queue::Queue(
     Device*                 pDevice,
@@ -65,36 +385,621 @@ Queue::Queue(
     m_queueIndex(queueIndex),
     m_pDevModeMgr(pDevice->VkInstance()->GetDevModeMgr()),
     m_pStackAllocator(pStackAllocator),
-    m_pDummyCmdBuffer(nullptr)
+    m_pDummyCmdBuffer(nullptr),
+    m_lastSubmitSerial(0),
+    m_retiredSubmitSerial(0),
+    m_pSubmitFences(nullptr),
+    m_pDeferredHead(nullptr),
+    m_pDeferredTail(nullptr),
+    m_deferredOpCount(0),
+    m_flushRequested(0)
 {
     memcpy(m_pPalQueues, pPalQueues, sizeof(pPalQueues[0]) * pDevice->NumPalDevices());
+    memset(m_pEventRecycleCmdBuffers, 0, sizeof(m_pEventRecycleCmdBuffers));
     memset(&m_palFrameMetadataControl, 0, sizeof(Pal::PerSourceFrameMetadataControl));
 
 }
 
 // =====================================================================================================================
-Queue::~Queue()
+Queue::~Queue()
+{
+    // Operations still held back by timeline semaphore waits are never going to be released
+    while (m_pDeferredHead != nullptr)
+    {
+        DeferredOp* pOp = m_pDeferredHead;
+
+        m_pDeferredHead = pOp->pNext;
+
+        m_pDevice->VkInstance()->FreeMem(pOp);
+    }
+
+    while (m_pSubmitFences != nullptr)
+    {
+        SubmitFence* pSubmitFence = m_pSubmitFences;
+
+        m_pSubmitFences = pSubmitFence->pNext;
+
+        pSubmitFence->pPalFence->Destroy();
+        m_pDevice->VkInstance()->FreeMem(pSubmitFence);
+    }
+
+    if (m_pDummyCmdBuffer != nullptr)
+    {
+        m_pDummyCmdBuffer->Destroy();
+        m_pDevice->VkInstance()->FreeMem(m_pDummyCmdBuffer);
+    }
+
+    for (uint32_t deviceIdx = 0; deviceIdx < MaxPalDevices; deviceIdx++)
+    {
+        if (m_pEventRecycleCmdBuffers[deviceIdx] != nullptr)
+        {
+            m_pEventRecycleCmdBuffers[deviceIdx]->Destroy();
+            m_pDevice->VkInstance()->FreeMem(m_pEventRecycleCmdBuffers[deviceIdx]);
+        }
+    }
+
+    if (m_pStackAllocator != nullptr)
+    {
+        // Release the stack allocator
+        m_pDevice->VkInstance()->StackMgr()->ReleaseAllocator(m_pStackAllocator);
+    }
+
+    if (m_pPalQueues != nullptr)
+    {
+        for (uint32_t i = 0; i < m_pDevice->NumPalDevices(); i++)
+        {
+            PalQueue(i)->Destroy();
+        }
+    }
+
+}
+
+// =====================================================================================================================
+// Initializes the locks of the queue
+Pal::Result Queue::Init()
+{
+    Pal::Result palResult = m_submitFenceLock.Init();
+
+    if (palResult == Pal::Result::Success)
+    {
+        palResult = m_deferLock.Init();
+    }
+
+    if (palResult == Pal::Result::Success)
+    {
+        palResult = m_retireLock.Init();
+    }
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Marks all submissions up to and including the given serial as complete.  Fences of this queue may be observed
+// signaled from several threads at once, so the update must not let an older serial overwrite a newer one.
+void Queue::RetireSubmissions(
+    uint64_t serial)
+{
+    Util::MutexAuto lock(&m_retireLock);
+
+    if (serial > m_retiredSubmitSerial)
+    {
+        m_retiredSubmitSerial = serial;
+    }
+}
+
+// =====================================================================================================================
+// Returns a fence of this queue to track a new submission with.  Fences already known to be signaled are reused, and
+// a new one is created if all of them are still in flight.
+Pal::Result Queue::AcquireSubmitFence(
+    SubmitFence** ppSubmitFence)
+{
+    Pal::Result  palResult    = Pal::Result::Success;
+    SubmitFence* pSubmitFence = nullptr;
+
+    {
+        Util::MutexAuto lock(&m_submitFenceLock);
+
+        for (SubmitFence** ppLink = &m_pSubmitFences; (*ppLink != nullptr) && (pSubmitFence == nullptr);)
+        {
+            SubmitFence* pCandidate = *ppLink;
+
+            if ((pCandidate->submitted == false) || (pCandidate->pPalFence->GetStatus() == Pal::Result::Success))
+            {
+                if (pCandidate->submitted)
+                {
+                    RetireSubmissions(pCandidate->serial);
+                }
+
+                *ppLink      = pCandidate->pNext;
+                pSubmitFence = pCandidate;
+            }
+            else
+            {
+                ppLink = &pCandidate->pNext;
+            }
+        }
+    }
+
+    if (pSubmitFence != nullptr)
+    {
+        if (pSubmitFence->submitted)
+        {
+            palResult = m_pDevice->PalDevice(DefaultDeviceIndex)->ResetFences(1, &pSubmitFence->pPalFence);
+        }
+    }
+    else
+    {
+        Pal::IDevice* const        pPalDevice      = m_pDevice->PalDevice(DefaultDeviceIndex);
+        const Pal::FenceCreateInfo fenceCreateInfo = {};
+
+        void* pMemory = m_pDevice->VkInstance()->AllocMem(sizeof(SubmitFence) + pPalDevice->GetFenceSize(nullptr),
+                                                          VK_DEFAULT_MEM_ALIGN,
+                                                          VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+
+        if (pMemory != nullptr)
+        {
+            pSubmitFence = static_cast<SubmitFence*>(pMemory);
+
+            palResult = pPalDevice->CreateFence(fenceCreateInfo,
+                                                Util::VoidPtrInc(pMemory, sizeof(SubmitFence)),
+                                                &pSubmitFence->pPalFence);
+
+            if (palResult != Pal::Result::Success)
+            {
+                m_pDevice->VkInstance()->FreeMem(pMemory);
+
+                pSubmitFence = nullptr;
+            }
+        }
+        else
+        {
+            palResult = Pal::Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (pSubmitFence != nullptr)
+    {
+        pSubmitFence->serial    = 0;
+        pSubmitFence->submitted = false;
+        pSubmitFence->pNext     = nullptr;
+
+        if (palResult != Pal::Result::Success)
+        {
+            CommitSubmitFence(pSubmitFence, 0, false);
+
+            pSubmitFence = nullptr;
+        }
+    }
+
+    *ppSubmitFence = pSubmitFence;
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Returns a fence obtained from AcquireSubmitFence() to the queue, recording the submission it tracks if it was
+// submitted.
+void Queue::CommitSubmitFence(
+    SubmitFence* pSubmitFence,
+    uint64_t     serial,
+    bool         submitted)
+{
+    Util::MutexAuto lock(&m_submitFenceLock);
+
+    pSubmitFence->serial    = serial;
+    pSubmitFence->submitted = submitted;
+    pSubmitFence->pNext     = m_pSubmitFences;
+
+    m_pSubmitFences = pSubmitFence;
+}
+
+// =====================================================================================================================
+// Returns true if the submission with the given serial is known to be complete, checking the fences that track
+// timeline semaphore signals of this queue.
+bool Queue::IsSubmissionComplete(
+    uint64_t serial)
+{
+    if (IsSubmissionRetired(serial) == false)
+    {
+        Util::MutexAuto lock(&m_submitFenceLock);
+
+        for (const SubmitFence* pSubmitFence = m_pSubmitFences;
+             (pSubmitFence != nullptr) && (IsSubmissionRetired(serial) == false);
+             pSubmitFence = pSubmitFence->pNext)
+        {
+            if (pSubmitFence->submitted &&
+                (pSubmitFence->serial >= serial) &&
+                (pSubmitFence->pPalFence->GetStatus() == Pal::Result::Success))
+            {
+                RetireSubmissions(pSubmitFence->serial);
+            }
+        }
+    }
+
+    return IsSubmissionRetired(serial);
+}
+
+// =====================================================================================================================
+// Returns the fence of this queue that signals first once the submission with the given serial completes, or null if
+// no fence tracks the submission.  The fence may be reused once it signals, which retires the serial first, so waiting
+// on it outside the lock at worst waits for a later submission.
+Pal::IFence* Queue::FindSubmissionFence(
+    uint64_t  serial,
+    uint64_t* pFenceSerial)
+{
+    Pal::IFence* pPalFence   = nullptr;
+    uint64_t     fenceSerial = 0;
+
+    Util::MutexAuto lock(&m_submitFenceLock);
+
+    // The earliest fence submitted after the submission is signaled first
+    for (const SubmitFence* pSubmitFence = m_pSubmitFences; pSubmitFence != nullptr; pSubmitFence = pSubmitFence->pNext)
+    {
+        if (pSubmitFence->submitted &&
+            (pSubmitFence->serial >= serial) &&
+            ((pPalFence == nullptr) || (pSubmitFence->serial < fenceSerial)))
+        {
+            pPalFence   = pSubmitFence->pPalFence;
+            fenceSerial = pSubmitFence->serial;
+        }
+    }
+
+    if (pFenceSerial != nullptr)
+    {
+        *pFenceSerial = fenceSerial;
+    }
+
+    return pPalFence;
+}
+
+// =====================================================================================================================
+// Waits on the host for the submission with the given serial to complete, or the timeout (in nanoseconds) to expire.
+// Returns ErrorFenceNeverSubmitted if no fence tracks the submission.
+Pal::Result Queue::WaitForSubmission(
+    uint64_t serial,
+    uint64_t timeout)
+{
+    Pal::Result palResult = Pal::Result::Success;
+
+    if (IsSubmissionRetired(serial) == false)
+    {
+        uint64_t           fenceSerial = 0;
+        Pal::IFence* const pPalFence   = FindSubmissionFence(serial, &fenceSerial);
+
+        if (pPalFence != nullptr)
+        {
+            palResult = m_pDevice->PalDevice(DefaultDeviceIndex)->WaitForFences(1, &pPalFence, true, timeout);
+
+            if (palResult == Pal::Result::Success)
+            {
+                RetireSubmissions(fenceSerial);
+            }
+        }
+        else
+        {
+            palResult = IsSubmissionRetired(serial) ? Pal::Result::Success : Pal::Result::ErrorFenceNeverSubmitted;
+        }
+    }
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Holds back a queue operation that waits on a timeline semaphore value no signal has been submitted for, along with
+// all operations submitted to the queue after it.  The operation's infos are deep-copied since they need to outlive
+// the API call.  Must be called with m_deferLock held.
+VkResult Queue::DeferOp(
+    DeferredOpType type,
+    uint32_t       infoCount,
+    const void*    pInfos,
+    VkFence        fence)
+{
+    VkResult result = VK_SUCCESS;
+
+    const size_t headerSize = Util::Pow2Align(sizeof(DeferredOp), VK_DEFAULT_MEM_ALIGN);
+
+    // Measure the copy of the infos first
+    DeferredOpWriter sizeWriter(nullptr);
+
+    switch (type)
+    {
+    case DeferredOpType::Submit:
+        CopySubmitInfos(&sizeWriter, infoCount, static_cast<const VkSubmitInfo*>(pInfos));
+        break;
+    case DeferredOpType::BindSparse:
+        CopyBindSparseInfos(&sizeWriter, infoCount, static_cast<const VkBindSparseInfo*>(pInfos));
+        break;
+    default:
+        VK_NEVER_CALLED();
+        break;
+    }
+
+    void* pMemory = m_pDevice->VkInstance()->AllocMem(headerSize + sizeWriter.Size(),
+                                                      VK_DEFAULT_MEM_ALIGN,
+                                                      VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+
+    if (pMemory != nullptr)
+    {
+        DeferredOp*      pOp = static_cast<DeferredOp*>(pMemory);
+        DeferredOpWriter writer(Util::VoidPtrInc(pMemory, headerSize));
+
+        pOp->type      = type;
+        pOp->infoCount = infoCount;
+        pOp->fence     = fence;
+        pOp->pNext     = nullptr;
+
+        switch (type)
+        {
+        case DeferredOpType::Submit:
+            pOp->pSubmits = CopySubmitInfos(&writer, infoCount, static_cast<const VkSubmitInfo*>(pInfos));
+            break;
+        case DeferredOpType::BindSparse:
+            pOp->pBindInfos = CopyBindSparseInfos(&writer, infoCount, static_cast<const VkBindSparseInfo*>(pInfos));
+            break;
+        default:
+            VK_NEVER_CALLED();
+            break;
+        }
+
+        if (fence != VK_NULL_HANDLE)
+        {
+            Fence::ObjectFromHandle(fence)->SetSubmissionResult(VK_SUCCESS);
+            Fence::ObjectFromHandle(fence)->SetSubmissionDeferred(true);
+        }
+
+        if (m_pDeferredTail == nullptr)
+        {
+            m_pDeferredHead = pOp;
+        }
+        else
+        {
+            m_pDeferredTail->pNext = pOp;
+        }
+
+        m_pDeferredTail = pOp;
+
+        Util::AtomicIncrement(&m_deferredOpCount);
+
+        // The signal may have been submitted by another thread while the operation was being copied
+        FlushDeferredOps();
+    }
+    else
+    {
+        result = VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Sends the deferred operations at the front of the queue whose timeline semaphore waits all have a signal submitted
+// now to PAL.  Errors are reported through the fences and timeline semaphores of the failed operations, see
+// ReportDeferredResult().  Must be called with m_deferLock held.
+void Queue::FlushDeferredOps()
+{
+    bool ready    = true;
+    bool released = false;
+
+    while ((m_pDeferredHead != nullptr) && ready)
+    {
+        DeferredOp* pOp = m_pDeferredHead;
+
+        switch (pOp->type)
+        {
+        case DeferredOpType::Submit:
+            ready = (HasUnsignaledTimelineWait(pOp->infoCount, pOp->pSubmits) == false);
+            break;
+        case DeferredOpType::BindSparse:
+            ready = (HasUnsignaledTimelineWait(pOp->infoCount, pOp->pBindInfos) == false);
+            break;
+        default:
+            VK_NEVER_CALLED();
+            break;
+        }
+
+        if (ready)
+        {
+            m_pDeferredHead = pOp->pNext;
+
+            if (m_pDeferredHead == nullptr)
+            {
+                m_pDeferredTail = nullptr;
+            }
+
+            VkResult result = VK_SUCCESS;
+
+            switch (pOp->type)
+            {
+            case DeferredOpType::Submit:
+                result = SubmitBatches(pOp->infoCount, pOp->pSubmits, pOp->fence);
+                break;
+            case DeferredOpType::BindSparse:
+                result = BindSparseBatches(pOp->infoCount, pOp->pBindInfos, pOp->fence);
+                break;
+            default:
+                VK_NEVER_CALLED();
+                break;
+            }
+
+            if (result != VK_SUCCESS)
+            {
+                ReportDeferredResult(pOp, result);
+            }
+
+            if (pOp->fence != VK_NULL_HANDLE)
+            {
+                Fence::ObjectFromHandle(pOp->fence)->SetSubmissionDeferred(false);
+            }
+
+            Util::AtomicDecrement(&m_deferredOpCount);
+
+            m_pDevice->VkInstance()->FreeMem(pOp);
+
+            released = true;
+        }
+    }
+
+    // Wake up host waits on the fences of the released operations
+    if (released)
+    {
+        m_pDevice->NotifyTimelineProgress();
+    }
+}
+
+// =====================================================================================================================
+// Reports the error of a deferred operation that failed once released, since its API call has already returned.  The
+// fence of the operation returns the error from then on, and so do host waits on timeline semaphore values it was to
+// signal.
+void Queue::ReportDeferredResult(
+    const DeferredOp* pOp,
+    VkResult          result)
+{
+    if (pOp->fence != VK_NULL_HANDLE)
+    {
+        Fence::ObjectFromHandle(pOp->fence)->SetSubmissionResult(result);
+    }
+
+    bool timelineFailed = false;
+
+    for (uint32_t i = 0; i < pOp->infoCount; ++i)
+    {
+        const bool         isSubmit    = (pOp->type == DeferredOpType::Submit);
+        const uint32_t     signalCount = isSubmit ? pOp->pSubmits[i].signalSemaphoreCount
+                                                  : pOp->pBindInfos[i].signalSemaphoreCount;
+        const VkSemaphore* pSignals    = isSubmit ? pOp->pSubmits[i].pSignalSemaphores
+                                                  : pOp->pBindInfos[i].pSignalSemaphores;
+
+        for (uint32_t j = 0; j < signalCount; ++j)
+        {
+            Semaphore* pSemaphore = Semaphore::ObjectFromHandle(pSignals[j]);
+
+            if (pSemaphore->IsTimeline())
+            {
+                pSemaphore->SetTimelineError(result);
+
+                timelineFailed = true;
+            }
+        }
+    }
+
+    // Queue operations held back on the values that are never going to be signaled now may proceed
+    if (timelineFailed)
+    {
+        m_pDevice->ReleaseTimelineWaits();
+    }
+}
+
+// =====================================================================================================================
+// Called after a timeline semaphore signal was submitted, to release the deferred operations it may satisfy.  If
+// another thread is using the queue, that thread is left to do it once it's done.
+void Queue::RequestDeferredFlush()
+{
+    if (m_deferredOpCount > 0)
+    {
+        m_flushRequested = 1;
+
+        ProcessDeferredFlushRequests();
+    }
+}
+
+// =====================================================================================================================
+// Flushes the deferred operations if a flush was requested while m_deferLock was held.  Must be called without
+// m_deferLock held.
+void Queue::ProcessDeferredFlushRequests()
+{
+    while ((m_flushRequested != 0) && m_deferLock.TryLock())
+    {
+        m_flushRequested = 0;
+
+        FlushDeferredOps();
+
+        m_deferLock.Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Submits command buffer batches to the queue.  If a batch waits on a timeline semaphore value that no signal has been
+// submitted for yet, the whole submission is held back on the queue until one is, along with any later operations on
+// the queue.
+VkResult Queue::Submit(
+    uint32_t            submitCount,
+    const VkSubmitInfo* pSubmits,
+    VkFence             fence)
 {
-    if (m_pDummyCmdBuffer != nullptr)
+    VkResult result = VK_SUCCESS;
+
+    m_deferLock.Lock();
+
+    FlushDeferredOps();
+
+    if ((m_pDeferredHead != nullptr) || HasUnsignaledTimelineWait(submitCount, pSubmits))
     {
-        m_pDummyCmdBuffer->Destroy();
-        m_pDevice->VkInstance()->FreeMem(m_pDummyCmdBuffer);
+        result = DeferOp(DeferredOpType::Submit, submitCount, pSubmits, fence);
+    }
+    else
+    {
+        result = SubmitBatches(submitCount, pSubmits, fence);
     }
 
-    if (m_pStackAllocator != nullptr)
+    m_deferLock.Unlock();
+
+    ProcessDeferredFlushRequests();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Updates sparse bindings, held back on the queue like Submit() while a batch waits on an unsignaled timeline value.
+VkResult Queue::BindSparse(
+    uint32_t                bindInfoCount,
+    const VkBindSparseInfo* pBindInfo,
+    VkFence                 fence)
+{
+    VkResult result = VK_SUCCESS;
+
+    m_deferLock.Lock();
+
+    FlushDeferredOps();
+
+    if ((m_pDeferredHead != nullptr) || HasUnsignaledTimelineWait(bindInfoCount, pBindInfo))
     {
-        // Release the stack allocator
-        m_pDevice->VkInstance()->StackMgr()->ReleaseAllocator(m_pStackAllocator);
+        result = DeferOp(DeferredOpType::BindSparse, bindInfoCount, pBindInfo, fence);
+    }
+    else
+    {
+        result = BindSparseBatches(bindInfoCount, pBindInfo, fence);
     }
 
-    if (m_pPalQueues != nullptr)
+    m_deferLock.Unlock();
+
+    ProcessDeferredFlushRequests();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Presents swap chain images.  Presents only wait on binary semaphores, but one behind a held back operation has to
+// wait for that to be released to keep the queue order.  It does so on the host rather than being held back itself so
+// that its results are reported by this call.
+VkResult Queue::Present(
+    const VkPresentInfoKHR* pPresentInfo)
+{
+    if (pPresentInfo == nullptr)
     {
-        for (uint32_t i = 0; i < m_pDevice->NumPalDevices(); i++)
-        {
-            PalQueue(i)->Destroy();
-        }
+        return VK_ERROR_INITIALIZATION_FAILED;
     }
 
+    m_deferLock.Lock();
+
+    WaitForDeferredOps();
+
+    const VkResult result = PresentImages(pPresentInfo);
+
+    m_deferLock.Unlock();
+
+    ProcessDeferredFlushRequests();
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -136,6 +1041,125 @@ VkResult Queue::CreateDummyCmdBuffer()
     return PalToVkResult(palResult);
 }
 
+// =====================================================================================================================
+// Create the command buffer used to wait for previous work on this queue before command buffers which reuse internal
+// GPU events are executed again
+VkResult Queue::CreateEventRecycleCmdBuffer(
+    uint32_t deviceIdx)
+{
+    Pal::Result palResult = Pal::Result::ErrorUnknown;
+
+    Pal::CmdBufferCreateInfo palCreateInfo = {};
+    palCreateInfo.pCmdAllocator = m_pDevice->GetSharedCmdAllocator(deviceIdx);
+    palCreateInfo.queueType     = m_pDevice->GetQueueFamilyPalQueueType(m_queueFamilyIndex);
+    palCreateInfo.engineType    = m_pDevice->GetQueueFamilyPalEngineType(m_queueFamilyIndex);
+
+    Pal::IDevice* const pPalDevice = m_pDevice->PalDevice(deviceIdx);
+    const size_t palSize = pPalDevice->GetCmdBufferSize(palCreateInfo, &palResult);
+    if (palResult == Pal::Result::Success)
+    {
+        void* pMemory = m_pDevice->VkInstance()->AllocMem(palSize, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        if (pMemory != nullptr)
+        {
+            Pal::ICmdBuffer* pCmdBuffer = nullptr;
+
+            palResult = pPalDevice->CreateCmdBuffer(palCreateInfo, pMemory, &pCmdBuffer);
+            if (palResult == Pal::Result::Success)
+            {
+                Pal::CmdBufferBuildInfo buildInfo = {};
+                buildInfo.flags.optimizeExclusiveSubmit = 1;
+                palResult = pCmdBuffer->Begin(buildInfo);
+                if (palResult == Pal::Result::Success)
+                {
+                    // This is the barrier GpuEventMgr used to record at the first event request of a command buffer
+                    // that can be submitted multiple times.
+                    Pal::BarrierInfo barrier = {};
+                    Pal::HwPipePoint signalPoint = Pal::HwPipeTop;
+
+                    barrier.flags.u32All          = 0;
+                    barrier.waitPoint             = Pal::HwPipeTop;
+                    barrier.pipePointWaitCount    = 1;
+                    barrier.pPipePoints           = &signalPoint;
+                    barrier.pSplitBarrierGpuEvent = nullptr;
+
+                    pCmdBuffer->CmdBarrier(barrier);
+
+                    palResult = pCmdBuffer->End();
+                }
+
+                if (palResult == Pal::Result::Success)
+                {
+                    m_pEventRecycleCmdBuffers[deviceIdx] = pCmdBuffer;
+                }
+                else
+                {
+                    pCmdBuffer->Destroy();
+                    m_pDevice->VkInstance()->FreeMem(pMemory);
+                }
+            }
+            else
+            {
+                m_pDevice->VkInstance()->FreeMem(pMemory);
+            }
+        }
+        else
+        {
+            palResult = Pal::Result::ErrorOutOfMemory;
+        }
+    }
+
+    return PalToVkResult(palResult);
+}
+
+// =====================================================================================================================
+// Determines which command buffers of a batch need to wait for previous work on this queue before they are executed.
+// This is the case for a command buffer reusing internal GPU events if its previous execution is not known to be
+// complete (i.e. no fence it was submitted with has been observed signaled and the queue has not been idled since), or
+// if it already appears earlier in the same batch.  One wait covers all work submitted before it, so later command
+// buffers only need another one for such repeated occurrences.  Returns whether any wait is needed.
+bool Queue::NeedEventRecycleWaits(
+    uint32_t               cmdBufferCount,
+    const VkCommandBuffer* pCommandBuffers,
+    bool*                  pNeedWait)
+{
+    bool     anyWait   = false;
+    uint32_t waitStart = 0; // First command buffer not covered by the last wait
+
+    for (uint32_t i = 0; i < cmdBufferCount; ++i)
+    {
+        const CmdBuffer* pCmdBuf = ApiCmdBuffer::ObjectFromHandle(pCommandBuffers[i]);
+
+        pNeedWait[i] = false;
+
+        if (pCmdBuf->UsesRecyclableGpuEvents())
+        {
+            if (anyWait == false)
+            {
+                const Queue* pLastQueue = pCmdBuf->GetLastSubmitQueue();
+
+                // Waits are not needed for the first execution since recording or if the previous one has retired
+                pNeedWait[i] = (pLastQueue != nullptr) &&
+                               ((pLastQueue != this) || (IsSubmissionRetired(pCmdBuf->GetLastSubmitSerial()) == false));
+            }
+
+            for (uint32_t j = waitStart; (j < i) && (pNeedWait[i] == false); ++j)
+            {
+                pNeedWait[i] = (pCommandBuffers[j] == pCommandBuffers[i]);
+            }
+
+            if (pNeedWait[i])
+            {
+                anyWait   = true;
+                waitStart = i;
+            }
+
+            m_pDevice->RecordEventRecycleWait(pNeedWait[i]);
+        }
+    }
+
+    return anyWait;
+}
+
 // =====================================================================================================================
 // Submit a dummy command buffer with associated command buffer info to KMD for FRTC/TurboSync/DVR features
 VkResult Queue::NotifyFlipMetadata(
@@ -205,7 +1229,7 @@ VkResult Queue::NotifyFlipMetadataAfterPresent(
 
 // =====================================================================================================================
 // Submit an array of command buffers to a queue
-VkResult Queue::Submit(
+VkResult Queue::SubmitBatches(
     uint32_t            submitCount,
     const VkSubmitInfo* pSubmits,
     VkFence             fence)
@@ -244,6 +1268,11 @@ VkResult Queue::Submit(
         palResult = PalQueue()->Submit(submitInfo);
 
         result = PalToVkResult(palResult);
+
+        if (result == VK_SUCCESS)
+        {
+            pFence->SetQueueSubmission(this, m_lastSubmitSerial);
+        }
     }
     else
     {
@@ -251,12 +1280,14 @@ VkResult Queue::Submit(
         {
             const VkSubmitInfo& submitInfo = pSubmits[submitIdx];
             const VkDeviceGroupSubmitInfoKHX* pDeviceGroupInfo = nullptr;
+            const VkTimelineSemaphoreSubmitInfoKHR* pTimelineInfo = nullptr;
             {
                 union
                 {
                     const VkStructHeader*                          pHeader;
                     const VkSubmitInfo*                            pVkSubmitInfo;
                     const VkDeviceGroupSubmitInfoKHX*              pVkDeviceGroupSubmitInfoKHX;
+                    const VkTimelineSemaphoreSubmitInfoKHR*        pVkTimelineSemaphoreSubmitInfoKHR;
                 };
 
                 for (pVkSubmitInfo = &submitInfo; pHeader != nullptr; pHeader = pHeader->pNext)
@@ -266,6 +1297,9 @@ VkResult Queue::Submit(
                     case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHX:
                         pDeviceGroupInfo = pVkDeviceGroupSubmitInfoKHX;
                         break;
+                    case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR:
+                        pTimelineInfo = pVkTimelineSemaphoreSubmitInfoKHR;
+                        break;
                     default:
                         // Skip any unknown extension structures
                         break;
@@ -273,10 +1307,21 @@ VkResult Queue::Submit(
                 }
             }
 
+            // Payload values of timeline semaphores, ignored for binary semaphores
+            const uint64_t* pWaitValues   = nullptr;
+            const uint64_t* pSignalValues = nullptr;
+
+            if (pTimelineInfo != nullptr)
+            {
+                pWaitValues   = pTimelineInfo->pWaitSemaphoreValues;
+                pSignalValues = pTimelineInfo->pSignalSemaphoreValues;
+            }
+
             if ((result == VK_SUCCESS) && (submitInfo.waitSemaphoreCount > 0))
             {
                 result = PalWaitSemaphores(submitInfo.waitSemaphoreCount,
                                            submitInfo.pWaitSemaphores,
+                                           pWaitValues,
                                            pDeviceGroupInfo);
             }
 
@@ -284,8 +1329,9 @@ VkResult Queue::Submit(
             const VkCommandBuffer* pCmdBuffers = submitInfo.pCommandBuffers;
             const uint32_t cmdBufferCount      = submitInfo.commandBufferCount;
 
+            // Each command buffer may be preceded by the event recycle barrier
             Pal::ICmdBuffer** pPalCmdBuffers = (cmdBufferCount > 0) ?
-                            virtStackFrame.AllocArray<Pal::ICmdBuffer*>(submitInfo.commandBufferCount) : nullptr;
+                            virtStackFrame.AllocArray<Pal::ICmdBuffer*>(cmdBufferCount * 2) : nullptr;
 
             result = ((pPalCmdBuffers != nullptr) || (cmdBufferCount == 0)) ? result : VK_ERROR_OUT_OF_HOST_MEMORY;
 
@@ -300,6 +1346,34 @@ VkResult Queue::Submit(
 
             const uint32_t deviceCount = (pDeviceGroupInfo == nullptr) ? 1 : m_pDevice->NumPalDevices();
 
+            // Command buffers reusing internal GPU events are preceded by a barrier in the same submission if their
+            // previous execution may still be in flight.
+            bool* pNeedEventRecycleWait = (cmdBufferCount > 0) ?
+                            virtStackFrame.AllocArray<bool>(cmdBufferCount) : nullptr;
+            bool  needEventRecycleWait  = false;
+
+            result = ((pNeedEventRecycleWait != nullptr) || (cmdBufferCount == 0)) ?
+                     result : VK_ERROR_OUT_OF_HOST_MEMORY;
+
+            if (result == VK_SUCCESS)
+            {
+                needEventRecycleWait = NeedEventRecycleWaits(cmdBufferCount, pCmdBuffers, pNeedEventRecycleWait);
+            }
+
+            // Host waits on the timeline semaphores signaled by this batch and on the timestamps it writes, and the
+            // reuse of the signal points of the timeline semaphores it waits on, track its completion with a fence of
+            // this queue.  It is submitted along with the batch unless the application fence already is.
+            SubmitFence* pSubmitFence    = nullptr;
+            bool         submitFenceUsed = false;
+
+            if ((result == VK_SUCCESS) &&
+                (HasTimelineSemaphore(submitInfo.signalSemaphoreCount, submitInfo.pSignalSemaphores) ||
+                 HasTimelineSemaphore(submitInfo.waitSemaphoreCount, submitInfo.pWaitSemaphores)     ||
+                 WritesTimestamps(cmdBufferCount, pCmdBuffers)))
+            {
+                result = PalToVkResult(AcquireSubmitFence(&pSubmitFence));
+            }
+
             for (uint32_t deviceIdx = 0; (deviceIdx < deviceCount) && (result == VK_SUCCESS); deviceIdx++)
             {
                 // Get the PAL command buffer object from each Vulkan object and put it
@@ -307,15 +1381,25 @@ VkResult Queue::Submit(
                 DispatchableCmdBuffer* const * pCommandBuffers =
                     reinterpret_cast<DispatchableCmdBuffer*const*>(submitInfo.pCommandBuffers);
 
+                if (needEventRecycleWait && (m_pEventRecycleCmdBuffers[deviceIdx] == nullptr))
+                {
+                    result = CreateEventRecycleCmdBuffer(deviceIdx);
+                }
+
                 if (pDeviceGroupInfo == nullptr)
                 {
-                    palSubmitInfo.cmdBufferCount = cmdBufferCount;
+                    palSubmitInfo.cmdBufferCount = 0;
 
                     for (uint32_t i = 0; i < cmdBufferCount; ++i)
                     {
                         const CmdBuffer& cmdBuf = *(*pCommandBuffers[i]);
 
-                        pPalCmdBuffers[i] = cmdBuf.PalCmdBuffer(deviceIdx);
+                        if (pNeedEventRecycleWait[i])
+                        {
+                            pPalCmdBuffers[palSubmitInfo.cmdBufferCount++] = m_pEventRecycleCmdBuffers[deviceIdx];
+                        }
+
+                        pPalCmdBuffers[palSubmitInfo.cmdBufferCount++] = cmdBuf.PalCmdBuffer(deviceIdx);
                     }
                 }
                 else
@@ -334,18 +1418,30 @@ VkResult Queue::Submit(
                             continue;
                         }
 
+                        if (pNeedEventRecycleWait[i])
+                        {
+                            pPalCmdBuffers[palSubmitInfo.cmdBufferCount++] = m_pEventRecycleCmdBuffers[deviceIdx];
+                        }
+
                         pPalCmdBuffers[palSubmitInfo.cmdBufferCount++] = cmdBuf.PalCmdBuffer(deviceIdx);
                     }
                 }
 
+                palSubmitInfo.pFence = nullptr;
+
                 if (lastBatch && (pFence != nullptr))
                 {
                     palSubmitInfo.pFence = pFence->PalFence(deviceIdx);
 
                     pFence->SetActiveDevice(deviceIdx);
                 }
+                else if ((pSubmitFence != nullptr) && (deviceIdx == DefaultDeviceIndex))
+                {
+                    palSubmitInfo.pFence = pSubmitFence->pPalFence;
+                    submitFenceUsed      = true;
+                }
 
-                if ((palSubmitInfo.cmdBufferCount > 0) || (palSubmitInfo.pFence != nullptr))
+                if ((result == VK_SUCCESS) && ((palSubmitInfo.cmdBufferCount > 0) || (palSubmitInfo.pFence != nullptr)))
                 {
                     Pal::Result palResult = Pal::Result::Success;
 
@@ -371,12 +1467,49 @@ VkResult Queue::Submit(
 
             }
 
+            virtStackFrame.FreeArray(pNeedEventRecycleWait);
             virtStackFrame.FreeArray(pPalCmdBuffers);
 
+            if ((result == VK_SUCCESS) && (pSubmitFence != nullptr) && (submitFenceUsed == false))
+            {
+                Pal::SubmitInfo fenceSubmitInfo = {};
+
+                fenceSubmitInfo.pFence = pSubmitFence->pPalFence;
+
+                result          = PalToVkResult(PalQueue(DefaultDeviceIndex)->Submit(fenceSubmitInfo));
+                submitFenceUsed = true;
+            }
+
+            if (result == VK_SUCCESS)
+            {
+                // Track the submission so that internal GPU events of these command buffers can be recycled without a
+                // wait once it is known to be complete, and so that the timestamps they write can be waited for.
+                ++m_lastSubmitSerial;
+
+                for (uint32_t i = 0; i < cmdBufferCount; ++i)
+                {
+                    CmdBuffer* pCmdBuf = ApiCmdBuffer::ObjectFromHandle(pCmdBuffers[i]);
+
+                    pCmdBuf->SetLastSubmit(this, m_lastSubmitSerial);
+                    pCmdBuf->SetTimestampSubmit(this, m_lastSubmitSerial);
+                }
+
+                if (lastBatch && (pFence != nullptr))
+                {
+                    pFence->SetQueueSubmission(this, m_lastSubmitSerial);
+                }
+            }
+
+            if (pSubmitFence != nullptr)
+            {
+                CommitSubmitFence(pSubmitFence, m_lastSubmitSerial, submitFenceUsed && (result == VK_SUCCESS));
+            }
+
             if ((result == VK_SUCCESS) && (submitInfo.signalSemaphoreCount > 0))
             {
                 result = PalSignalSemaphores(submitInfo.signalSemaphoreCount,
                                              submitInfo.pSignalSemaphores,
+                                             pSignalValues,
                                              pDeviceGroupInfo);
             }
 
@@ -385,17 +1518,54 @@ VkResult Queue::Submit(
     return result;
 }
 
+// =====================================================================================================================
+// Waits until every operation held back on this queue has been sent to PAL.  They are released by the signals they
+// wait on, from whichever thread submits those.  Must be called with m_deferLock held, which is released while waiting.
+void Queue::WaitForDeferredOps()
+{
+    for (bool waiting = true; waiting;)
+    {
+        // Sampled before flushing so that a signal submitted after that ends the wait below
+        const uint64_t progress = m_pDevice->GetTimelineProgress();
+
+        FlushDeferredOps();
+
+        waiting = (m_pDeferredHead != nullptr);
+
+        if (waiting)
+        {
+            m_deferLock.Unlock();
+
+            m_pDevice->WaitForTimelineProgress(progress, UINT64_MAX);
+
+            m_deferLock.Lock();
+        }
+    }
+}
+
 // =====================================================================================================================
 // Wait for a queue to go idle
 VkResult Queue::WaitIdle(void)
 {
     VK_ASSERT(m_pPalQueues != nullptr);
 
+    // Operations held back on timeline semaphore waits are part of the queue's work.  The lock also keeps other threads
+    // from flushing such operations to the PAL queue while it is waited on.
+    m_deferLock.Lock();
+
+    WaitForDeferredOps();
+
     for (uint32_t deviceIdx = 0; deviceIdx < m_pDevice->NumPalDevices(); deviceIdx++)
     {
         PalQueue(deviceIdx)->WaitIdle();
     }
 
+    RetireSubmissions(m_lastSubmitSerial);
+
+    m_deferLock.Unlock();
+
+    ProcessDeferredFlushRequests();
+
     // Pal::IQueue::WaitIdle returns void. We have no errors to produce here.
     return VK_SUCCESS;
 }
@@ -405,6 +1575,7 @@ VkResult Queue::WaitIdle(void)
 VkResult Queue::PalSignalSemaphores(
     uint32_t                          semaphoreCount,
     const VkSemaphore*                pSemaphores,
+    const uint64_t*                   pSemaphoreValues,
     const VkDeviceGroupSubmitInfoKHX* pDeviceGroupInfo)
 {
 #if ICD_GPUOPEN_DEVMODE_BUILD
@@ -415,7 +1586,8 @@ VkResult Queue::PalSignalSemaphores(
     bool timedQueueEvents = false;
 #endif
 
-    Pal::Result palResult = Pal::Result::Success;
+    Pal::Result palResult        = Pal::Result::Success;
+    bool        timelineSignaled = false;
 
     for (uint32_t i = 0; (i < semaphoreCount) && (palResult == Pal::Result::Success); ++i)
     {
@@ -427,7 +1599,15 @@ VkResult Queue::PalSignalSemaphores(
         Semaphore* pVkSemaphore = Semaphore::ObjectFromHandle(pSemaphores[i]);
         Pal::IQueueSemaphore* pPalSemaphore = pVkSemaphore->PalSemaphore();
 
-        if (timedQueueEvents == false)
+        if (pVkSemaphore->IsTimeline())
+        {
+            VK_ASSERT(pSemaphoreValues != nullptr);
+
+            palResult = SignalTimelineSemaphore(deviceIdx, pVkSemaphore, pSemaphoreValues[i]);
+
+            timelineSignaled = true;
+        }
+        else if (timedQueueEvents == false)
         {
             if (pVkSemaphore->PalTemporarySemaphore())
             {
@@ -448,6 +1628,12 @@ VkResult Queue::PalSignalSemaphores(
         }
     }
 
+    // Operations held back on any queue for these values may proceed now
+    if (timelineSignaled)
+    {
+        m_pDevice->ReleaseTimelineWaits();
+    }
+
     return  (palResult == Pal::Result::ErrorUnknown) ? VK_ERROR_DEVICE_LOST : PalToVkResult(palResult);
 }
 
@@ -456,6 +1642,7 @@ VkResult Queue::PalSignalSemaphores(
 VkResult Queue::PalWaitSemaphores(
     uint32_t                          semaphoreCount,
     const VkSemaphore*                pSemaphores,
+    const uint64_t*                   pSemaphoreValues,
     const VkDeviceGroupSubmitInfoKHX* pDeviceGroupInfo)
 {
     Pal::Result palResult = Pal::Result::Success;
@@ -478,8 +1665,17 @@ VkResult Queue::PalWaitSemaphores(
 
         VK_ASSERT(deviceIdx < m_pDevice->NumPalDevices());
 
+        if (pSemaphore->IsTimeline())
+        {
+            VK_ASSERT(pSemaphoreValues != nullptr);
+
+            // Null if the value has already been reached, in which case there is nothing to wait for.  The queue holds
+            // back batches until every timeline value they wait on has a signal submitted, so this never blocks.  The
+            // wait is part of the next submission on this queue, which the caller attaches a submit fence to.
+            pPalSemaphore = pSemaphore->AcquireTimelineWait(pSemaphoreValues[i], this, GetNextSubmitSerial());
+        }
         // Wait for the temporary semaphore.
-        if (pSemaphore->PalTemporarySemaphore() != nullptr)
+        else if (pSemaphore->PalTemporarySemaphore() != nullptr)
         {
             pPalSemaphore = pSemaphore->PalTemporarySemaphore();
             pSemaphore->SetPalTemporarySemaphore(nullptr);
@@ -505,6 +1701,12 @@ VkResult Queue::PalWaitSemaphores(
                 palResult = Pal::Result::ErrorUnknown;
 #endif
             }
+
+            // Re-signal the semaphore of a timeline signal point so that other queues waiting on it are released too.
+            if (pSemaphore->IsTimeline() && (palResult == Pal::Result::Success))
+            {
+                palResult = PalQueue(deviceIdx)->SignalQueueSemaphore(pPalSemaphore);
+            }
         }
 
     }
@@ -512,6 +1714,45 @@ VkResult Queue::PalWaitSemaphores(
     return PalToVkResult(palResult);
 }
 
+// =====================================================================================================================
+// Signals a timeline semaphore value once all previously submitted work on this queue completes.  A signal point of
+// the semaphore is signaled for queue waits; host waits track the completion of the last submission on this queue,
+// which the caller attached a submit fence to.
+Pal::Result Queue::SignalTimelineSemaphore(
+    uint32_t               deviceIdx,
+    Semaphore*             pSemaphore,
+    uint64_t               value)
+{
+    // Timeline signal points are created on the default device only
+    VK_ASSERT(deviceIdx == DefaultDeviceIndex);
+
+    Semaphore::TimelinePoint* pPoint = nullptr;
+
+    Pal::Result palResult = pSemaphore->AcquireTimelineSignal(m_pDevice, &pPoint);
+
+    // Consume the count left over from the previous use of this point before signaling it again
+    if ((palResult == Pal::Result::Success) && pPoint->needsDrain)
+    {
+        palResult = PalQueue(deviceIdx)->WaitQueueSemaphore(pPoint->pPalSemaphore);
+    }
+
+    if (palResult == Pal::Result::Success)
+    {
+        palResult = PalQueue(deviceIdx)->SignalQueueSemaphore(pPoint->pPalSemaphore);
+    }
+
+    if (pPoint != nullptr)
+    {
+        pSemaphore->ReleaseTimelineSignal(pPoint,
+                                          value,
+                                          this,
+                                          m_lastSubmitSerial,
+                                          (palResult == Pal::Result::Success));
+    }
+
+    return palResult;
+}
+
 // =====================================================================================================================
 // Update present flip status
 VkResult Queue::UpdateFlipStatus(
@@ -554,7 +1795,7 @@ bool Queue::NeedPacePresent(
 
 // =====================================================================================================================
 // Present a swap chain image
-VkResult Queue::Present(
+VkResult Queue::PresentImages(
     const VkPresentInfoKHR* pPresentInfo)
 {
     uint32_t presentationDeviceIdx = 0;
@@ -605,6 +1846,7 @@ VkResult Queue::Present(
         result = PalWaitSemaphores(
             pPresentInfo->waitSemaphoreCount,
             pPresentInfo->pWaitSemaphores,
+            nullptr,
             nullptr);
     }
 
@@ -953,7 +2195,7 @@ End:
 
 // =====================================================================================================================
 // Update sparse bindings.
-VkResult Queue::BindSparse(
+VkResult Queue::BindSparseBatches(
     uint32_t                bindInfoCount,
     const VkBindSparseInfo* pBindInfo,
     VkFence                 fence)
@@ -995,16 +2237,34 @@ VkResult Queue::BindSparse(
         pPalFence = pFence->PalFence();
     }
 
+    // Whether a timeline semaphore was waited on since the last commit of remaps
+    bool timelineWaited = false;
+
     for (uint32_t i = 0; (i < bindInfoCount) && (result == VK_SUCCESS); ++i)
     {
         const bool  lastEntry = (i == (bindInfoCount - 1));
         const auto& bindInfo  = pBindInfo[i];
 
+        const VkTimelineSemaphoreSubmitInfoKHR* pTimelineInfo = nullptr;
+
+        for (const VkStructHeader* pHeader = static_cast<const VkStructHeader*>(bindInfo.pNext);
+             pHeader != nullptr;
+             pHeader = pHeader->pNext)
+        {
+            if (static_cast<int32_t>(pHeader->sType) == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR)
+            {
+                pTimelineInfo = reinterpret_cast<const VkTimelineSemaphoreSubmitInfoKHR*>(pHeader);
+            }
+        }
+
         if (bindInfo.waitSemaphoreCount > 0)
         {
+            timelineWaited |= HasTimelineSemaphore(bindInfo.waitSemaphoreCount, bindInfo.pWaitSemaphores);
+
             result = PalWaitSemaphores(
                     bindInfo.waitSemaphoreCount,
                     bindInfo.pWaitSemaphores,
+                    (pTimelineInfo != nullptr) ? pTimelineInfo->pWaitSemaphoreValues : nullptr,
                     nullptr);
         }
 
@@ -1017,10 +2277,47 @@ VkResult Queue::BindSparse(
         // to signal a queue semaphore when operations complete.
         if (lastEntry || (bindInfo.signalSemaphoreCount > 0))
         {
+            // Host waits on timeline semaphores signaled here, and the reuse of the signal points of timeline
+            // semaphores waited on since the last commit, track the remaps with a fence of this queue.  It is committed
+            // along with them unless the application fence already is.
+            SubmitFence* pSubmitFence    = nullptr;
+            Pal::IFence* pCommitFence    = lastEntry ? pPalFence : nullptr;
+            bool         submitFenceUsed = false;
+
+            if ((result == VK_SUCCESS) &&
+                (HasTimelineSemaphore(bindInfo.signalSemaphoreCount, bindInfo.pSignalSemaphores) || timelineWaited))
+            {
+                timelineWaited = false;
+
+                result = PalToVkResult(AcquireSubmitFence(&pSubmitFence));
+
+                if ((pSubmitFence != nullptr) && (pCommitFence == nullptr))
+                {
+                    pCommitFence    = pSubmitFence->pPalFence;
+                    submitFenceUsed = true;
+                }
+            }
+
             // Commit any remaining remaps (this also signals the fence even if there are no remaining remaps)
             if (result == VK_SUCCESS)
             {
-                result = CommitVirtualRemapRanges(lastEntry ? pPalFence : nullptr, &remapState);
+                result = CommitVirtualRemapRanges(pCommitFence, &remapState);
+            }
+
+            if ((result == VK_SUCCESS) && (pSubmitFence != nullptr) && (submitFenceUsed == false))
+            {
+                result          = CommitVirtualRemapRanges(pSubmitFence->pPalFence, &remapState);
+                submitFenceUsed = true;
+            }
+
+            if (pSubmitFence != nullptr)
+            {
+                if (result == VK_SUCCESS)
+                {
+                    ++m_lastSubmitSerial;
+                }
+
+                CommitSubmitFence(pSubmitFence, m_lastSubmitSerial, submitFenceUsed && (result == VK_SUCCESS));
             }
 
             // Signal any semaphores depending on the preceding remap operations
@@ -1030,6 +2327,7 @@ VkResult Queue::BindSparse(
                 result = PalSignalSemaphores(
                     bindInfo.signalSemaphoreCount,
                     bindInfo.pSignalSemaphores,
+                    (pTimelineInfo != nullptr) ? pTimelineInfo->pSignalSemaphoreValues : nullptr,
                     nullptr);
             }
         }
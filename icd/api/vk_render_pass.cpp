@@ -42,7 +42,7 @@
 namespace vk
 {
 
-static uint64_t GenerateRenderPassHash(const VkRenderPassCreateInfo* pIn);
+static void GenerateRenderPassHash(const VkRenderPassCreateInfo* pIn, Util::Md5::Hash* pHash);
 
 struct RenderPassExtCreateInfo
 {
@@ -53,7 +53,8 @@ static void ConvertRenderPassCreateInfo(
     const VkRenderPassCreateInfo*  pIn,
     const RenderPassExtCreateInfo& renderPassExtCreateInfo,
     RenderPassCreateInfo*          pInfo,
-    VkAttachmentReference* const   pSubpassColorAttachments)
+    VkAttachmentReference* const   pSubpassColorAttachments,
+    Util::Md5::Hash*               pStructuralHash)
 {
     // !!! IMPORTANT !!!
     //
@@ -133,7 +134,9 @@ static void ConvertRenderPassCreateInfo(
         pInfo->pSubpassSampleCounts[subpassIndex].depthCount = subpassDepthSampleCount;
     }
 
-    pInfo->hash = GenerateRenderPassHash(pIn);
+    GenerateRenderPassHash(pIn, pStructuralHash);
+
+    pInfo->hash = Util::Md5::Compact64(pStructuralHash);
 }
 
 #define RPHashStructField(x) \
@@ -157,6 +160,12 @@ static void GenerateHashFromSubPassDesc(
     RPHashStructField(desc.colorAttachmentCount);
     RPHashStructField(desc.preserveAttachmentCount);
 
+    const bool hasResolves     = (desc.pResolveAttachments != nullptr) && (colorCount > 0);
+    const bool hasDepthStencil = (desc.pDepthStencilAttachment != nullptr);
+
+    RPHashStructField(hasResolves);
+    RPHashStructField(hasDepthStencil);
+
     if (inputCount > 0)
     {
         Util::Md5::Update(
@@ -178,14 +187,14 @@ static void GenerateHashFromSubPassDesc(
             reinterpret_cast<const uint8_t*>(desc.pPreserveAttachments),
             preserveCount * sizeof(desc.pPreserveAttachments[0]));
     }
-    if ((desc.pResolveAttachments != nullptr) && (colorCount > 0))
+    if (hasResolves)
     {
         Util::Md5::Update(
             pContext,
             reinterpret_cast<const uint8_t*>(desc.pResolveAttachments),
             colorCount * sizeof(desc.pResolveAttachments[0]));
     }
-    if (desc.pDepthStencilAttachment != nullptr)
+    if (hasDepthStencil)
     {
         Util::Md5::Update(
             pContext,
@@ -195,20 +204,17 @@ static void GenerateHashFromSubPassDesc(
 }
 
 // =====================================================================================================================
+// Hashes the structure of a render pass: its attachments, subpasses and dependencies.  Pointer values and structure
+// padding are excluded so that identical render passes created at different times produce identical hashes.
 void GenerateHashFromCreateInfo(
     Util::Md5::Context*           pContext,
     const VkRenderPassCreateInfo& info)
 {
-    VkRenderPassCreateInfo copy = info;
-
-    copy.pAttachments  = nullptr;
-    copy.pSubpasses    = nullptr;
-    copy.pDependencies = nullptr;
+    RPHashStructField(info.flags);
+    RPHashStructField(info.attachmentCount);
+    RPHashStructField(info.subpassCount);
+    RPHashStructField(info.dependencyCount);
 
-    Util::Md5::Update(
-        pContext,
-        reinterpret_cast<const uint8_t*>(&copy),
-        sizeof(copy));
     Util::Md5::Update(
         pContext,
         reinterpret_cast<const uint8_t*>(info.pAttachments),
@@ -225,25 +231,22 @@ void GenerateHashFromCreateInfo(
 }
 
 // =====================================================================================================================
-uint64_t GenerateRenderPassHash(
-    const VkRenderPassCreateInfo* pIn)
+void GenerateRenderPassHash(
+    const VkRenderPassCreateInfo* pIn,
+    Util::Md5::Hash*              pHash)
 {
-    if (pIn == nullptr)
-    {
-        return 0;
-    }
+    memset(pHash, 0, sizeof(*pHash));
 
-    Util::Md5::Context context = {};
-
-    Util::Md5::Init(&context);
-
-    GenerateHashFromCreateInfo(&context, *pIn);
+    if (pIn != nullptr)
+    {
+        Util::Md5::Context context = {};
 
-    Util::Md5::Hash hash = {};
+        Util::Md5::Init(&context);
 
-    Util::Md5::Final(&context, &hash);
+        GenerateHashFromCreateInfo(&context, *pIn);
 
-    return Util::Md5::Compact64(&hash);
+        Util::Md5::Final(&context, pHash);
+    }
 }
 
 // =====================================================================================================================
@@ -259,6 +262,7 @@ VkResult RenderPass::Create(
     utils::TempMemArena buildArena(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
 
     RenderPassCreateInfo info = {};
+    Util::Md5::Hash structuralHash = {};
     void* pMemory = nullptr;
     const auto& settings = pDevice->GetRuntimeSettings();
 
@@ -334,7 +338,8 @@ VkResult RenderPass::Create(
                 pRenderPassHeader,
                 renderPassExt,
                 &info,
-                pSubpassColorAttachments);
+                pSubpassColorAttachments,
+                &structuralHash);
         }
         else
         {
@@ -342,8 +347,12 @@ VkResult RenderPass::Create(
         }
     }
 
-    RenderPassExecuteInfo* pExecuteInfo = nullptr;
-    RenderPassLogger*      pLogger      = nullptr;
+    // Structurally identical render passes share their execute info through the device-level cache
+    RenderPassExecuteCache* pExecuteCache = settings.renderPassExecuteCacheEnable ?
+                                            pDevice->GetRenderPassExecuteCache() : nullptr;
+
+    const RenderPassExecuteInfo* pExecuteInfo = nullptr;
+    RenderPassLogger*            pLogger      = nullptr;
 
 #if ICD_LOG_RENDER_PASSES
     RenderPassLogger logger(&buildArena, pDevice);
@@ -355,12 +364,34 @@ VkResult RenderPass::Create(
     {
         RenderPassLogBegin(pLogger, *pCreateInfo, info);
 
-        RenderPassBuilder builder(pDevice, &buildArena, pLogger);
+        if (pExecuteCache != nullptr)
+        {
+            pExecuteInfo = pExecuteCache->Find(structuralHash);
+        }
+
+        if (pExecuteInfo == nullptr)
+        {
+            RenderPassExecuteInfo* pNewExecuteInfo = nullptr;
 
-        result = builder.Build(*pCreateInfo,
-                               info,
-                               pAllocator,
-                               &pExecuteInfo);
+            RenderPassBuilder builder(pDevice, &buildArena, pLogger);
+
+            // Shared execute infos may outlive this render pass, so they are allocated through the instance
+            result = builder.Build(*pCreateInfo,
+                                   info,
+                                   (pExecuteCache != nullptr) ? pDevice->VkInstance()->GetAllocCallbacks() : pAllocator,
+                                   &pNewExecuteInfo);
+
+            if ((result == VK_SUCCESS) && (pExecuteCache != nullptr))
+            {
+                pExecuteInfo = pExecuteCache->Insert(structuralHash, pNewExecuteInfo);
+
+                result = (pExecuteInfo != nullptr) ? VK_SUCCESS : VK_ERROR_OUT_OF_HOST_MEMORY;
+            }
+            else
+            {
+                pExecuteInfo = pNewExecuteInfo;
+            }
+        }
     }
 
     if (result == VK_SUCCESS)
@@ -372,7 +403,7 @@ VkResult RenderPass::Create(
 
     if (result == VK_SUCCESS)
     {
-        VK_PLACEMENT_NEW(pMemory) RenderPass(info, pExecuteInfo);
+        VK_PLACEMENT_NEW(pMemory) RenderPass(info, pExecuteInfo, (pExecuteCache != nullptr));
 
         *pRenderPass = RenderPass::HandleFromVoidPointer(pMemory);
     }
@@ -380,7 +411,14 @@ VkResult RenderPass::Create(
     {
         if (pExecuteInfo != nullptr)
         {
-            pAllocator->pfnFree(pAllocator->pUserData, pExecuteInfo);
+            if (pExecuteCache != nullptr)
+            {
+                pExecuteCache->Release(pExecuteInfo);
+            }
+            else
+            {
+                pAllocator->pfnFree(pAllocator->pUserData, const_cast<RenderPassExecuteInfo*>(pExecuteInfo));
+            }
         }
 
         if (pMemory != nullptr)
@@ -394,11 +432,13 @@ VkResult RenderPass::Create(
 
 // =====================================================================================================================
 RenderPass::RenderPass(
-    const RenderPassCreateInfo& info,
-    RenderPassExecuteInfo*      pExecuteInfo)
+    const RenderPassCreateInfo&  info,
+    const RenderPassExecuteInfo* pExecuteInfo,
+    bool                         sharedExecuteInfo)
     :
     m_createInfo(info),
-    m_pExecuteInfo(pExecuteInfo)
+    m_pExecuteInfo(pExecuteInfo),
+    m_sharedExecuteInfo(sharedExecuteInfo)
 {
 }
 
@@ -537,10 +577,17 @@ const VkAttachmentDescription& RenderPass::GetAttachmentDesc(
 // =====================================================================================================================
 // Destroys a render pass object
 VkResult RenderPass::Destroy(
-    const Device*                   pDevice,
+    Device*                         pDevice,
     const VkAllocationCallbacks*    pAllocator)
 {
-    pAllocator->pfnFree(pAllocator->pUserData, m_pExecuteInfo);
+    if (m_sharedExecuteInfo)
+    {
+        pDevice->GetRenderPassExecuteCache()->Release(m_pExecuteInfo);
+    }
+    else
+    {
+        pAllocator->pfnFree(pAllocator->pUserData, const_cast<RenderPassExecuteInfo*>(m_pExecuteInfo));
+    }
 
     // Call destructor
     Util::Destructor(this);
@@ -585,8 +632,8 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass(
 {
     if (renderPass != VK_NULL_HANDLE)
     {
-        const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        Device*                      pDevice  = ApiDevice::ObjectFromHandle(device);
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         RenderPass::ObjectFromHandle(renderPass)->Destroy(pDevice, pAllocCB);
     }
@@ -154,7 +154,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroySampler(
     if (sampler != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Sampler::ObjectFromHandle(sampler)->Destroy(pDevice, pAllocCB);
     }
@@ -27,7 +27,9 @@
 #include "include/vk_instance.h"
 #include "include/vk_semaphore.h"
 #include "include/vk_object.h"
+#include "include/vk_queue.h"
 
+#include "palFence.h"
 #include "palQueueSemaphore.h"
 
 namespace vk
@@ -41,31 +43,62 @@ VkResult Semaphore::Create(
     const VkAllocationCallbacks*    pAllocator,
     VkSemaphore*                    pSemaphore)
 {
+    union
+    {
+        const VkStructHeader*                 pHeader;
+        const VkSemaphoreCreateInfo*          pVkSemaphoreCreateInfo;
+        const VkExportSemaphoreCreateInfoKHR* pExportCreateInfo;
+        const VkSemaphoreTypeCreateInfoKHR*   pTypeCreateInfo;
+    };
+
     Pal::QueueSemaphoreCreateInfo palCreateInfo = {};
     palCreateInfo.maxCount = 1;
 
+    bool     timeline     = false;
+    uint64_t initialValue = 0;
+
+    for (pVkSemaphoreCreateInfo = pCreateInfo; pHeader != nullptr; pHeader = pHeader->pNext)
+    {
+        switch (static_cast<int32_t>(pHeader->sType))
+        {
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHR:
+            // mark this semaphore as shareable.
+            palCreateInfo.flags.shareable         = 1;
+            palCreateInfo.flags.externalOpened    = 1;
+            palCreateInfo.flags.sharedViaNtHandle = (pExportCreateInfo->handleTypes  ==
+                                                     VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT_KHR);
+            break;
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR:
+            timeline     = (pTypeCreateInfo->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE_KHR);
+            initialValue = pTypeCreateInfo->initialValue;
+            break;
+        default:
+            // Skip any unknown extension structures
+            break;
+        }
+    }
+
+    // Device creation rejects the timeline semaphore feature for device groups
+    VK_ASSERT((timeline == false) || (pDevice->NumPalDevices() == 1));
+
     // Allocate sufficient memory
     Pal::Result palResult;
     const size_t palSemaphoreSize = pDevice->PalDevice()->GetQueueSemaphoreSize(palCreateInfo, &palResult);
     VK_ASSERT(palResult == Pal::Result::Success);
 
-    if (pCreateInfo->pNext)
-    {
-        const VkExportSemaphoreCreateInfoKHR* pExportCreateInfo =
-                        static_cast<const VkExportSemaphoreCreateInfoKHR*>(pCreateInfo->pNext);
-
-        VK_ASSERT(pExportCreateInfo->sType == VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHR);
+    // Timeline semaphores additionally carry their payload tracker and the PAL semaphores of their first block of
+    // signal points
+    const size_t timelineOffset = Util::Pow2Align(sizeof(Semaphore) + palSemaphoreSize, VK_DEFAULT_MEM_ALIGN);
+    size_t       totalSize      = sizeof(Semaphore) + palSemaphoreSize;
 
-        // mark this semaphore as shareable.
-        palCreateInfo.flags.shareable         = 1;
-        palCreateInfo.flags.externalOpened    = 1;
-        palCreateInfo.flags.sharedViaNtHandle = (pExportCreateInfo->handleTypes  ==
-                                                 VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT_KHR);
+    if (timeline)
+    {
+        totalSize = timelineOffset + sizeof(TimelineState) + GetTimelineBlockDataSize(pDevice);
     }
 
     void* pMemory = pAllocator->pfnAllocation(
         pAllocator->pUserData,
-        sizeof(Semaphore) + palSemaphoreSize,
+        totalSize,
         VK_DEFAULT_MEM_ALIGN,
         VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
 
@@ -77,7 +110,7 @@ VkResult Semaphore::Create(
     size_t palOffset = sizeof(Semaphore);
 
     // Create the PAL object
-    Pal::IQueueSemaphore* pPalSemaphore;
+    Pal::IQueueSemaphore* pPalSemaphore = nullptr;
 
     if (palResult == Pal::Result::Success)
     {
@@ -87,17 +120,49 @@ VkResult Semaphore::Create(
             &pPalSemaphore);
     }
 
+    TimelineState* pTimeline = nullptr;
+
+    if ((palResult == Pal::Result::Success) && timeline)
+    {
+        pTimeline = VK_PLACEMENT_NEW(Util::VoidPtrInc(pMemory, timelineOffset)) TimelineState();
+
+        palResult = pTimeline->lock.Init();
+
+        pTimeline->completedValue = initialValue;
+        pTimeline->error          = VK_SUCCESS;
+        pTimeline->waiterCount    = pDevice->GetQueueCount();
+
+        if (palResult == Pal::Result::Success)
+        {
+            palResult = InitTimelinePointBlock(pDevice,
+                                               &pTimeline->firstBlock,
+                                               Util::VoidPtrInc(pTimeline, sizeof(TimelineState)));
+        }
+    }
+
     if (palResult == Pal::Result::Success)
     {
         // On success, construct the API object and return to the caller
-        VK_PLACEMENT_NEW(pMemory) Semaphore(pPalSemaphore);
+        VK_PLACEMENT_NEW(pMemory) Semaphore(pPalSemaphore, pTimeline);
 
         *pSemaphore = Semaphore::HandleFromVoidPointer(pMemory);
 
         return VK_SUCCESS;
     }
 
-    // Something broke. Free the memory and return error.
+    // Something broke. Destroy any PAL objects, free the memory and return error.
+    if (pTimeline != nullptr)
+    {
+        DestroyTimelinePointBlock(&pTimeline->firstBlock);
+
+        Util::Destructor(pTimeline);
+    }
+
+    if (pPalSemaphore != nullptr)
+    {
+        pPalSemaphore->Destroy();
+    }
+
     pAllocator->pfnFree(pAllocator->pUserData, pMemory);
 
     return PalToVkResult(palResult);
@@ -180,12 +245,602 @@ VkResult Semaphore::ImportSemaphore(
     return result;
 }
 
+// =====================================================================================================================
+// Returns the size of the waiter slots and PAL semaphores of a block of timeline signal points.
+size_t Semaphore::GetTimelineBlockDataSize(
+    Device*                         pDevice)
+{
+    Pal::QueueSemaphoreCreateInfo createInfo = {};
+    createInfo.maxCount = 1;
+
+    Pal::Result palResult = Pal::Result::Success;
+
+    const size_t palSemaphoreSize = pDevice->PalDevice()->GetQueueSemaphoreSize(createInfo, &palResult);
+    VK_ASSERT(palResult == Pal::Result::Success);
+
+    return TimelinePointsPerBlock * ((pDevice->GetQueueCount() * sizeof(TimelineWaiter)) + palSemaphoreSize);
+}
+
+// =====================================================================================================================
+// Initializes a block of timeline signal points, laying out their waiter slots and creating their PAL semaphores in
+// the given memory.
+Pal::Result Semaphore::InitTimelinePointBlock(
+    Device*                         pDevice,
+    TimelinePointBlock*             pBlock,
+    void*                           pData)
+{
+    Pal::QueueSemaphoreCreateInfo createInfo = {};
+    createInfo.maxCount = 1;
+
+    Pal::Result palResult = Pal::Result::Success;
+
+    const size_t palSemaphoreSize = pDevice->PalDevice()->GetQueueSemaphoreSize(createInfo, &palResult);
+    const size_t waitersSize      = pDevice->GetQueueCount() * sizeof(TimelineWaiter);
+
+    memset(pBlock, 0, sizeof(*pBlock));
+    memset(pData, 0, TimelinePointsPerBlock * waitersSize);
+
+    for (uint32_t i = 0; i < TimelinePointsPerBlock; ++i)
+    {
+        pBlock->points[i].pWaiters = static_cast<TimelineWaiter*>(pData);
+
+        pData = Util::VoidPtrInc(pData, waitersSize);
+    }
+
+    void* pPalMemory = pData;
+
+    for (uint32_t i = 0; (i < TimelinePointsPerBlock) && (palResult == Pal::Result::Success); ++i)
+    {
+        palResult = pDevice->PalDevice()->CreateQueueSemaphore(createInfo,
+                                                               pPalMemory,
+                                                               &pBlock->points[i].pPalSemaphore);
+
+        pPalMemory = Util::VoidPtrInc(pPalMemory, palSemaphoreSize);
+    }
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Destroys the PAL semaphores of a block of timeline signal points.
+void Semaphore::DestroyTimelinePointBlock(
+    TimelinePointBlock*             pBlock)
+{
+    for (uint32_t i = 0; i < TimelinePointsPerBlock; ++i)
+    {
+        if (pBlock->points[i].pPalSemaphore != nullptr)
+        {
+            pBlock->points[i].pPalSemaphore->Destroy();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Marks the signal points whose queue submissions have completed as complete and advances the known payload value
+// accordingly.  The timeline lock must be held.
+void Semaphore::RetireTimelinePoints()
+{
+    for (TimelinePointBlock* pBlock = &m_pTimeline->firstBlock; pBlock != nullptr; pBlock = pBlock->pNext)
+    {
+        for (uint32_t i = 0; i < TimelinePointsPerBlock; ++i)
+        {
+            TimelinePoint* pPoint = &pBlock->points[i];
+
+            if (pPoint->pending && pPoint->pQueue->IsSubmissionComplete(pPoint->submitSerial))
+            {
+                pPoint->pending = false;
+
+                if (pPoint->value > m_pTimeline->completedValue)
+                {
+                    m_pTimeline->completedValue = pPoint->value;
+                }
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns whether a queue wait on the PAL semaphore of a signal point may not have executed yet, clearing the waiter
+// slots whose waits have.  The timeline lock must be held.
+bool Semaphore::HasTimelineWaiters(
+    TimelinePoint* pPoint) const
+{
+    bool hasWaiters = false;
+
+    for (uint32_t i = 0; i < m_pTimeline->waiterCount; ++i)
+    {
+        TimelineWaiter* pWaiter = &pPoint->pWaiters[i];
+
+        if (pWaiter->pQueue != nullptr)
+        {
+            if (pWaiter->pQueue->IsSubmissionComplete(pWaiter->submitSerial))
+            {
+                pWaiter->pQueue = nullptr;
+            }
+            else
+            {
+                hasWaiters = true;
+            }
+        }
+    }
+
+    return hasWaiters;
+}
+
+// =====================================================================================================================
+// Returns the pending signal point with the smallest value that is greater than or equal to the given value, if any.
+// The timeline lock must be held.
+Semaphore::TimelinePoint* Semaphore::FindTimelinePoint(
+    uint64_t value
+    ) const
+{
+    TimelinePoint* pFound = nullptr;
+
+    for (TimelinePointBlock* pBlock = &m_pTimeline->firstBlock; pBlock != nullptr; pBlock = pBlock->pNext)
+    {
+        for (uint32_t i = 0; i < TimelinePointsPerBlock; ++i)
+        {
+            TimelinePoint* pPoint = &pBlock->points[i];
+
+            if (pPoint->pending &&
+                (pPoint->value >= value) &&
+                ((pFound == nullptr) || (pPoint->value < pFound->value)))
+            {
+                pFound = pPoint;
+            }
+        }
+    }
+
+    return pFound;
+}
+
+// =====================================================================================================================
+// Returns the current payload value of a timeline semaphore, along with the error of a failed queue signal, if any.
+VkResult Semaphore::GetCounterValue(
+    uint64_t*                       pValue)
+{
+    VK_ASSERT(IsTimeline());
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    RetireTimelinePoints();
+
+    *pValue = m_pTimeline->completedValue;
+
+    return m_pTimeline->error;
+}
+
+// =====================================================================================================================
+// Records that a queue operation held back on a timeline semaphore wait failed once released, so that the values it
+// was to signal are never going to be reached.  Host waits on such values return the error instead of waiting forever,
+// and queue waits on them no longer hold back queue operations.
+void Semaphore::SetTimelineError(
+    VkResult                        result)
+{
+    VK_ASSERT(IsTimeline() && (result != VK_SUCCESS));
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    if (m_pTimeline->error == VK_SUCCESS)
+    {
+        m_pTimeline->error = result;
+    }
+}
+
+// =====================================================================================================================
+// Signals a timeline semaphore value from the host.  Queue operations held back waiting for this value are released.
+void Semaphore::Signal(
+    Device*                         pDevice,
+    uint64_t                        value)
+{
+    VK_ASSERT(IsTimeline());
+
+    {
+        Util::MutexAuto lock(&m_pTimeline->lock);
+
+        if (value > m_pTimeline->completedValue)
+        {
+            m_pTimeline->completedValue = value;
+        }
+    }
+
+    pDevice->ReleaseTimelineWaits();
+}
+
+// =====================================================================================================================
+// Checks whether the payload of a timeline semaphore has reached the given value.  If not, returns VK_NOT_READY along
+// with the queue submission that signals the value, or a null queue if no signal of the value has been submitted yet.
+VkResult Semaphore::CheckTimelineValue(
+    uint64_t                        value,
+    Queue**                         ppQueue,
+    uint64_t*                       pSubmitSerial)
+{
+    VK_ASSERT(IsTimeline());
+
+    VkResult result = VK_NOT_READY;
+
+    *ppQueue       = nullptr;
+    *pSubmitSerial = 0;
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    RetireTimelinePoints();
+
+    if (m_pTimeline->completedValue >= value)
+    {
+        result = VK_SUCCESS;
+    }
+    else
+    {
+        const TimelinePoint* pPoint = FindTimelinePoint(value);
+
+        if (pPoint != nullptr)
+        {
+            *ppQueue       = pPoint->pQueue;
+            *pSubmitSerial = pPoint->submitSerial;
+        }
+        else if (m_pTimeline->error != VK_SUCCESS)
+        {
+            result = m_pTimeline->error;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Waits on the host until the payload of a timeline semaphore reaches the given value or the timeout (in nanoseconds)
+// expires.
+VkResult Semaphore::Wait(
+    Device*                         pDevice,
+    uint64_t                        value,
+    uint64_t                        timeout)
+{
+    const int64_t startTime = Util::GetPerfCpuTime();
+
+    VkResult result = VK_NOT_READY;
+
+    while (result == VK_NOT_READY)
+    {
+        // Sampled before the payload is examined so that a signal submitted after that ends the wait below
+        const uint64_t progress = pDevice->GetTimelineProgress();
+
+        Queue*   pQueue       = nullptr;
+        uint64_t submitSerial = 0;
+
+        result = CheckTimelineValue(value, &pQueue, &submitSerial);
+
+        if (result == VK_NOT_READY)
+        {
+            const uint64_t remaining = GetRemainingTimeNs(startTime, timeout);
+
+            if (remaining == 0)
+            {
+                result = VK_TIMEOUT;
+            }
+            else
+            {
+                // The payload is re-examined under the lock on the next iteration either way.
+                const Pal::Result palResult = (pQueue != nullptr) ? pQueue->WaitForSubmission(submitSerial, remaining)
+                                                                  : Pal::Result::ErrorFenceNeverSubmitted;
+
+                if (palResult == Pal::Result::ErrorFenceNeverSubmitted)
+                {
+                    // No queue has been asked to signal this value yet; block until a signal is submitted.
+                    pDevice->WaitForTimelineProgress(progress, remaining);
+                }
+                else if ((palResult != Pal::Result::Success) &&
+                         (palResult != Pal::Result::Timeout) &&
+                         (palResult != Pal::Result::NotReady))
+                {
+                    result = PalToVkResult(palResult);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Waits on the host for a set of timeline semaphores - implementation of vkWaitSemaphoresKHR.
+VkResult Semaphore::WaitSemaphores(
+    Device*                         pDevice,
+    const VkSemaphoreWaitInfoKHR*   pWaitInfo,
+    uint64_t                        timeout)
+{
+    // A wait for any of several values waits on the submissions signaling them in slices of this length (in
+    // nanoseconds) while some of the values have no signal submitted yet, so that signals submitted in the meantime
+    // are waited on as well.
+    constexpr uint64_t WaitAnySliceTime = 1000000;
+
+    const int64_t startTime = Util::GetPerfCpuTime();
+    const bool    waitAny   = ((pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT_KHR) != 0) &&
+                              (pWaitInfo->semaphoreCount > 1);
+
+    VkResult result = VK_SUCCESS;
+
+    if (waitAny == false)
+    {
+        for (uint32_t i = 0; (i < pWaitInfo->semaphoreCount) && (result == VK_SUCCESS); ++i)
+        {
+            result = Semaphore::ObjectFromHandle(pWaitInfo->pSemaphores[i])->Wait(
+                pDevice,
+                pWaitInfo->pValues[i],
+                GetRemainingTimeNs(startTime, timeout));
+        }
+    }
+    else
+    {
+        Pal::IFence** ppPalFences =
+            static_cast<Pal::IFence**>(VK_ALLOC_A(sizeof(Pal::IFence*) * pWaitInfo->semaphoreCount));
+
+        result = VK_NOT_READY;
+
+        while (result == VK_NOT_READY)
+        {
+            // Sampled before the payloads are examined so that a signal submitted after that ends the wait below
+            const uint64_t progress = pDevice->GetTimelineProgress();
+
+            uint32_t fenceCount = 0;
+
+            for (uint32_t i = 0; (i < pWaitInfo->semaphoreCount) && (result == VK_NOT_READY); ++i)
+            {
+                Queue*   pQueue       = nullptr;
+                uint64_t submitSerial = 0;
+
+                result = Semaphore::ObjectFromHandle(pWaitInfo->pSemaphores[i])->CheckTimelineValue(
+                    pWaitInfo->pValues[i],
+                    &pQueue,
+                    &submitSerial);
+
+                Pal::IFence* pPalFence = (pQueue != nullptr) ? pQueue->FindSubmissionFence(submitSerial) : nullptr;
+
+                if (pPalFence != nullptr)
+                {
+                    ppPalFences[fenceCount++] = pPalFence;
+                }
+            }
+
+            const uint64_t remaining = GetRemainingTimeNs(startTime, timeout);
+
+            if ((result == VK_NOT_READY) && (remaining == 0))
+            {
+                result = VK_TIMEOUT;
+            }
+            else if ((result == VK_NOT_READY) && (fenceCount == 0))
+            {
+                // None of the values has a signal submitted yet; block until one is.
+                pDevice->WaitForTimelineProgress(progress, remaining);
+            }
+            else if (result == VK_NOT_READY)
+            {
+                const uint64_t palTimeout = (fenceCount < pWaitInfo->semaphoreCount) ?
+                                            Util::Min(remaining, WaitAnySliceTime) : remaining;
+
+                // The payloads are re-examined under their locks on the next iteration either way.
+                const Pal::Result palResult = pDevice->PalDevice(DefaultDeviceIndex)->WaitForFences(fenceCount,
+                                                                                                    ppPalFences,
+                                                                                                    false,
+                                                                                                    palTimeout);
+
+                if ((palResult != Pal::Result::Success) &&
+                    (palResult != Pal::Result::Timeout) &&
+                    (palResult != Pal::Result::NotReady) &&
+                    (palResult != Pal::Result::ErrorFenceNeverSubmitted))
+                {
+                    result = PalToVkResult(palResult);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns whether the payload of a timeline semaphore has reached the given value or a queue signal of a value greater
+// than or equal to it has been submitted, i.e. whether a queue wait on the value can be submitted to PAL.  This is
+// also the case once a queue signal failed, as the wait would otherwise be held back forever.
+bool Semaphore::HasTimelineSignal(
+    uint64_t value)
+{
+    VK_ASSERT(IsTimeline());
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    return (m_pTimeline->completedValue >= value) ||
+           (FindTimelinePoint(value) != nullptr)   ||
+           (m_pTimeline->error != VK_SUCCESS);
+}
+
+// =====================================================================================================================
+// Returns the PAL semaphore a queue must wait on for the payload of a timeline semaphore to reach the given value, or
+// null if the value has already been reached or never will be.  The caller must have checked HasTimelineSignal() for
+// the value.
+//
+// The wait is recorded as part of the given queue submission, and the signal point is not reused for another value
+// until that submission completes.  The queue must track the completion of the submission with a submit fence.
+//
+// NOTE: Every queue waiting on the returned semaphore must signal it again right after the wait so that it stays
+// signaled for any other queue waiting on the same value.
+Pal::IQueueSemaphore* Semaphore::AcquireTimelineWait(
+    uint64_t                        value,
+    Queue*                          pQueue,
+    uint64_t                        submitSerial)
+{
+    VK_ASSERT(IsTimeline());
+
+    Pal::IQueueSemaphore* pPalSemaphore = nullptr;
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    RetireTimelinePoints();
+
+    if (m_pTimeline->completedValue < value)
+    {
+        TimelinePoint* pPoint = FindTimelinePoint(value);
+
+        // Without a pending signal the value is never going to be reached, see SetTimelineError()
+        VK_ASSERT((pPoint != nullptr) || (m_pTimeline->error != VK_SUCCESS));
+
+        if (pPoint != nullptr)
+        {
+            TimelineWaiter* pSlot = nullptr;
+
+            // Each queue has at most one slot, holding its latest submission waiting on the point
+            for (uint32_t i = 0;
+                 (i < m_pTimeline->waiterCount) && ((pSlot == nullptr) || (pSlot->pQueue != pQueue));
+                 ++i)
+            {
+                TimelineWaiter* pWaiter = &pPoint->pWaiters[i];
+
+                if ((pWaiter->pQueue == pQueue) || ((pWaiter->pQueue == nullptr) && (pSlot == nullptr)))
+                {
+                    pSlot = pWaiter;
+                }
+            }
+
+            VK_ASSERT(pSlot != nullptr);
+
+            pSlot->pQueue       = pQueue;
+            pSlot->submitSerial = submitSerial;
+
+            pPalSemaphore = pPoint->pPalSemaphore;
+        }
+    }
+
+    return pPalSemaphore;
+}
+
+// =====================================================================================================================
+// Reserves a signal point for a queue to signal a timeline semaphore value with.  Points are reused once their signal
+// has completed and every queue wait on them has executed.  If there is no such point, another block of points is
+// allocated.  The point must be returned with ReleaseTimelineSignal().
+Pal::Result Semaphore::AcquireTimelineSignal(
+    Device*                         pDevice,
+    TimelinePoint**                 ppPoint)
+{
+    VK_ASSERT(IsTimeline());
+
+    Pal::Result    palResult = Pal::Result::Success;
+    TimelinePoint* pPoint    = nullptr;
+
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    RetireTimelinePoints();
+
+    TimelinePointBlock* pLastBlock = nullptr;
+
+    for (TimelinePointBlock* pBlock = &m_pTimeline->firstBlock;
+         (pBlock != nullptr) && (pPoint == nullptr);
+         pBlock = pBlock->pNext)
+    {
+        for (uint32_t i = 0; (i < TimelinePointsPerBlock) && (pPoint == nullptr); ++i)
+        {
+            TimelinePoint* pCandidate = &pBlock->points[i];
+
+            if ((pCandidate->pending == false)  &&
+                (pCandidate->reserved == false) &&
+                (HasTimelineWaiters(pCandidate) == false))
+            {
+                pPoint = pCandidate;
+            }
+        }
+
+        pLastBlock = pBlock;
+    }
+
+    if (pPoint == nullptr)
+    {
+        void* pMemory = pDevice->VkInstance()->AllocMem(sizeof(TimelinePointBlock) + GetTimelineBlockDataSize(pDevice),
+                                                        VK_DEFAULT_MEM_ALIGN,
+                                                        VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+
+        if (pMemory != nullptr)
+        {
+            TimelinePointBlock* pBlock = static_cast<TimelinePointBlock*>(pMemory);
+
+            palResult = InitTimelinePointBlock(pDevice, pBlock, Util::VoidPtrInc(pMemory, sizeof(TimelinePointBlock)));
+
+            if (palResult == Pal::Result::Success)
+            {
+                pLastBlock->pNext = pBlock;
+                pPoint            = &pBlock->points[0];
+            }
+            else
+            {
+                DestroyTimelinePointBlock(pBlock);
+                pDevice->VkInstance()->FreeMem(pMemory);
+            }
+        }
+        else
+        {
+            palResult = Pal::Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (pPoint != nullptr)
+    {
+        pPoint->reserved = true;
+    }
+
+    *ppPoint = pPoint;
+
+    return palResult;
+}
+
+// =====================================================================================================================
+// Returns a signal point reserved with AcquireTimelineSignal().  If the queue signal operation was submitted, the
+// point becomes pending for the given value until the given queue submission completes.
+void Semaphore::ReleaseTimelineSignal(
+    TimelinePoint*                  pPoint,
+    uint64_t                        value,
+    Queue*                          pQueue,
+    uint64_t                        submitSerial,
+    bool                            submitted)
+{
+    Util::MutexAuto lock(&m_pTimeline->lock);
+
+    pPoint->reserved = false;
+
+    if (submitted)
+    {
+        pPoint->value        = value;
+        pPoint->pQueue       = pQueue;
+        pPoint->submitSerial = submitSerial;
+        pPoint->pending      = true;
+        pPoint->needsDrain   = true;
+    }
+}
+
 // =====================================================================================================================
 // vkDestroyObject entry point for queue semaphore objects.
 VkResult Semaphore::Destroy(
     const Device*                   pDevice,
     const VkAllocationCallbacks*    pAllocator)
 {
+    if (m_pTimeline != nullptr)
+    {
+        TimelinePointBlock* pBlock = &m_pTimeline->firstBlock;
+
+        while (pBlock != nullptr)
+        {
+            TimelinePointBlock* pNext = pBlock->pNext;
+
+            DestroyTimelinePointBlock(pBlock);
+
+            if (pBlock != &m_pTimeline->firstBlock)
+            {
+                pDevice->VkInstance()->FreeMem(pBlock);
+            }
+
+            pBlock = pNext;
+        }
+
+        Util::Destructor(m_pTimeline);
+    }
+
     m_pPalSemaphore->Destroy();
 
     // the sempahore is imported from external
@@ -211,7 +866,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore(
     if (semaphore != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         Semaphore::ObjectFromHandle(semaphore)->Destroy(pDevice, pAllocCB);
     }
@@ -228,6 +883,33 @@ VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreFdKHR(
         reinterpret_cast<Pal::OsExternalHandle*>(pFd));
 }
 
+VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValueKHR(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    uint64_t*                                   pValue)
+{
+    return Semaphore::ObjectFromHandle(semaphore)->GetCounterValue(pValue);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphoresKHR(
+    VkDevice                                    device,
+    const VkSemaphoreWaitInfoKHR*               pWaitInfo,
+    uint64_t                                    timeout)
+{
+    return Semaphore::WaitSemaphores(ApiDevice::ObjectFromHandle(device), pWaitInfo, timeout);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkSignalSemaphoreKHR(
+    VkDevice                                    device,
+    const VkSemaphoreSignalInfoKHR*             pSignalInfo)
+{
+    Device* pDevice = ApiDevice::ObjectFromHandle(device);
+
+    Semaphore::ObjectFromHandle(pSignalInfo->semaphore)->Signal(pDevice, pSignalInfo->value);
+
+    return VK_SUCCESS;
+}
+
 } // namespace entry
 
 } // namespace vk
@@ -210,7 +210,7 @@ VKAPI_ATTR void VKAPI_CALL vkDestroyShaderModule(
     if (shaderModule != VK_NULL_HANDLE)
     {
         const Device*                pDevice  = ApiDevice::ObjectFromHandle(device);
-        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->VkInstance()->GetAllocCallbacks();
+        const VkAllocationCallbacks* pAllocCB = pAllocator ? pAllocator : pDevice->GetAllocCallbacks();
 
         ShaderModule::ObjectFromHandle(shaderModule)->Destroy(pDevice, pAllocCB);
     }